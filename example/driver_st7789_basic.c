@@ -38,6 +38,108 @@
 
 static st7789_handle_t gs_handle;        /**< st7789 handle */
 
+/**
+ * @brief basic example init script
+ * @note  the registers are built from the default definitions, the sleep out needs 5ms before the next command
+ */
+static const uint8_t gsc_st7789_basic_script[] =
+{
+    /* sleep out */
+    0x11, ST7789_SCRIPT_DELAY, 10,
+    /* idle mode off */
+    0x38, 0,
+    /* normal display mode on */
+    0x13, 0,
+    /* display inversion on */
+    0x21, 0,
+    /* gamma */
+    0x26, 1, ST7789_BASIC_DEFAULT_GAMMA_CURVE & 0x0F,
+    /* memory data access control */
+    0x36, 1, ST7789_BASIC_DEFAULT_ACCESS,
+    /* interface pixel format */
+    0x3A, 1, (ST7789_BASIC_DEFAULT_RGB_INTERFACE_COLOR_FORMAT << 4) |
+             (ST7789_BASIC_DEFAULT_CONTROL_INTERFACE_COLOR_FORMAT << 0),
+    /* display brightness */
+    0x51, 1, ST7789_BASIC_DEFAULT_BRIGHTNESS,
+    /* display control */
+    0x53, 1, (ST7789_BASIC_DEFAULT_BRIGHTNESS_BLOCK << 5) | (ST7789_BASIC_DEFAULT_DISPLAY_DIMMING << 3) |
+             (ST7789_BASIC_DEFAULT_BACKLIGHT << 2),
+    /* color enhancement */
+    0x55, 1, (ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT << 7) | (ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT_LEVEL << 4) |
+             (ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT_MODE << 0),
+    /* cabc minimum brightness */
+    0x5E, 1, ST7789_BASIC_DEFAULT_CABC_MINIMUM_BRIGHTNESS,
+    /* ram control */
+    0xB0, 2, (ST7789_BASIC_DEFAULT_RAM_ACCESS << 4) | (ST7789_BASIC_DEFAULT_DISPLAY_MODE << 0),
+             (ST7789_BASIC_DEFAULT_FRAME_TYPE << 4) | (ST7789_BASIC_DEFAULT_DATA_MODE << 3) |
+             (ST7789_BASIC_DEFAULT_RGB_BUS_WIDTH << 2) | (ST7789_BASIC_DEFAULT_PIXEL_TYPE << 0),
+    /* rgb interface control */
+    0xB1, 3, (ST7789_BASIC_DEFAULT_DIRECT_RGB_MODE << 7) | (ST7789_BASIC_DEFAULT_RGB_IF_ENABLE_MODE << 5) |
+             (ST7789_BASIC_DEFAULT_VSPL << 3) | (ST7789_BASIC_DEFAULT_HSPL << 2) |
+             (ST7789_BASIC_DEFAULT_DPL << 1) | (ST7789_BASIC_DEFAULT_EPL << 0),
+             ST7789_BASIC_DEFAULT_VBP & 0x7F, ST7789_BASIC_DEFAULT_HBP & 0x1F,
+    /* porch */
+    0xB2, 5, ST7789_BASIC_DEFAULT_PORCH_NORMAL_BACK, ST7789_BASIC_DEFAULT_PORCH_NORMAL_FRONT,
+             ST7789_BASIC_DEFAULT_PORCH_ENABLE,
+             ((ST7789_BASIC_DEFAULT_PORCH_IDEL_BACK & 0xF) << 4) | (ST7789_BASIC_DEFAULT_PORCH_IDEL_FRONT & 0xF),
+             ((ST7789_BASIC_DEFAULT_PORCH_PART_BACK & 0xF) << 4) | (ST7789_BASIC_DEFAULT_PORCH_PART_FRONT & 0xF),
+    /* frame rate control */
+    0xB3, 3, (ST7789_BASIC_DEFAULT_SEPARATE_FR << 4) | (ST7789_BASIC_DEFAULT_FRAME_RATE_DIVIDED << 0),
+             (ST7789_BASIC_DEFAULT_INVERSION_IDLE_MODE << 5) | (ST7789_BASIC_DEFAULT_IDLE_FRAME_RATE & 0x1F),
+             (ST7789_BASIC_DEFAULT_INVERSION_PARTIAL_MODE << 5) | (ST7789_BASIC_DEFAULT_IDLE_PARTIAL_RATE & 0x1F),
+    /* partial mode control */
+    0xB5, 1, (ST7789_BASIC_DEFAULT_NON_DISPLAY_SOURCE_OUTPUT_LEVEL << 7) |
+             (ST7789_BASIC_DEFAULT_NON_DISPLAY_AREA_SCAN_MODE << 4) |
+             (ST7789_BASIC_DEFAULT_NON_DISPLAY_FRAME_FREQUENCY << 0),
+    /* gate control */
+    0xB7, 1, (ST7789_BASIC_DEFAULT_VGHS << 4) | (ST7789_BASIC_DEFAULT_VGLS_NEGATIVE << 0),
+    /* gate on timing adjustment */
+    0xB8, 4, 0x2A, 0x2B, ST7789_BASIC_DEFAULT_GATE_ON_TIMING & 0x3F,
+             ((ST7789_BASIC_DEFAULT_GATE_OFF_TIMING_RGB & 0xF) << 4) |
+             (ST7789_BASIC_DEFAULT_GATE_OFF_TIMING & 0xF),
+    /* digital gamma */
+    0xBA, 1, ST7789_BASIC_DEFAULT_DIGITAL_GAMMA << 2,
+    /* vcoms */
+    0xBB, 1, (uint8_t)((ST7789_BASIC_DEFAULT_VCOMS - 0.1f) / 0.025f) & 0x3F,
+    /* lcm control */
+    0xC0, 1, (ST7789_BASIC_DEFAULT_XMY << 6) | (ST7789_BASIC_DEFAULT_XBGR << 5) | (ST7789_BASIC_DEFAULT_XINV << 4) |
+             (ST7789_BASIC_DEFAULT_XMX << 3) | (ST7789_BASIC_DEFAULT_XMH << 2) | (ST7789_BASIC_DEFAULT_XMV << 1) |
+             (ST7789_BASIC_DEFAULT_XGS << 0),
+    /* vdv and vrh from */
+    0xC2, 2, ST7789_BASIC_DEFAULT_VDV_VRH_FROM, 0xFF,
+    /* vrhs */
+    0xC3, 1, (uint8_t)((ST7789_BASIC_DEFAULT_VRHS - 3.55f) / 0.05f) & 0x3F,
+    /* vdv */
+    0xC4, 1, (uint8_t)((ST7789_BASIC_DEFAULT_VDV + 0.8f) / 0.025f) & 0x3F,
+    /* vcoms offset */
+    0xC5, 1, (uint8_t)((ST7789_BASIC_DEFAULT_VCOMS_OFFSET + 0.8f) / 0.025f) & 0x3F,
+    /* frame rate */
+    0xC6, 1, (ST7789_BASIC_DEFAULT_INVERSION_SELECTION << 5) | (ST7789_BASIC_DEFAULT_FRAME_RATE << 0),
+    /* cabc control */
+    0xC7, 1, (ST7789_BASIC_DEFAULT_LED_ON << 3) | (ST7789_BASIC_DEFAULT_LED_PWM_INIT << 2) |
+             (ST7789_BASIC_DEFAULT_LED_PWM_FIX << 1) | (ST7789_BASIC_DEFAULT_LED_PWM_POLARITY << 0),
+    /* pwm frequency */
+    0xCC, 1, ST7789_BASIC_DEFAULT_PWM_FREQUENCY,
+    /* power control 1 */
+    0xD0, 2, 0xA4, (ST7789_BASIC_DEFAULT_AVDD << 6) | (ST7789_BASIC_DEFAULT_AVCL_NEGTIVE << 4) |
+                   (ST7789_BASIC_DEFAULT_VDS << 0),
+    /* command 2 */
+    0xDF, 4, 0x5A, 0x69, 0x02, ST7789_BASIC_DEFAULT_COMMAND_2_ENABLE,
+    /* gate */
+    0xE4, 3, (ST7789_BASIC_DEFAULT_GATE_LINE / 8) - 1, ST7789_BASIC_DEFAULT_FIRST_SCAN_LINE,
+             0x10 | (ST7789_BASIC_DEFAULT_GATE_SCAN_MODE << 2) |
+             (ST7789_BASIC_DEFAULT_GATE_SCAN_DIRECTION << 0),
+    /* spi2 */
+    0xE7, 1, (ST7789_BASIC_DEFAULT_SPI2_LANE << 4) | (ST7789_BASIC_DEFAULT_COMMAND_TABLE_2 << 0),
+    /* power control 2 */
+    0xE8, 1, (ST7789_BASIC_DEFAULT_SBCLK_DIV << 4) | (ST7789_BASIC_DEFAULT_STP14CK_DIV << 0),
+    /* equalize time control */
+    0xE9, 3, ST7789_BASIC_DEFAULT_SOURCE_EQUALIZE_TIME, ST7789_BASIC_DEFAULT_SOURCE_PRE_DRIVE_TIME,
+             ST7789_BASIC_DEFAULT_GATE_EQUALIZE_TIME,
+    /* program mode */
+    0xFA, 4, 0x5A, 0x69, 0xEE, ST7789_BASIC_DEFAULT_PROGRAM_MODE << 2,
+};
+
 /**
  * @brief  basic example init
  * @return status code
@@ -48,7 +150,6 @@ static st7789_handle_t gs_handle;        /**< st7789 handle */
 uint8_t st7789_basic_init(void)
 {
     uint8_t res;
-    uint8_t reg;
     uint16_t i;
     uint8_t param_positive[14] = ST7789_BASIC_DEFAULT_POSITIVE_VOLTAGE_GAMMA;
     uint8_t param_negative[14] = ST7789_BASIC_DEFAULT_NEGATIVA_VOLTAGE_GAMMA;
@@ -59,6 +160,8 @@ uint8_t st7789_basic_init(void)
     DRIVER_ST7789_LINK_SPI_INIT(&gs_handle, st7789_interface_spi_init);
     DRIVER_ST7789_LINK_SPI_DEINIT(&gs_handle, st7789_interface_spi_deinit);
     DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(&gs_handle, st7789_interface_spi_write_cmd);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_ASYNC(&gs_handle, st7789_interface_spi_write_cmd_async);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_BUSY(&gs_handle, st7789_interface_spi_write_cmd_busy);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, st7789_interface_cmd_data_gpio_init);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, st7789_interface_cmd_data_gpio_deinit);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, st7789_interface_cmd_data_gpio_write);
@@ -66,8 +169,12 @@ uint8_t st7789_basic_init(void)
     DRIVER_ST7789_LINK_RESET_GPIO_DEINIT(&gs_handle, st7789_interface_reset_gpio_deinit);
     DRIVER_ST7789_LINK_RESET_GPIO_WRITE(&gs_handle, st7789_interface_reset_gpio_write);
     DRIVER_ST7789_LINK_DELAY_MS(&gs_handle, st7789_interface_delay_ms);
+    DRIVER_ST7789_LINK_GET_TIME_MS(&gs_handle, st7789_interface_get_time_ms);
     DRIVER_ST7789_LINK_DEBUG_PRINT(&gs_handle, st7789_interface_debug_print);
 
+    /* report the async write end to the handle */
+    st7789_interface_spi_async_attach(&gs_handle);
+
     /* st7789 init */
     res = st7789_init(&gs_handle);
     if (res != 0)
@@ -97,394 +204,11 @@ uint8_t st7789_basic_init(void)
         return 1;
     }
 
-    /* sleep out */
-    res = st7789_sleep_out(&gs_handle);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: sleep out failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* idle mode off */
-    res = st7789_idle_mode_off(&gs_handle);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: idle mode off failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* normal display mode on */
-    res = st7789_normal_display_mode_on(&gs_handle);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: normal display mode on failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* display inversion on */
-    res = st7789_display_inversion_on(&gs_handle);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: display inversion on failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default gamma */
-    res = st7789_set_gamma(&gs_handle, ST7789_BASIC_DEFAULT_GAMMA_CURVE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set gamma failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default memory data access control */
-    res = st7789_set_memory_data_access_control(&gs_handle, ST7789_BASIC_DEFAULT_ACCESS);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set memory data access control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default pixel format */
-    res = st7789_set_interface_pixel_format(&gs_handle, ST7789_BASIC_DEFAULT_RGB_INTERFACE_COLOR_FORMAT,
-                                            ST7789_BASIC_DEFAULT_CONTROL_INTERFACE_COLOR_FORMAT);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default brightness */
-    res = st7789_set_display_brightness(&gs_handle, ST7789_BASIC_DEFAULT_BRIGHTNESS);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set display brightness failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default brightness control */
-    res = st7789_set_display_control(&gs_handle,
-                                     ST7789_BASIC_DEFAULT_BRIGHTNESS_BLOCK,
-                                     ST7789_BASIC_DEFAULT_DISPLAY_DIMMING,
-                                     ST7789_BASIC_DEFAULT_BACKLIGHT);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set display control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default color enhancement */
-    res = st7789_set_brightness_control_and_color_enhancement(&gs_handle, ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT,
-                                                              ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT_MODE,
-                                                              ST7789_BASIC_DEFAULT_COLOR_ENHANCEMENT_LEVEL);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set brightness control and color enhancement failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default cabc minimum brightness */
-    res = st7789_set_cabc_minimum_brightness(&gs_handle, ST7789_BASIC_DEFAULT_CABC_MINIMUM_BRIGHTNESS);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set cabc minimum brightness failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default ram control */
-    res = st7789_set_ram_control(&gs_handle,
-                                 ST7789_BASIC_DEFAULT_RAM_ACCESS,
-                                 ST7789_BASIC_DEFAULT_DISPLAY_MODE,
-                                 ST7789_BASIC_DEFAULT_FRAME_TYPE,
-                                 ST7789_BASIC_DEFAULT_DATA_MODE,
-                                 ST7789_BASIC_DEFAULT_RGB_BUS_WIDTH,
-                                 ST7789_BASIC_DEFAULT_PIXEL_TYPE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set ram control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default rgb interface control */
-    res = st7789_set_rgb_interface_control(&gs_handle,
-                                           ST7789_BASIC_DEFAULT_DIRECT_RGB_MODE,
-                                           ST7789_BASIC_DEFAULT_RGB_IF_ENABLE_MODE,
-                                           ST7789_BASIC_DEFAULT_VSPL,
-                                           ST7789_BASIC_DEFAULT_HSPL,
-                                           ST7789_BASIC_DEFAULT_DPL,
-                                           ST7789_BASIC_DEFAULT_EPL,
-                                           ST7789_BASIC_DEFAULT_VBP,
-                                           ST7789_BASIC_DEFAULT_HBP);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set rgb interface control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default porch */
-    res = st7789_set_porch(&gs_handle,
-                           ST7789_BASIC_DEFAULT_PORCH_NORMAL_BACK,
-                           ST7789_BASIC_DEFAULT_PORCH_NORMAL_FRONT,
-                           ST7789_BASIC_DEFAULT_PORCH_ENABLE,
-                           ST7789_BASIC_DEFAULT_PORCH_IDEL_BACK,
-                           ST7789_BASIC_DEFAULT_PORCH_IDEL_FRONT,
-                           ST7789_BASIC_DEFAULT_PORCH_PART_BACK,
-                           ST7789_BASIC_DEFAULT_PORCH_PART_FRONT);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set porch failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default frame rate control */
-    res = st7789_set_frame_rate_control(&gs_handle,
-                                        ST7789_BASIC_DEFAULT_SEPARATE_FR,
-                                        ST7789_BASIC_DEFAULT_FRAME_RATE_DIVIDED,
-                                        ST7789_BASIC_DEFAULT_INVERSION_IDLE_MODE,
-                                        ST7789_BASIC_DEFAULT_IDLE_FRAME_RATE,
-                                        ST7789_BASIC_DEFAULT_INVERSION_PARTIAL_MODE,
-                                        ST7789_BASIC_DEFAULT_IDLE_PARTIAL_RATE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set frame rate control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default partial mode control */
-    res = st7789_set_partial_mode_control(&gs_handle,
-                                          ST7789_BASIC_DEFAULT_NON_DISPLAY_SOURCE_OUTPUT_LEVEL,
-                                          ST7789_BASIC_DEFAULT_NON_DISPLAY_AREA_SCAN_MODE,
-                                          ST7789_BASIC_DEFAULT_NON_DISPLAY_FRAME_FREQUENCY);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set partial mode control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default gate control */
-    res = st7789_set_gate_control(&gs_handle, ST7789_BASIC_DEFAULT_VGHS, ST7789_BASIC_DEFAULT_VGLS_NEGATIVE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set gate control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default gate on timing adjustment */
-    res = st7789_set_gate_on_timing_adjustment(&gs_handle,
-                                               ST7789_BASIC_DEFAULT_GATE_ON_TIMING,
-                                               ST7789_BASIC_DEFAULT_GATE_OFF_TIMING_RGB,
-                                               ST7789_BASIC_DEFAULT_GATE_OFF_TIMING);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set gate on timing adjustment failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default digital gamma */
-    res = st7789_set_digital_gamma(&gs_handle, ST7789_BASIC_DEFAULT_DIGITAL_GAMMA);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set digital gamma failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* vcom convert to register  */
-    res = st7789_vcom_convert_to_register(&gs_handle, ST7789_BASIC_DEFAULT_VCOMS, &reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: vcom convert to register failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default vcoms */
-    res = st7789_set_vcoms(&gs_handle, reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set vcoms failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default lcm control */
-    res = st7789_set_lcm_control(&gs_handle,
-                                 ST7789_BASIC_DEFAULT_XMY,
-                                 ST7789_BASIC_DEFAULT_XBGR,
-                                 ST7789_BASIC_DEFAULT_XINV,
-                                 ST7789_BASIC_DEFAULT_XMX,
-                                 ST7789_BASIC_DEFAULT_XMH,
-                                 ST7789_BASIC_DEFAULT_XMV,
-                                 ST7789_BASIC_DEFAULT_XGS);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set lcm control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default vdv vrh cmd */
-    res = st7789_set_vdv_vrh_from(&gs_handle, ST7789_BASIC_DEFAULT_VDV_VRH_FROM);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set vdv vrh from failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* vrhs convert to register */
-    res = st7789_vrhs_convert_to_register(&gs_handle, ST7789_BASIC_DEFAULT_VRHS, &reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: vrhs convert to register failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default vrhs */
-    res = st7789_set_vrhs(&gs_handle, reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set vrhs failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* vdv convert to register */
-    res = st7789_vdv_convert_to_register(&gs_handle, ST7789_BASIC_DEFAULT_VDV, &reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: vdv convert to register failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default vdv */
-    res = st7789_set_vdv(&gs_handle, reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set vdv failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* vcoms offset convert to register */
-    res = st7789_vcoms_offset_convert_to_register(&gs_handle, ST7789_BASIC_DEFAULT_VCOMS_OFFSET, &reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: vcoms offset convert to register failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default vcoms offset */
-    res = st7789_set_vcoms_offset(&gs_handle, reg);
+    /* run the init script */
+    res = st7789_run_script(&gs_handle, gsc_st7789_basic_script, sizeof(gsc_st7789_basic_script));
     if (res != 0)
     {
-        st7789_interface_debug_print("st7789: set vcoms offset failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default frame rate */
-    res = st7789_set_frame_rate(&gs_handle, ST7789_BASIC_DEFAULT_INVERSION_SELECTION, ST7789_BASIC_DEFAULT_FRAME_RATE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set frame rate failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default cabc control */
-    res = st7789_set_cabc_control(&gs_handle,
-                                  ST7789_BASIC_DEFAULT_LED_ON,
-                                  ST7789_BASIC_DEFAULT_LED_PWM_INIT,
-                                  ST7789_BASIC_DEFAULT_LED_PWM_FIX,
-                                  ST7789_BASIC_DEFAULT_LED_PWM_POLARITY);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set cabc control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default pwm frequency */
-    res = st7789_set_pwm_frequency(&gs_handle, ST7789_BASIC_DEFAULT_PWM_FREQUENCY);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set pwm frequency failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default power control 1 */
-    res = st7789_set_power_control_1(&gs_handle,
-                                     ST7789_BASIC_DEFAULT_AVDD,
-                                     ST7789_BASIC_DEFAULT_AVCL_NEGTIVE,
-                                     ST7789_BASIC_DEFAULT_VDS);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set power control 1 failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default command 2 */
-    res = st7789_set_command_2_enable(&gs_handle, ST7789_BASIC_DEFAULT_COMMAND_2_ENABLE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set command 2 enable failed.\n");
+        st7789_interface_debug_print("st7789: run script failed.\n");
         (void)st7789_deinit(&gs_handle);
 
         return 1;
@@ -536,73 +260,6 @@ uint8_t st7789_basic_init(void)
         return 1;
     }
 
-    /* set default gate line convert to register */
-    res = st7789_gate_line_convert_to_register(&gs_handle, ST7789_BASIC_DEFAULT_GATE_LINE, &reg);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: gate line convert to register failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default gate */
-    res = st7789_set_gate(&gs_handle,
-                          reg,
-                          ST7789_BASIC_DEFAULT_FIRST_SCAN_LINE,
-                          ST7789_BASIC_DEFAULT_GATE_SCAN_MODE,
-                          ST7789_BASIC_DEFAULT_GATE_SCAN_DIRECTION);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set gate failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default spi2 */
-    res = st7789_set_spi2_enable(&gs_handle, ST7789_BASIC_DEFAULT_SPI2_LANE, ST7789_BASIC_DEFAULT_COMMAND_TABLE_2);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set spi2 enable failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default power control 2 */
-    res = st7789_set_power_control_2(&gs_handle, ST7789_BASIC_DEFAULT_SBCLK_DIV, ST7789_BASIC_DEFAULT_STP14CK_DIV);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set power control 2 failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default equalize time control */
-    res = st7789_set_equalize_time_control(&gs_handle,
-                                           ST7789_BASIC_DEFAULT_SOURCE_EQUALIZE_TIME,
-                                           ST7789_BASIC_DEFAULT_SOURCE_PRE_DRIVE_TIME,
-                                           ST7789_BASIC_DEFAULT_GATE_EQUALIZE_TIME);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set equalize time control failed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
-    /* set default program mode */
-    res = st7789_set_program_mode_enable(&gs_handle, ST7789_BASIC_DEFAULT_PROGRAM_MODE);
-    if (res != 0)
-    {
-        st7789_interface_debug_print("st7789: set program mode enable ailed.\n");
-        (void)st7789_deinit(&gs_handle);
-
-        return 1;
-    }
-
     /* display on */
     res = st7789_display_on(&gs_handle);
     if (res != 0)
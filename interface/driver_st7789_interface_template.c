@@ -69,11 +69,48 @@ uint8_t st7789_interface_spi_deinit(void)
  *            - 1 write failed
  * @note      none
  */
-uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
+uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint32_t len)
 {
     return 0;
 }
 
+/**
+ * @brief     interface spi bus write without waiting
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the buffer must stay valid until the write is done
+ */
+uint8_t st7789_interface_spi_write_cmd_async(uint8_t *buf, uint32_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface spi bus write status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ *         - 2 the last write failed
+ * @note   none
+ */
+uint8_t st7789_interface_spi_write_cmd_busy(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface spi async completion target
+ * @param[in] *handle pointer to an st7789 handle structure, NULL stops the reports
+ * @note      the end of every async write is reported to the handle with st7789_async_complete
+ */
+void st7789_interface_spi_async_attach(st7789_handle_t *handle)
+{
+    
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -84,6 +121,16 @@ void st7789_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief  interface get time ms
+ * @return current time in ms
+ * @note   the time wraps around at 2^32 ms
+ */
+uint32_t st7789_interface_get_time_ms(void)
+{
+    return 0;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
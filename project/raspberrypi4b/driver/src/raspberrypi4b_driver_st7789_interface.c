@@ -38,6 +38,7 @@
 #include "spi.h"
 #include "wire.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief spi device name definition
@@ -49,6 +50,38 @@
  */
 static int gs_fd;                           /**< spi handle */
 
+/**
+ * @brief spi async result definition
+ */
+static volatile uint8_t gs_async_res;       /**< async write result */
+
+/**
+ * @brief spi async completion target definition
+ */
+static st7789_handle_t *volatile gs_async_handle;        /**< handle told about the async write end */
+
+/**
+ * @brief command data level definition
+ */
+static uint8_t gs_cmd_data_level;           /**< command data gpio level */
+
+/**
+ * @brief     interface spi async completion callback
+ * @param[in] res write result
+ * @note      called in the spi worker thread
+ */
+static void a_st7789_interface_spi_async_callback(uint8_t res)
+{
+    st7789_handle_t *handle;
+    
+    gs_async_res = res;
+    handle = gs_async_handle;
+    if (handle != NULL)
+    {
+        (void)st7789_async_complete(handle, res);
+    }
+}
+
 /**
  * @brief  interface spi bus init
  * @return status code
@@ -58,7 +91,21 @@ static int gs_fd;                           /**< spi handle */
  */
 uint8_t st7789_interface_spi_init(void)
 {
-    return spi_init(SPI_DEVICE_NAME, &gs_fd, SPI_MODE_TYPE_3, 1000 * 1000 * 5);
+    if (spi_init(SPI_DEVICE_NAME, &gs_fd, SPI_MODE_TYPE_3, 1000 * 1000 * 5) != 0)
+    {
+        return 1;
+    }
+    
+    /* start the async worker */
+    gs_async_res = 0;
+    if (spi_async_init() != 0)
+    {
+        (void)spi_deinit(gs_fd);
+        
+        return 1;
+    }
+    
+    return 0;
 }
 
 /**
@@ -70,6 +117,11 @@ uint8_t st7789_interface_spi_init(void)
  */
 uint8_t st7789_interface_spi_deinit(void)
 {
+    if (spi_async_deinit() != 0)
+    {
+        return 1;
+    }
+    
     return spi_deinit(gs_fd);
 }
 
@@ -82,11 +134,61 @@ uint8_t st7789_interface_spi_deinit(void)
  *            - 1 write failed
  * @note      none
  */
-uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
+uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint32_t len)
 {
     return spi_write_cmd(gs_fd, buf, len);
 }
 
+/**
+ * @brief     interface spi bus write without waiting
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the buffer must stay valid until the write is done
+ */
+uint8_t st7789_interface_spi_write_cmd_async(uint8_t *buf, uint32_t len)
+{
+    gs_async_res = 0;
+    
+    return spi_write_cmd_async(gs_fd, buf, len, a_st7789_interface_spi_async_callback);
+}
+
+/**
+ * @brief  interface spi bus write status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ *         - 2 the last write failed
+ * @note   none
+ */
+uint8_t st7789_interface_spi_write_cmd_busy(void)
+{
+    if (spi_async_busy() != 0)
+    {
+        return 1;
+    }
+    if (gs_async_res != 0)
+    {
+        gs_async_res = 0;
+        
+        return 2;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi async completion target
+ * @param[in] *handle pointer to an st7789 handle structure, NULL stops the reports
+ * @note      the end of every async write is reported to the handle with st7789_async_complete
+ */
+void st7789_interface_spi_async_attach(st7789_handle_t *handle)
+{
+    gs_async_handle = handle;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -97,6 +199,20 @@ void st7789_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface get time ms
+ * @return current time in ms
+ * @note   the time wraps around at 2^32 ms
+ */
+uint32_t st7789_interface_get_time_ms(void)
+{
+    struct timespec t;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &t);
+    
+    return (uint32_t)((uint64_t)t.tv_sec * 1000 + (uint64_t)t.tv_nsec / 1000000);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -124,6 +240,9 @@ void st7789_interface_debug_print(const char *const fmt, ...)
  */
 uint8_t st7789_interface_cmd_data_gpio_init(void)
 {
+    /* the level is unknown until the first write */
+    gs_cmd_data_level = 0xFF;
+    
     return wire_init();
 }
 
@@ -145,11 +264,24 @@ uint8_t st7789_interface_cmd_data_gpio_deinit(void)
  * @return    status code
  *            - 0 success
  *            - 1 gpio write failed
- * @note      none
+ * @note      the gpio is only written when the level changes
  */
 uint8_t st7789_interface_cmd_data_gpio_write(uint8_t value)
 {
-    return wire_write(value);
+    /* back to back data writes keep the level */
+    if (value == gs_cmd_data_level)
+    {
+        return 0;
+    }
+    if (wire_write(value) != 0)
+    {
+        gs_cmd_data_level = 0xFF;
+        
+        return 1;
+    }
+    gs_cmd_data_level = value;
+    
+    return 0;
 }
 
 /**
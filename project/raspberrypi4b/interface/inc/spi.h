@@ -134,9 +134,9 @@ uint8_t spi_read_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len);
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the buffer is sent in as few messages as the spidev bufsiz allows
  */
-uint8_t spi_write_cmd(int fd, uint8_t *buf, uint16_t len);
+uint8_t spi_write_cmd(int fd, uint8_t *buf, uint32_t len);
 
 /**
  * @brief     spi bus write
@@ -191,6 +191,47 @@ uint8_t spi_write_read(int fd, uint8_t *in_buf, uint32_t in_len, uint8_t *out_bu
  */
 uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief  spi async worker init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t spi_async_init(void);
+
+/**
+ * @brief  spi async worker deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   the job in flight is finished before the worker exits
+ */
+uint8_t spi_async_deinit(void);
+
+/**
+ * @brief     spi bus write command without waiting
+ * @param[in] fd spi handle
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *callback pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the buffer must stay valid until the callback is called,
+ *            the callback runs in the worker thread
+ */
+uint8_t spi_write_cmd_async(int fd, uint8_t *buf, uint32_t len, void (*callback)(uint8_t res));
+
+/**
+ * @brief  spi async busy status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ * @note   none
+ */
+uint8_t spi_async_busy(void);
+
 /**
  * @}
  */
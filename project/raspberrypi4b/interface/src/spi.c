@@ -38,6 +38,39 @@
 #include <linux/spi/spidev.h>
 #include <sys/ioctl.h>
 #include <fcntl.h>
+#include <pthread.h>
+
+/**
+ * @brief spi bufsiz definition
+ */
+#define SPI_BUFSIZ_PATH        "/sys/module/spidev/parameters/bufsiz"        /**< spidev bufsiz parameter */
+#define SPI_BUFSIZ_DEFAULT     4096                                          /**< spidev default bufsiz */
+
+/**
+ * @brief spi max message length definition
+ */
+static uint32_t gs_max_length = SPI_BUFSIZ_DEFAULT;        /**< spidev bufsiz */
+
+/**
+ * @brief spi async job structure definition
+ */
+typedef struct spi_async_job_s
+{
+    int fd;                                 /**< spi handle */
+    uint8_t *buf;                           /**< data buffer */
+    uint32_t len;                           /**< data length */
+    void (*callback)(uint8_t res);          /**< completion callback */
+    uint8_t busy;                           /**< busy flag */
+    uint8_t run;                            /**< worker run flag */
+} spi_async_job_t;
+
+/**
+ * @brief spi async worker definition
+ */
+static pthread_t gs_async_thread;                                         /**< worker thread */
+static pthread_mutex_t gs_async_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< job mutex */
+static pthread_cond_t gs_async_cond = PTHREAD_COND_INITIALIZER;           /**< job condition */
+static spi_async_job_t gs_async_job;                                      /**< the job in flight */
 
 /**
  * @brief      spi bus init
@@ -53,6 +86,8 @@
 uint8_t spi_init(char *name, int *fd, spi_mode_type_t mode, uint32_t freq)
 {
     int i;
+    FILE *file;
+    unsigned int bufsiz;
     
     /* open the spi device */
     *fd = open(name, O_RDWR);
@@ -132,6 +167,17 @@ uint8_t spi_init(char *name, int *fd, spi_mode_type_t mode, uint32_t freq)
             return 1;
         }
         
+        /* spidev rejects a message longer than its bufsiz */
+        file = fopen(SPI_BUFSIZ_PATH, "r");
+        if (file != NULL)
+        {
+            if ((fscanf(file, "%u", &bufsiz) == 1) && (bufsiz != 0))
+            {
+                gs_max_length = bufsiz;
+            }
+            (void)fclose(file);
+        }
+        
         return 0;
     }
 }
@@ -295,28 +341,35 @@ uint8_t spi_read_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len)
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the buffer is sent in as few messages as the spidev bufsiz allows
  */
-uint8_t spi_write_cmd(int fd, uint8_t *buf, uint16_t len)
+uint8_t spi_write_cmd(int fd, uint8_t *buf, uint32_t len)
 {
     struct spi_ioc_transfer k;
+    uint32_t size;
     int l;
     
     /* clear ioc transfer */
     memset(&k, 0, sizeof(k));
-    
-    /* set the param */
-    k.tx_buf = (unsigned long)buf;
-    k.len = len;
     k.cs_change = 0;
     
-    /* transmit */
-    l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
-    if (l != len)
+    while (len > 0)
     {
-        perror("spi: length check error.\n");
+        /* set the param */
+        size = (len > gs_max_length) ? gs_max_length : len;
+        k.tx_buf = (unsigned long)buf;
+        k.len = size;
         
-        return 1;
+        /* transmit */
+        l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
+        if ((l < 0) || ((uint32_t)l != size))
+        {
+            perror("spi: length check error.\n");
+            
+            return 1;
+        }
+        buf += size;
+        len -= size;
     }
     
     return 0;
@@ -512,3 +565,177 @@ uint8_t spi_transmit(int fd, uint8_t *tx, uint8_t *rx, uint16_t len)
     
     return 0;
 }
+
+/**
+ * @brief     spi async worker thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      none
+ */
+static void *a_spi_async_worker(void *arg)
+{
+    uint8_t res;
+    uint8_t *buf;
+    uint32_t len;
+    
+    (void)arg;
+    pthread_mutex_lock(&gs_async_mutex);
+    while (1)
+    {
+        /* wait for a job or the exit */
+        while ((gs_async_job.run != 0) && (gs_async_job.busy == 0))
+        {
+            pthread_cond_wait(&gs_async_cond, &gs_async_mutex);
+        }
+        if (gs_async_job.run == 0)
+        {
+            break;
+        }
+        buf = gs_async_job.buf;
+        len = gs_async_job.len;
+        pthread_mutex_unlock(&gs_async_mutex);
+        
+        /* send the job */
+        res = spi_write_cmd(gs_async_job.fd, buf, len);
+        
+        /* report before the busy flag is cleared */
+        if (gs_async_job.callback != NULL)
+        {
+            gs_async_job.callback(res);
+        }
+        pthread_mutex_lock(&gs_async_mutex);
+        gs_async_job.busy = 0;
+        pthread_cond_broadcast(&gs_async_cond);
+    }
+    pthread_mutex_unlock(&gs_async_mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief  spi async worker init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t spi_async_init(void)
+{
+    pthread_mutex_lock(&gs_async_mutex);
+    if (gs_async_job.run != 0)
+    {
+        pthread_mutex_unlock(&gs_async_mutex);
+        
+        return 0;
+    }
+    gs_async_job.busy = 0;
+    gs_async_job.run = 1;
+    pthread_mutex_unlock(&gs_async_mutex);
+    
+    /* start the worker */
+    if (pthread_create(&gs_async_thread, NULL, a_spi_async_worker, NULL) != 0)
+    {
+        perror("spi: create thread failed.\n");
+        pthread_mutex_lock(&gs_async_mutex);
+        gs_async_job.run = 0;
+        pthread_mutex_unlock(&gs_async_mutex);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  spi async worker deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   the job in flight is finished before the worker exits
+ */
+uint8_t spi_async_deinit(void)
+{
+    pthread_mutex_lock(&gs_async_mutex);
+    if (gs_async_job.run == 0)
+    {
+        pthread_mutex_unlock(&gs_async_mutex);
+        
+        return 0;
+    }
+    
+    /* let the job in flight finish */
+    while (gs_async_job.busy != 0)
+    {
+        pthread_cond_wait(&gs_async_cond, &gs_async_mutex);
+    }
+    gs_async_job.run = 0;
+    pthread_cond_broadcast(&gs_async_cond);
+    pthread_mutex_unlock(&gs_async_mutex);
+    
+    /* wait for the worker */
+    if (pthread_join(gs_async_thread, NULL) != 0)
+    {
+        perror("spi: join thread failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     spi bus write command without waiting
+ * @param[in] fd spi handle
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *callback pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the buffer must stay valid until the callback is called,
+ *            the callback runs in the worker thread
+ */
+uint8_t spi_write_cmd_async(int fd, uint8_t *buf, uint32_t len, void (*callback)(uint8_t res))
+{
+    pthread_mutex_lock(&gs_async_mutex);
+    if (gs_async_job.run == 0)
+    {
+        pthread_mutex_unlock(&gs_async_mutex);
+        perror("spi: async worker is not running.\n");
+        
+        return 1;
+    }
+    
+    /* one job in flight at a time */
+    while (gs_async_job.busy != 0)
+    {
+        pthread_cond_wait(&gs_async_cond, &gs_async_mutex);
+    }
+    gs_async_job.fd = fd;
+    gs_async_job.buf = buf;
+    gs_async_job.len = len;
+    gs_async_job.callback = callback;
+    gs_async_job.busy = 1;
+    pthread_cond_broadcast(&gs_async_cond);
+    pthread_mutex_unlock(&gs_async_mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief  spi async busy status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ * @note   none
+ */
+uint8_t spi_async_busy(void)
+{
+    uint8_t busy;
+    
+    pthread_mutex_lock(&gs_async_mutex);
+    busy = gs_async_job.busy;
+    pthread_mutex_unlock(&gs_async_mutex);
+    
+    return busy;
+}
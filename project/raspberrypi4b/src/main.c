@@ -36,6 +36,9 @@
 
 #include "driver_st7789_basic.h"
 #include "driver_st7789_display_test.h"
+#include "driver_st7789_async_test.h"
+#include "driver_st7789_benchmark_test.h"
+#include "driver_st7789_emulator_test.h"
 #include "shell.h"
 #include <getopt.h>
 #include <sys/types.h>
@@ -53,6 +56,26 @@ volatile uint16_t g_len;                         /**< uart buffer length */
 static int gs_listen_fd;                         /**< network handle */
 static int gs_conn_fd;                           /**< network handle */
 static struct sockaddr_in gs_server_addr;        /**< server address */
+static FILE *gs_ppm_file;                        /**< emulator ppm file */
+
+/**
+ * @brief     write the emulator ppm file
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ppm_write(uint8_t *buf, uint32_t len)
+{
+    if (fwrite(buf, 1, len, gs_ppm_file) != len)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
 
 /**
  * @brief     st7789 full function
@@ -276,6 +299,55 @@ uint8_t st7789(uint8_t argc, char** argv)
             return 0;
         }
     }
+    else if (strcmp("t_async", type) == 0)
+    {
+        /* run async test */
+        if (st7789_async_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_benchmark", type) == 0)
+    {
+        /* run benchmark test */
+        if (st7789_benchmark_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_emulator", type) == 0)
+    {
+        uint8_t res;
+        
+        /* open the ppm file */
+        gs_ppm_file = fopen("st7789_emulator.ppm", "wb");
+        if (gs_ppm_file == NULL)
+        {
+            st7789_interface_debug_print("st7789: open st7789_emulator.ppm failed.\n");
+            
+            return 1;
+        }
+        
+        /* run emulator test */
+        res = st7789_emulator_test(a_ppm_write);
+        (void)fclose(gs_ppm_file);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_basic-str", type) == 0)
     {
         uint8_t res;
@@ -454,6 +526,9 @@ uint8_t st7789(uint8_t argc, char** argv)
         st7789_interface_debug_print("  st7789 (-h | --help)\n");
         st7789_interface_debug_print("  st7789 (-p | --port)\n");
         st7789_interface_debug_print("  st7789 (-t display | --test=display)\n");
+        st7789_interface_debug_print("  st7789 (-t async | --test=async)\n");
+        st7789_interface_debug_print("  st7789 (-t benchmark | --test=benchmark)\n");
+        st7789_interface_debug_print("  st7789 (-t emulator | --test=emulator)\n");
         st7789_interface_debug_print("  st7789 (-e basic-init | --example=basic-init)\n");
         st7789_interface_debug_print("  st7789 (-e basic-deinit | --example=basic-deinit)\n");
         st7789_interface_debug_print("  st7789 (-e basic-str | --example=basic-str) [--str=<string>]\n");
@@ -473,7 +548,7 @@ uint8_t st7789(uint8_t argc, char** argv)
         st7789_interface_debug_print("  -i, --information       Show the chip information.\n");
         st7789_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         st7789_interface_debug_print("      --str=<string>      Set the display string.([default: libdriver])\n");
-        st7789_interface_debug_print("  -t <display>, --test=<display>\n");
+        st7789_interface_debug_print("  -t <display | async | benchmark | emulator>, --test=<display | async | benchmark | emulator>\n");
         st7789_interface_debug_print("                          Run the driver test.\n");
         st7789_interface_debug_print("      --x0=<x0>           Set the x0 and it is the x of the point.\n");
         st7789_interface_debug_print("      --x1=<x1>           Set the x1 and it is the top left x of the rect.\n");
@@ -41,6 +41,16 @@
 #include "wire.h"
 #include <stdarg.h>
 
+/**
+ * @brief spi async result definition
+ */
+static uint8_t gs_async_res;        /**< async write result */
+
+/**
+ * @brief spi async completion target definition
+ */
+static st7789_handle_t *gs_async_handle;        /**< handle told about the async write end */
+
 /**
  * @brief  interface spi bus init
  * @return status code
@@ -74,9 +84,73 @@ uint8_t st7789_interface_spi_deinit(void)
  *            - 1 write failed
  * @note      none
  */
-uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
+uint8_t st7789_interface_spi_write_cmd(uint8_t *buf, uint32_t len)
 {
-    return spi_write_cmd(buf, len);
+    uint16_t l;
+    
+    /* the hal transmit size is 16 bits */
+    while (len > 0)
+    {
+        l = (len > 0xFFFFU) ? 0xFFFFU : (uint16_t)len;
+        if (spi_write_cmd(buf, l) != 0)
+        {
+            return 1;
+        }
+        buf += l;
+        len -= l;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus write without waiting
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      spi dma is not configured, so the write completes before return
+ */
+uint8_t st7789_interface_spi_write_cmd_async(uint8_t *buf, uint32_t len)
+{
+    gs_async_res = st7789_interface_spi_write_cmd(buf, len);
+    if (gs_async_handle != NULL)
+    {
+        (void)st7789_async_complete(gs_async_handle, gs_async_res);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  interface spi bus write status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ *         - 2 the last write failed
+ * @note   none
+ */
+uint8_t st7789_interface_spi_write_cmd_busy(void)
+{
+    if (gs_async_res != 0)
+    {
+        gs_async_res = 0;
+        
+        return 2;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi async completion target
+ * @param[in] *handle pointer to an st7789 handle structure, NULL stops the reports
+ * @note      the end of every async write is reported to the handle with st7789_async_complete
+ */
+void st7789_interface_spi_async_attach(st7789_handle_t *handle)
+{
+    gs_async_handle = handle;
 }
 
 /**
@@ -89,6 +163,16 @@ void st7789_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface get time ms
+ * @return current time in ms
+ * @note   the time wraps around at 2^32 ms
+ */
+uint32_t st7789_interface_get_time_ms(void)
+{
+    return HAL_GetTick();
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -36,6 +36,8 @@
 
 #include "driver_st7789_basic.h"
 #include "driver_st7789_display_test.h"
+#include "driver_st7789_async_test.h"
+#include "driver_st7789_benchmark_test.h"
 #include "clock.h"
 #include "delay.h"
 #include "uart.h"
@@ -271,6 +273,30 @@ uint8_t st7789(uint8_t argc, char** argv)
             return 0;
         }
     }
+    else if (strcmp("t_async", type) == 0)
+    {
+        /* run async test */
+        if (st7789_async_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_benchmark", type) == 0)
+    {
+        /* run benchmark test */
+        if (st7789_benchmark_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_basic-str", type) == 0)
     {
         uint8_t res;
@@ -449,6 +475,8 @@ uint8_t st7789(uint8_t argc, char** argv)
         st7789_interface_debug_print("  st7789 (-h | --help)\n");
         st7789_interface_debug_print("  st7789 (-p | --port)\n");
         st7789_interface_debug_print("  st7789 (-t display | --test=display)\n");
+        st7789_interface_debug_print("  st7789 (-t async | --test=async)\n");
+        st7789_interface_debug_print("  st7789 (-t benchmark | --test=benchmark)\n");
         st7789_interface_debug_print("  st7789 (-e basic-init | --example=basic-init)\n");
         st7789_interface_debug_print("  st7789 (-e basic-deinit | --example=basic-deinit)\n");
         st7789_interface_debug_print("  st7789 (-e basic-str | --example=basic-str) [--str=<string>]\n");
@@ -468,7 +496,7 @@ uint8_t st7789(uint8_t argc, char** argv)
         st7789_interface_debug_print("  -i, --information       Show the chip information.\n");
         st7789_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         st7789_interface_debug_print("      --str=<string>      Set the display string.([default: libdriver])\n");
-        st7789_interface_debug_print("  -t <display>, --test=<display>\n");
+        st7789_interface_debug_print("  -t <display | async | benchmark>, --test=<display | async | benchmark>\n");
         st7789_interface_debug_print("                          Run the driver test.\n");
         st7789_interface_debug_print("      --x0=<x0>           Set the x0 and it is the x of the point.\n");
         st7789_interface_debug_print("      --x1=<x1>           Set the x1 and it is the top left x of the rect.\n");
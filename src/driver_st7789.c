@@ -37,6 +37,21 @@
 #include "driver_st7789.h"
 #include "driver_st7789_font.h"
 
+/**
+ * @brief simd kernel selection
+ */
+#if (ST7789_USE_SIMD != 0) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+    #include <arm_neon.h>
+    #define ST7789_SIMD_NEON        /**< neon kernels */
+#elif (ST7789_USE_SIMD != 0) && defined(__SSE2__)
+    #include <emmintrin.h>
+    #define ST7789_SIMD_SSE2        /**< sse2 kernels */
+    #if defined(__SSSE3__)
+        #include <tmmintrin.h>
+        #define ST7789_SIMD_SSSE3        /**< ssse3 kernels */
+    #endif
+#endif
+
 /**
  * @brief chip information definition
  */
@@ -55,6 +70,52 @@
 #define ST7789_CMD         0        /**< command type */
 #define ST7789_DATA        1        /**< data type */
 
+/**
+ * @brief frame memory definition
+ */
+#define ST7789_MEMORY_ROW        320        /**< frame memory rows */
+
+/**
+ * @brief power on pixel format definition
+ */
+#define ST7789_COLMOD_DEFAULT    0x66       /**< 18 bits interface pixel format */
+
+/**
+ * @brief address window valid flag definition
+ */
+#define ST7789_WINDOW_COLUMN         (1 << 0)        /**< column address is known */
+#define ST7789_WINDOW_ROW            (1 << 1)        /**< row address is known */
+#define ST7789_WINDOW_POINTER        (1 << 2)        /**< memory write pointer is known */
+
+/**
+ * @brief panel wait state definition
+ */
+#define ST7789_WAIT_NONE              0        /**< the panel is ready */
+#define ST7789_WAIT_RESET_LOW         1        /**< the reset pin is held low */
+#define ST7789_WAIT_RESET_HIGH        2        /**< the panel comes out of the reset */
+#define ST7789_WAIT_SLEEP             3        /**< the panel enters or leaves the sleep mode */
+
+/**
+ * @brief panel timing definition
+ */
+#define ST7789_RESET_LOW_MS           25         /**< reset pulse, over 10 us */
+#define ST7789_RESET_HIGH_MS          125        /**< reset recovery, over 120 ms */
+#define ST7789_SLEEP_IN_MS            5          /**< sleep in to the next command, over 5 ms */
+#define ST7789_SLEEP_OUT_MS           200        /**< sleep out to the next command */
+
+/**
+ * @brief transfer buffer min size definition
+ */
+#define ST7789_BUFFER_SIZE_MIN        16        /**< two halves of whole points */
+#if (ST7789_BUFFER_SIZE != 0) && (ST7789_BUFFER_SIZE < ST7789_BUFFER_SIZE_MIN)
+    #error "ST7789_BUFFER_SIZE is too small."
+#endif
+
+/**
+ * @brief script command batch definition
+ */
+#define ST7789_SCRIPT_BATCH        16        /**< commands without params sent in one transfer */
+
 /**
  * @brief chip command definition
  */
@@ -123,6 +184,337 @@
 #define ST7789_CMD_NVMSET          0xFC        /**< nvm setting command */
 #define ST7789_CMD_PROMACT         0xFE        /**< program action command */
 
+/**
+ * @brief register shadow structure definition
+ */
+typedef struct st7789_shadow_s
+{
+    uint8_t cmd;           /**< register command */
+    uint8_t len;           /**< register length */
+    uint8_t offset;        /**< shadow offset */
+} st7789_shadow_t;
+
+/**
+ * @brief pixel format kernel structure definition
+ */
+typedef struct st7789_kernel_s
+{
+    uint8_t point_size;                                                                     /**< framebuffer point size */
+    uint8_t unit_points;                                                                    /**< points in a transfer unit */
+    uint8_t unit_size;                                                                      /**< transfer unit size */
+    uint8_t shift[3];                                                                       /**< red, green and blue shift of a color */
+    uint8_t mask[3];                                                                        /**< red, green and blue mask of a color */
+    uint32_t (*fill)(uint8_t *buf, uint32_t points, uint32_t color);                        /**< fill points with a color */
+    void (*put)(uint8_t *p, uint32_t color);                                                /**< put a framebuffer point */
+    uint32_t (*get)(const uint8_t *p);                                                      /**< get a packed framebuffer point */
+    uint32_t (*unpack)(const uint8_t *data, uint32_t i);                                    /**< get a point from packed transfer bytes */
+    uint8_t (*push)(st7789_handle_t *handle, uint32_t color, uint32_t *index, uint8_t *odd); /**< push a point to the inner buffer */
+    void (*convert16)(const uint16_t *src, uint8_t *dst, uint32_t n);                       /**< convert 12bits or 16bits points */
+    void (*convert32)(const uint32_t *src, uint8_t *dst, uint32_t n);                       /**< convert 18bits points */
+} st7789_kernel_t;
+
+/**
+ * @brief arc sector structure definition
+ */
+typedef struct st7789_arc_s
+{
+    int32_t sx;          /**< start direction x */
+    int32_t sy;          /**< start direction y */
+    int32_t ex;          /**< end direction x */
+    int32_t ey;          /**< end direction y */
+    uint8_t type;        /**< 0 up to half circle, 1 over half circle, 2 full circle */
+} st7789_arc_t;
+
+/**
+ * @brief polygon edge structure definition
+ */
+typedef struct st7789_edge_s
+{
+    int16_t top;             /**< first row */
+    int16_t bottom;          /**< last row */
+    int16_t x;               /**< rounded x of the current row */
+    int16_t rem;             /**< remainder of x */
+    int16_t step;            /**< x step per row */
+    int16_t rem_step;        /**< remainder step per row */
+    int16_t den;             /**< remainder range */
+} st7789_edge_t;
+
+/**
+ * @brief shadowed write-only registers
+ */
+static const st7789_shadow_t gsc_st7789_shadow[ST7789_SHADOW_NUM] =
+{
+    {ST7789_CMD_GAMSET, 1, 0},
+    {ST7789_CMD_PTLAR, 4, 1},
+    {ST7789_CMD_VSCRDEF, 6, 5},
+    {ST7789_CMD_MADCTL, 1, 11},
+    {ST7789_CMD_VSCRSADD, 2, 12},
+    {ST7789_CMD_COLMOD, 1, 14},
+    {ST7789_CMD_TESCAN, 2, 15},
+    {ST7789_CMD_WRDISBV, 1, 17},
+    {ST7789_CMD_WRCTRLD, 1, 18},
+    {ST7789_CMD_WRCACE, 1, 19},
+    {ST7789_CMD_WRCABCMB, 1, 20},
+    {ST7789_CMD_RAMCTRL, 2, 21},
+    {ST7789_CMD_RGBCTRL, 3, 23},
+    {ST7789_CMD_PORCTRL, 5, 26},
+    {ST7789_CMD_FRCTRL1, 3, 31},
+    {ST7789_CMD_PARCTRL, 1, 34},
+    {ST7789_CMD_GCTRL, 1, 35},
+    {ST7789_CMD_GTADJ, 4, 36},
+    {ST7789_CMD_DGMEN, 1, 40},
+    {ST7789_CMD_VCOMS, 1, 41},
+    {ST7789_CMD_LCMCTRL, 1, 42},
+    {ST7789_CMD_IDSET, 3, 43},
+    {ST7789_CMD_VDVVRHEN, 2, 46},
+    {ST7789_CMD_VRHS, 1, 48},
+    {ST7789_CMD_VDVSET, 1, 49},
+    {ST7789_CMD_VCMOFSET, 1, 50},
+    {ST7789_CMD_FRCTR2, 1, 51},
+    {ST7789_CMD_CABCCTRL, 1, 52},
+    {ST7789_CMD_PWMFRSEL, 1, 53},
+    {ST7789_CMD_PWCTRL1, 2, 54},
+    {ST7789_CMD_VAPVANEN, 1, 56},
+    {ST7789_CMD_PVGAMCTRL, 14, 57},
+    {ST7789_CMD_NVGAMCTRL, 14, 71},
+    {ST7789_CMD_DGMLUTR, 64, 85},
+    {ST7789_CMD_DGMLUTB, 64, 149},
+    {ST7789_CMD_GATECTRL, 3, 213},
+    {ST7789_CMD_SPI2EN, 1, 216},
+    {ST7789_CMD_PWCTRL2, 1, 217},
+    {ST7789_CMD_EQCTRL, 3, 218}
+};
+
+/**
+ * @brief sine of 0 - 90 degrees in 1/16384 units
+ */
+static const int16_t gsc_st7789_sin[91] =
+{
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+/**
+ * @brief natural order index of the jpeg zigzag order
+ */
+static const uint8_t gsc_st7789_jpeg_zigzag[64] =
+{
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/**
+ * @brief power-on and reset register defaults in the script format
+ */
+static const uint8_t gsc_st7789_reset_default[] =
+{
+    ST7789_CMD_SLPIN, 0,
+    ST7789_CMD_NORON, 0,
+    ST7789_CMD_INVOFF, 0,
+    ST7789_CMD_GAMSET, 1, 0x01,
+    ST7789_CMD_DISPOFF, 0,
+    ST7789_CMD_PTLAR, 4, 0x00, 0x00, 0x01, 0x3F,
+    ST7789_CMD_VSCRDEF, 6, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
+    ST7789_CMD_TEOFF, 0,
+    ST7789_CMD_MADCTL, 1, 0x00,
+    ST7789_CMD_VSCRSADD, 2, 0x00, 0x00,
+    ST7789_CMD_IDMOFF, 0,
+    ST7789_CMD_COLMOD, 1, 0x66,
+    ST7789_CMD_TESCAN, 2, 0x00, 0x00,
+    ST7789_CMD_WRDISBV, 1, 0x00,
+    ST7789_CMD_WRCTRLD, 1, 0x00,
+    ST7789_CMD_WRCACE, 1, 0x00,
+    ST7789_CMD_WRCABCMB, 1, 0x00,
+    ST7789_CMD_RAMCTRL, 2, 0x00, 0xF0,
+    ST7789_CMD_RGBCTRL, 3, 0x40, 0x02, 0x14,
+    ST7789_CMD_PORCTRL, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+    ST7789_CMD_FRCTRL1, 3, 0x00, 0x0F, 0x0F,
+    ST7789_CMD_PARCTRL, 1, 0x00,
+    ST7789_CMD_GCTRL, 1, 0x35,
+    ST7789_CMD_DGMEN, 1, 0x00,
+    ST7789_CMD_VCOMS, 1, 0x20,
+    ST7789_CMD_LCMCTRL, 1, 0x2C,
+    ST7789_CMD_VDVVRHEN, 2, 0x01, 0xFF,
+    ST7789_CMD_VRHS, 1, 0x0B,
+    ST7789_CMD_VDVSET, 1, 0x20,
+    ST7789_CMD_VCMOFSET, 1, 0x20,
+    ST7789_CMD_FRCTR2, 1, 0x0F,
+    ST7789_CMD_CABCCTRL, 1, 0x00,
+    ST7789_CMD_PWMFRSEL, 1, 0x08,
+    ST7789_CMD_PWCTRL1, 2, 0xA4, 0xA1,
+    ST7789_CMD_PVGAMCTRL, 14, 0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32,
+                              0x44, 0x42, 0x06, 0x0E, 0x12, 0x14, 0x17,
+    ST7789_CMD_NVGAMCTRL, 14, 0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31,
+                              0x54, 0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E,
+    ST7789_CMD_GATECTRL, 3, 0x27, 0x00, 0x10,
+    ST7789_CMD_SPI2EN, 1, 0x00,
+    ST7789_CMD_PWCTRL2, 1, 0x93,
+    ST7789_CMD_EQCTRL, 3, 0x11, 0x11, 0x08,
+};
+
+/**
+ * @brief     wait for the async write in flight
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 async write failed
+ * @note      st7789_async_complete ends the wait, spi_write_cmd_busy is polled when it is linked
+ */
+static uint8_t a_st7789_wait(st7789_handle_t *handle)
+{
+    uint8_t res;
+
+    res = 0;                                                        /* init 0 */
+    while (handle->async_busy != 0)                                 /* wait for the completion */
+    {
+        if (handle->spi_write_cmd_busy != NULL)                     /* polling fallback */
+        {
+            res = handle->spi_write_cmd_busy();                     /* get status */
+            if (res != 1)                                           /* check idle */
+            {
+                break;                                              /* break */
+            }
+            res = 0;                                                /* still busy */
+        }
+    }
+    handle->async_busy = 0;                                         /* clear busy */
+    if ((res != 0) || (handle->async_res != 0))                     /* check result */
+    {
+        handle->debug_print("st7789: async write failed.\n");       /* async write failed */
+        handle->async_res = 0;                                      /* clear result */
+        handle->window_valid = 0;                                   /* the address window is unknown */
+
+        return 1;                                                   /* return error */
+    }
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     start a panel wait
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] state wait state
+ * @param[in] ms wait time in ms
+ * @note      none
+ */
+static void a_st7789_panel_start(st7789_handle_t *handle, uint8_t state, uint32_t ms)
+{
+    handle->wait_state = state;                                                     /* set state */
+    handle->wait_ms = ms;                                                           /* set wait time */
+    handle->wait_start = 0;                                                         /* no clock */
+    if (handle->get_time_ms != NULL)                                                /* check the clock */
+    {
+        handle->wait_start = handle->get_time_ms();                                 /* save start time */
+    }
+}
+
+/**
+ * @brief     finish the current panel wait
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset gpio write failed
+ * @note      the reset low wait goes on with the reset recovery wait
+ */
+static uint8_t a_st7789_panel_step(st7789_handle_t *handle)
+{
+    if (handle->wait_state == ST7789_WAIT_RESET_LOW)                                /* reset pulse done */
+    {
+        if (handle->reset_gpio_write(1) != 0)                                       /* write 1 */
+        {
+            handle->debug_print("st7789: reset gpio write failed.\n");              /* reset gpio write failed */
+
+            return 1;                                                               /* return error */
+        }
+        a_st7789_panel_start(handle, ST7789_WAIT_RESET_HIGH,
+                             ST7789_RESET_HIGH_MS);                                 /* wait for the reset recovery */
+    }
+    else
+    {
+        handle->wait_state = ST7789_WAIT_NONE;                                      /* the panel is ready */
+    }
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     finish the panel waits whose time is over
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 poll failed
+ * @note      without get_time_ms the waits are never over
+ */
+static uint8_t a_st7789_panel_poll(st7789_handle_t *handle)
+{
+    while ((handle->wait_state != ST7789_WAIT_NONE) && (handle->get_time_ms != NULL) &&
+           ((handle->get_time_ms() - handle->wait_start) >= handle->wait_ms))      /* the wait is over */
+    {
+        if (a_st7789_panel_step(handle) != 0)                                       /* next step */
+        {
+            return 1;                                                               /* return error */
+        }
+    }
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     block until the panel is ready
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      only the remaining time of each wait is delayed
+ */
+static uint8_t a_st7789_panel_wait(st7789_handle_t *handle)
+{
+    uint32_t elapsed;
+
+    while (handle->wait_state != ST7789_WAIT_NONE)                                  /* wait all steps */
+    {
+        elapsed = (handle->get_time_ms != NULL) ?
+                  (handle->get_time_ms() - handle->wait_start) : 0;                 /* get elapsed time */
+        if (elapsed < handle->wait_ms)                                              /* not over */
+        {
+            handle->delay_ms(handle->wait_ms - elapsed);                            /* delay the remaining time */
+        }
+        if (a_st7789_panel_step(handle) != 0)                                       /* next step */
+        {
+            return 1;                                                               /* return error */
+        }
+    }
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     check the panel is busy
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    1 if the panel is still waiting, 0 if it is ready
+ * @note      none
+ */
+static uint8_t a_st7789_panel_busy(st7789_handle_t *handle)
+{
+    if (handle->wait_state == ST7789_WAIT_NONE)                                     /* ready */
+    {
+        return 0;                                                                   /* ready */
+    }
+    (void)a_st7789_panel_poll(handle);                                              /* go on */
+
+    return (handle->wait_state != ST7789_WAIT_NONE) ? 1 : 0;                        /* return the state */
+}
+
 /**
  * @brief     write one byte
  * @param[in] *handle pointer to an st7789 handle structure
@@ -137,14 +529,29 @@ static uint8_t a_st7789_write_byte(st7789_handle_t *handle, uint8_t data, uint8_
 {
     uint8_t res;
 
+    if (handle->wait_state != ST7789_WAIT_NONE)    /* the panel is waiting */
+    {
+        res = a_st7789_panel_wait(handle);         /* wait for the panel */
+        if (res != 0)                              /* check result */
+        {
+            return 1;                              /* return error */
+        }
+    }
+    res = a_st7789_wait(handle);                   /* wait for the async write */
+    if (res != 0)                                  /* check result */
+    {
+        return 1;                                  /* return error */
+    }
     res = handle->cmd_data_gpio_write(cmd);        /* write gpio */
     if (res != 0)                                  /* check result */
     {
+        handle->window_valid = 0;                  /* the address window is unknown */
         return 1;                                  /* return error */
     }
     res = handle->spi_write_cmd(&data, 1);         /* write data command */
     if (res != 0)                                  /* check result */
     {
+        handle->window_valid = 0;                  /* the address window is unknown */
         return 1;                                  /* return error */
     }
 
@@ -162,18 +569,33 @@ static uint8_t a_st7789_write_byte(st7789_handle_t *handle, uint8_t data, uint8_
  *            - 1 write failed
  * @note      none
  */
-static uint8_t a_st7789_write_bytes(st7789_handle_t *handle, uint8_t *data, uint16_t len, uint8_t cmd)
+static uint8_t a_st7789_write_bytes(st7789_handle_t *handle, uint8_t *data, uint32_t len, uint8_t cmd)
 {
     uint8_t res;
 
+    if (handle->wait_state != ST7789_WAIT_NONE)     /* the panel is waiting */
+    {
+        res = a_st7789_panel_wait(handle);          /* wait for the panel */
+        if (res != 0)                               /* check result */
+        {
+            return 1;                               /* return error */
+        }
+    }
+    res = a_st7789_wait(handle);                    /* wait for the async write */
+    if (res != 0)                                   /* check result */
+    {
+        return 1;                                   /* return error */
+    }
     res = handle->cmd_data_gpio_write(cmd);         /* write gpio */
     if (res != 0)                                   /* check result */
     {
+        handle->window_valid = 0;                   /* the address window is unknown */
         return 1;                                   /* return error */
     }
     res = handle->spi_write_cmd(data, len);         /* write data command */
     if (res != 0)                                   /* check result */
     {
+        handle->window_valid = 0;                   /* the address window is unknown */
         return 1;                                   /* return error */
     }
 
@@ -181,773 +603,1260 @@ static uint8_t a_st7789_write_bytes(st7789_handle_t *handle, uint8_t *data, uint
 }
 
 /**
- * @brief     nop
- * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 nop failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ * @brief     find a shadowed register
+ * @param[in] cmd register command
+ * @return    shadow index, ST7789_SHADOW_NUM if the register is not shadowed
  * @note      none
  */
-uint8_t st7789_nop(st7789_handle_t *handle)
+static uint8_t a_st7789_shadow_find(uint8_t cmd)
 {
-    if (handle == NULL)                                                      /* check handle */
-    {
-        return 2;                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                 /* check handle initialization */
-    {
-        return 3;                                                            /* return error */
-    }
+    uint8_t i;
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_NOP, ST7789_CMD) != 0)        /* write nop command */
+    for (i = 0; i < ST7789_SHADOW_NUM; i++)                                        /* find the register */
     {
-        handle->debug_print("st7789: write command failed.\n");              /* write command failed */
-
-        return 1;                                                            /* return error */
+        if (gsc_st7789_shadow[i].cmd == cmd)                                       /* found */
+        {
+            break;                                                                 /* break */
+        }
     }
 
-    return 0;                                                                /* success return 0 */
+    return i;                                                                      /* return the index */
 }
 
 /**
- * @brief     software reset
+ * @brief     write a register through the shadow
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] cmd register command
+ * @param[in] *param pointer to a param buffer
+ * @param[in] len param length
  * @return    status code
  *            - 0 success
- *            - 1 software reset failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 write register failed
+ * @note      the bus write is skipped when the shadow already holds the same params
  */
-uint8_t st7789_software_reset(st7789_handle_t *handle)
+static uint8_t a_st7789_write_register(st7789_handle_t *handle, uint8_t cmd, uint8_t *param, uint8_t len)
 {
-    if (handle == NULL)                                                          /* check handle */
+    uint8_t i;
+    uint8_t *shadow;
+
+    shadow = NULL;                                                                 /* not shadowed */
+    i = a_st7789_shadow_find(cmd);                                                 /* find the register */
+    if (i < ST7789_SHADOW_NUM)                                                     /* found */
     {
-        return 2;                                                                /* return error */
+        shadow = &handle->shadow[gsc_st7789_shadow[i].offset];                     /* get the shadow */
     }
-    if (handle->inited != 1)                                                     /* check handle initialization */
+    if ((shadow != NULL) && ((handle->shadow_valid[i / 8] & (1 << (i % 8))) != 0) &&
+        (memcmp(shadow, param, len) == 0))                                         /* the register holds the params */
     {
-        return 3;                                                                /* return error */
+        return 0;                                                                  /* success return 0 */
+    }
+    if (shadow != NULL)                                                            /* shadowed */
+    {
+        handle->shadow_valid[i / 8] &= ~(1 << (i % 8));                            /* unknown until written */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_SWRESET, ST7789_CMD) != 0)        /* write software reset command */
+    if (a_st7789_write_byte(handle, cmd, ST7789_CMD) != 0)                         /* write register command */
     {
-        handle->debug_print("st7789: write command failed.\n");                  /* write command failed */
+        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
 
-        return 1;                                                                /* return error */
+        return 1;                                                                  /* return error */
     }
-    handle->delay_ms(200);                                                       /* delay 200ms */
+    if (a_st7789_write_bytes(handle, param, len, ST7789_DATA) != 0)                /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
 
-    return 0;                                                                    /* success return 0 */
+        return 1;                                                                  /* return error */
+    }
+    if (shadow != NULL)                                                            /* shadowed */
+    {
+        memcpy(shadow, param, len);                                                /* save the params */
+        handle->shadow_valid[i / 8] |= (1 << (i % 8));                             /* the shadow is valid */
+    }
+    if (cmd == ST7789_CMD_MADCTL)                                                  /* the address order changes */
+    {
+        handle->window_valid = 0;                                                  /* the address window is unknown */
+    }
+
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     sleep in
+ * @brief     write a one byte register through the shadow
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] cmd register command
+ * @param[in] param register param
  * @return    status code
  *            - 0 success
- *            - 1 sleep in failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 write register failed
  * @note      none
  */
-uint8_t st7789_sleep_in(st7789_handle_t *handle)
+static uint8_t a_st7789_write_register_byte(st7789_handle_t *handle, uint8_t cmd, uint8_t param)
 {
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
-    {
-        return 3;                                                              /* return error */
-    }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_SLPIN, ST7789_CMD) != 0)        /* write sleep in command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
-    }
+    return a_st7789_write_register(handle, cmd, &param, 1);                        /* write register */
+}
 
-    return 0;                                                                  /* success return 0 */
+/**
+ * @brief     clear the register shadow and the address window cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @note      none
+ */
+static void a_st7789_invalidate(st7789_handle_t *handle)
+{
+    memset(handle->shadow_valid, 0, sizeof(handle->shadow_valid));                 /* no register is known */
+    handle->window_valid = 0;                                                      /* the address window is unknown */
 }
 
 /**
- * @brief     sleep out
+ * @brief     send an address set command
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] cmd address set command
+ * @param[in] start start address
+ * @param[in] end end address
  * @return    status code
  *            - 0 success
- *            - 1 sleep out failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 write address failed
  * @note      none
  */
-uint8_t st7789_sleep_out(st7789_handle_t *handle)
+static uint8_t a_st7789_write_address(st7789_handle_t *handle, uint8_t cmd, uint16_t start, uint16_t end)
 {
-    if (handle == NULL)                                                         /* check handle */
+    uint8_t buf[4];
+
+    if (a_st7789_write_byte(handle, cmd, ST7789_CMD) != 0)                         /* write address command */
     {
-        return 2;                                                               /* return error */
+        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+
+        return 1;                                                                  /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
-    {
-        return 3;                                                               /* return error */
-    }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_SLPOUT, ST7789_CMD) != 0)        /* write sleep out command */
+    buf[0] = (start >> 8) & 0xFF;                                                  /* start address msb */
+    buf[1] = (start >> 0) & 0xFF;                                                  /* start address lsb */
+    buf[2] = (end >> 8) & 0xFF;                                                    /* end address msb */
+    buf[3] = (end >> 0) & 0xFF;                                                    /* end address lsb */
+    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                                  /* return error */
     }
-    handle->delay_ms(200);                                                      /* delay 200ms */
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     partial display mode on
+ * @brief     set the address window and start the memory write
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
  * @return    status code
  *            - 0 success
- *            - 1 partial display mode on failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 set window failed
+ * @note      the caller must write all points of the window
+ *            CASET and RASET are only sent when the address changes, the row end is kept at the last row and
+ *            a single point extends the column end to the last column, so that the following windows often
+ *            continue at the memory write pointer with RAMWRC and without any address command
  */
-uint8_t st7789_partial_display_mode_on(st7789_handle_t *handle)
+static uint8_t a_st7789_set_window(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
 {
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
+    uint8_t cmd;
+    uint16_t end;
+    uint32_t width;
+    uint32_t start;
+    uint32_t total;
+
+    cmd = ST7789_CMD_RAMWR;                                                        /* memory write */
+    start = 0;                                                                     /* window start */
+    if (((handle->window_valid & ST7789_WINDOW_POINTER) != 0) &&
+        (left >= handle->window_left) && (right <= handle->window_right) &&
+        (top >= handle->window_top) && (bottom <= handle->window_bottom) &&
+        ((top == bottom) ||
+        ((left == handle->window_left) && (right == handle->window_right))))       /* the points are sequential in the window */
+    {
+        width = handle->window_right - handle->window_left + 1;                    /* window width */
+        start = (uint32_t)(top - handle->window_top) * width +
+                (left - handle->window_left);                                      /* first point in the window */
+        if (start == handle->window_pointer)                                       /* continue at the pointer */
+        {
+            cmd = ST7789_CMD_RAMWRC;                                               /* memory write continue */
+        }
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (cmd == ST7789_CMD_RAMWR)                                                   /* restart the memory write */
     {
-        return 3;                                                              /* return error */
+        start = 0;                                                                 /* window start */
+        if (((handle->window_valid & ST7789_WINDOW_COLUMN) == 0) || (handle->window_left != left) ||
+            ((handle->window_right != right) &&
+            ((top != bottom) || (handle->window_right < right))))                  /* column address changes */
+        {
+            end = right;                                                           /* set end */
+            if ((left == right) && (top == bottom) && (handle->column > (right + 1)))  /* a single point */
+            {
+                end = handle->column - 1;                                          /* extend to the last column */
+            }
+            if (a_st7789_write_address(handle, ST7789_CMD_CASET, left, end) != 0)  /* set column address */
+            {
+                return 1;                                                          /* return error */
+            }
+            handle->window_left = left;                                            /* save left */
+            handle->window_right = end;                                            /* save right */
+            handle->window_valid |= ST7789_WINDOW_COLUMN;                          /* column is known */
+        }
+        if (((handle->window_valid & ST7789_WINDOW_ROW) == 0) || (handle->window_top != top) ||
+            (handle->window_bottom < bottom))                                      /* row address changes */
+        {
+            end = (handle->row > (bottom + 1)) ? (handle->row - 1) : bottom;       /* extend to the last row */
+            if (a_st7789_write_address(handle, ST7789_CMD_RASET, top, end) != 0)   /* set row address */
+            {
+                return 1;                                                          /* return error */
+            }
+            handle->window_top = top;                                              /* save top */
+            handle->window_bottom = end;                                           /* save bottom */
+            handle->window_valid |= ST7789_WINDOW_ROW;                             /* row is known */
+        }
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_PTLON, ST7789_CMD) != 0)        /* write partial display mode on command */
+    if (a_st7789_write_byte(handle, cmd, ST7789_CMD) != 0)                         /* write memory write command */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
 
-        return 1;                                                              /* return error */
+        return 1;                                                                  /* return error */
+    }
+    width = handle->window_right - handle->window_left + 1;                        /* window width */
+    total = width * (handle->window_bottom - handle->window_top + 1);              /* window points */
+    start += (uint32_t)(right - left + 1) * (bottom - top + 1);                    /* the pointer after the points */
+    if (start < total)                                                             /* the pointer stays in the window */
+    {
+        handle->window_pointer = start;                                            /* save the pointer */
+        handle->window_valid |= ST7789_WINDOW_POINTER;                             /* pointer is known */
+    }
+    else
+    {
+        handle->window_valid &= ~ST7789_WINDOW_POINTER;                            /* the pointer wraps */
     }
 
-    return 0;                                                                  /* success return 0 */
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     normal display mode on
- * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 normal display mode on failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get the inner buffer to fill
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[out] *size pointer to a buffer size
+ * @return     pointer to the inner buffer
+ * @note       with the async write the inner buffer is split into two halves,
+ *             one is filled while the other one is being sent
  */
-uint8_t st7789_normal_display_mode_on(st7789_handle_t *handle)
+static uint8_t *a_st7789_get_buffer(st7789_handle_t *handle, uint32_t *size)
 {
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
-    {
-        return 3;                                                              /* return error */
-    }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_NORON, ST7789_CMD) != 0)        /* write normal display mode on command */
+    if (handle->spi_write_cmd_async != NULL)                                    /* async mode */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+        *size = handle->buf_size / 2;                                           /* half size */
 
-        return 1;                                                              /* return error */
+        return &handle->buf[handle->buf_half * (handle->buf_size / 2)];         /* return the half */
     }
+    *size = handle->buf_size;                                                   /* full size */
 
-    return 0;                                                                  /* success return 0 */
+    return handle->buf;                                                         /* return the buffer */
 }
 
 /**
- * @brief     display inversion off
+ * @brief     send the filled inner buffer
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *buf pointer to the buffer got by a_st7789_get_buffer
+ * @param[in] len buffer length
  * @return    status code
  *            - 0 success
- *            - 1 display inversion off failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 send failed
+ * @note      the async write is left in flight and the other half is used next
  */
-uint8_t st7789_display_inversion_off(st7789_handle_t *handle)
+static uint8_t a_st7789_send_buffer(st7789_handle_t *handle, uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                                         /* check handle */
+    if (handle->spi_write_cmd_async == NULL)                                    /* blocking mode */
     {
-        return 2;                                                               /* return error */
+        if (a_st7789_write_bytes(handle, buf, len, ST7789_DATA) != 0)           /* write data */
+        {
+            handle->debug_print("st7789: write data failed.\n");                /* write data failed */
+
+            return 1;                                                           /* return error */
+        }
+
+        return 0;                                                               /* success return 0 */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+
+    if (a_st7789_wait(handle) != 0)                                             /* wait for the last half */
     {
-        return 3;                                                               /* return error */
+        return 1;                                                               /* return error */
     }
+    if (handle->cmd_data_gpio_write(ST7789_DATA) != 0)                          /* write gpio */
+    {
+        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->window_valid = 0;                                               /* the address window is unknown */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_INVOFF, ST7789_CMD) != 0)        /* write display inversion off command */
+        return 1;                                                               /* return error */
+    }
+    handle->async_res = 0;                                                      /* clear result */
+    handle->async_busy = 1;                                                     /* set busy before the completion can come */
+    if (handle->spi_write_cmd_async(buf, len) != 0)                             /* start the async write */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->async_busy = 0;                                                 /* not started */
+        handle->window_valid = 0;                                               /* the address window is unknown */
 
         return 1;                                                               /* return error */
     }
+    handle->buf_half ^= 1;                                                      /* switch the half */
 
     return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     display inversion on
- * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 display inversion on failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert rgb565 points to the spi byte order
+ * @param[in]  *src pointer to the source points
+ * @param[out] *dst pointer to the destination bytes
+ * @param[in]  n number of points
+ * @note       writes n * 2 bytes
  */
-uint8_t st7789_display_inversion_on(st7789_handle_t *handle)
+static void a_st7789_convert_565(const uint16_t *src, uint8_t *dst, uint32_t n)
 {
-    if (handle == NULL)                                                        /* check handle */
+    uint32_t i;
+
+    i = 0;                                                                                 /* init 0 */
+#if defined(ST7789_SIMD_NEON)
+    for (; (i + 8) <= n; i += 8)                                                           /* 8 points */
     {
-        return 2;                                                              /* return error */
+        vst1q_u8(&dst[i * 2], vrev16q_u8(vld1q_u8((const uint8_t *)&src[i])));             /* swap the bytes */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+#elif defined(ST7789_SIMD_SSE2)
+    for (; (i + 8) <= n; i += 8)                                                           /* 8 points */
     {
-        return 3;                                                              /* return error */
-    }
+        __m128i v;
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_INVON, ST7789_CMD) != 0)        /* write display inversion on command */
+        v = _mm_loadu_si128((const __m128i *)&src[i]);                                     /* load 8 points */
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));                      /* swap the bytes */
+        _mm_storeu_si128((__m128i *)&dst[i * 2], v);                                       /* store 16 bytes */
+    }
+#endif
+    for (; i < n; i++)                                                                     /* the left points */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        dst[i * 2 + 0] = (src[i] >> 8) & 0xFF;                                             /* set the color */
+        dst[i * 2 + 1] = (src[i] >> 0) & 0xFF;                                             /* set the color */
     }
-
-    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set gamma
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] gamma set gamma
- * @return    status code
- *            - 0 success
- *            - 1 set gamma failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert rgb444 points to the spi byte order
+ * @param[in]  *src pointer to the source points
+ * @param[out] *dst pointer to the destination bytes
+ * @param[in]  n number of points
+ * @note       two points are packed in 3 bytes, writes (n * 3 + 1) / 2 bytes
  */
-uint8_t st7789_set_gamma(st7789_handle_t *handle, uint8_t gamma)
+static void a_st7789_convert_444(const uint16_t *src, uint8_t *dst, uint32_t n)
 {
-    if (handle == NULL)                                                        /* check handle */
+    uint32_t i;
+    uint32_t j;
+
+    i = 0;                                                                                 /* init 0 */
+    j = 0;                                                                                 /* init 0 */
+#if defined(ST7789_SIMD_NEON)
+    for (; (i + 16) <= n; i += 16)                                                         /* 16 points */
     {
-        return 2;                                                              /* return error */
+        uint16x8x2_t v;
+        uint8x8x3_t o;
+
+        v = vld2q_u16(&src[i]);                                                            /* split even and odd points */
+        o.val[0] = vmovn_u16(vshrq_n_u16(v.val[0], 4));                                    /* r0 g0 */
+        o.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(v.val[0], 4),
+                             vandq_u16(vshrq_n_u16(v.val[1], 8), vdupq_n_u16(0x0F))));     /* b0 r1 */
+        o.val[2] = vmovn_u16(v.val[1]);                                                    /* g1 b1 */
+        vst3_u8(&dst[j], o);                                                               /* store 24 bytes */
+        j += 24;                                                                           /* 16 points 24 bytes */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+#elif defined(ST7789_SIMD_SSSE3)
+    for (; (i + 12) <= n; i += 8)                                                          /* 8 points */
     {
-        return 3;                                                              /* return error */
-    }
+        __m128i v;
+        __m128i o;
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_GAMSET, ST7789_CMD) != 0)       /* write set gamma command */
+        v = _mm_loadu_si128((const __m128i *)&src[i]);                                     /* load 4 point pairs */
+        o = _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi32(0xFF));                     /* r0 g0 */
+        o = _mm_or_si128(o, _mm_and_si128(_mm_slli_epi32(v, 12), _mm_set1_epi32(0xF000))); /* b0 */
+        o = _mm_or_si128(o, _mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0x0F00))); /* r1 */
+        o = _mm_or_si128(o, _mm_and_si128(v, _mm_set1_epi32(0xFF0000)));                   /* g1 b1 */
+        o = _mm_shuffle_epi8(o, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+                                              -1, -1, -1, -1));                            /* pack 12 bytes */
+        _mm_storeu_si128((__m128i *)&dst[j], o);                                           /* the last 4 bytes are overwritten later */
+        j += 12;                                                                           /* 8 points 12 bytes */
+    }
+#endif
+    for (; (i + 2) <= n; i += 2)                                                           /* the left point pairs */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        dst[j + 0] = (src[i] >> 4) & 0xFF;                                                 /* set the color */
+        dst[j + 1] = ((src[i] & 0x0F) << 4) | ((src[i + 1] >> 8) & 0x0F);                  /* set the color */
+        dst[j + 2] = (src[i + 1] >> 0) & 0xFF;                                             /* set the color */
+        j += 3;                                                                            /* 2 points 3 bytes */
     }
-    if (a_st7789_write_byte(handle, gamma & 0x0F, ST7789_DATA) != 0)           /* write gamma data */
+    if (i < n)                                                                             /* the odd point */
     {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
-
-        return 1;                                                              /* return error */
+        dst[j + 0] = (src[i] >> 4) & 0xFF;                                                 /* set the color */
+        dst[j + 1] = (src[i] & 0x0F) << 4;                                                 /* set the color */
     }
-
-    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     display off
- * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 display off failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert rgb666 points to the spi byte order
+ * @param[in]  *src pointer to the source points
+ * @param[out] *dst pointer to the destination bytes
+ * @param[in]  n number of points
+ * @note       writes n * 3 bytes
  */
-uint8_t st7789_display_off(st7789_handle_t *handle)
+static void a_st7789_convert_666(const uint32_t *src, uint8_t *dst, uint32_t n)
 {
-    if (handle == NULL)                                                          /* check handle */
-    {
-        return 2;                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                     /* check handle initialization */
-    {
-        return 3;                                                                /* return error */
-    }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_DISPOFF, ST7789_CMD) != 0)        /* write display off command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                  /* write command failed */
+    uint32_t i;
 
-        return 1;                                                                /* return error */
+    i = 0;                                                                                 /* init 0 */
+#if defined(ST7789_SIMD_NEON)
+    for (; (i + 8) <= n; i += 8)                                                           /* 8 points */
+    {
+        uint32x4_t a;
+        uint32x4_t b;
+        uint32x4_t m;
+        uint8x8x3_t o;
+
+        a = vld1q_u32(&src[i]);                                                            /* load 4 points */
+        b = vld1q_u32(&src[i + 4]);                                                        /* load 4 points */
+        m = vdupq_n_u32(0xFC);                                                             /* 6 bits mask */
+        o.val[0] = vmovn_u16(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(a, 10), m)),
+                                          vmovn_u32(vandq_u32(vshrq_n_u32(b, 10), m))));   /* red */
+        o.val[1] = vmovn_u16(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(a, 4), m)),
+                                          vmovn_u32(vandq_u32(vshrq_n_u32(b, 4), m))));    /* green */
+        o.val[2] = vmovn_u16(vcombine_u16(vmovn_u32(vandq_u32(vshlq_n_u32(a, 2), m)),
+                                          vmovn_u32(vandq_u32(vshlq_n_u32(b, 2), m))));    /* blue */
+        vst3_u8(&dst[i * 3], o);                                                           /* store 24 bytes */
+    }
+#elif defined(ST7789_SIMD_SSSE3)
+    for (; (i + 6) <= n; i += 4)                                                           /* 4 points */
+    {
+        __m128i v;
+        __m128i o;
+
+        v = _mm_loadu_si128((const __m128i *)&src[i]);                                     /* load 4 points */
+        o = _mm_and_si128(_mm_srli_epi32(v, 10), _mm_set1_epi32(0xFC));                    /* red */
+        o = _mm_or_si128(o, _mm_and_si128(_mm_slli_epi32(v, 4), _mm_set1_epi32(0xFC00)));  /* green */
+        o = _mm_or_si128(o, _mm_and_si128(_mm_slli_epi32(v, 18),
+                                          _mm_set1_epi32(0xFC0000)));                      /* blue */
+        o = _mm_shuffle_epi8(o, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+                                              -1, -1, -1, -1));                            /* pack 12 bytes */
+        _mm_storeu_si128((__m128i *)&dst[i * 3], o);                                       /* the last 4 bytes are overwritten later */
+    }
+#endif
+    for (; i < n; i++)                                                                     /* the left points */
+    {
+        dst[i * 3 + 0] = ((src[i] >> 12) & 0x3F) << 2;                                     /* set the color */
+        dst[i * 3 + 1] = ((src[i] >> 6) & 0x3F) << 2;                                      /* set the color */
+        dst[i * 3 + 2] = ((src[i] >> 0) & 0x3F) << 2;                                      /* set the color */
     }
+}
 
-    return 0;                                                                    /* success return 0 */
+/**
+ * @brief      get the transfer length of points
+ * @param[in]  *kernel pointer to a pixel format kernel
+ * @param[in]  points number of points
+ * @return     transfer length in bytes
+ * @note       a half transfer unit is rounded up
+ */
+static uint32_t a_st7789_points_length(const st7789_kernel_t *kernel, uint32_t points)
+{
+    return (points * kernel->unit_size + kernel->unit_points - 1) / kernel->unit_points;  /* whole bytes */
 }
 
 /**
- * @brief     display on
- * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 display on failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      fill rgb444 points with a color
+ * @param[out] *buf pointer to a buffer
+ * @param[in]  points number of points
+ * @param[in]  color fill color
+ * @return     filled length in bytes
+ * @note       two points are packed in 3 bytes
  */
-uint8_t st7789_display_on(st7789_handle_t *handle)
+static uint32_t a_st7789_fill_444(uint8_t *buf, uint32_t points, uint32_t color)
 {
-    if (handle == NULL)                                                         /* check handle */
-    {
-        return 2;                                                               /* return error */
-    }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    uint32_t i;
+    uint32_t j;
+
+    j = 0;                                                                                 /* init 0 */
+    for (i = 0; (i + 2) <= points; i += 2)                                                 /* all point pairs */
     {
-        return 3;                                                               /* return error */
+        buf[j] = (((color >> 8) & 0xF) << 4) |
+                 (((color >> 4) & 0xF) << 0);                                              /* set the color */
+        buf[j + 1] = (((color >> 0) & 0xF) << 4) |
+                     (((color >> 8) & 0xF) << 0);                                          /* set the color */
+        buf[j + 2] = (((color >> 4) & 0xF) << 4) |
+                     (((color >> 0) & 0xF) << 0);                                          /* set the color */
+        j += 3;                                                                            /* 2 points 3 bytes */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_DISPON, ST7789_CMD) != 0)        /* write display on command */
+    if (i < points)                                                                        /* the odd point */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
-
-        return 1;                                                               /* return error */
+        buf[j] = (((color >> 8) & 0xF) << 4) |
+                 (((color >> 4) & 0xF) << 0);                                              /* set the color */
+        buf[j + 1] = (((color >> 0) & 0xF) << 4);                                          /* set the color */
+        j += 2;                                                                            /* 1 point 2 bytes */
     }
 
-    return 0;                                                                   /* success return 0 */
+    return j;                                                                              /* return the length */
 }
 
 /**
- * @brief     set the column address
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] start_address start address
- * @param[in] end_address end address
- * @return    status code
- *            - 0 success
- *            - 1 set column address failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 address is invalid
- *            - 5 start_address >= end_address
- * @note      start_address <= 319 && end_address <= 319 && start_address >= start_address
+ * @brief      fill rgb565 points with a color
+ * @param[out] *buf pointer to a buffer
+ * @param[in]  points number of points
+ * @param[in]  color fill color
+ * @return     filled length in bytes
+ * @note       none
  */
-uint8_t st7789_set_column_address(st7789_handle_t *handle, uint16_t start_address, uint16_t end_address)
+static uint32_t a_st7789_fill_565(uint8_t *buf, uint32_t points, uint32_t color)
 {
-    uint8_t buf[4];
+    uint32_t i;
 
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    for (i = 0; i < points; i++)                                                           /* all points */
     {
-        return 3;                                                              /* return error */
+        buf[i * 2 + 0] = (color >> 8) & 0xFF;                                              /* set the color */
+        buf[i * 2 + 1] = (color >> 0) & 0xFF;                                              /* set the color */
     }
-    if ((start_address > 319) || (end_address > 319))                          /* check range */
-    {
-        handle->debug_print("st7789: address is invalid.\n");                  /* address is invalid */
 
-        return 4;                                                              /* return error */
-    }
-    if (start_address >= end_address)                                          /* check range */
-    {
-        handle->debug_print("st7789: start_address >= end_address.\n");        /* start_address >= end_address */
+    return points * 2;                                                                     /* return the length */
+}
 
-        return 5;                                                              /* return error */
-    }
+/**
+ * @brief      fill rgb666 points with a color
+ * @param[out] *buf pointer to a buffer
+ * @param[in]  points number of points
+ * @param[in]  color fill color
+ * @return     filled length in bytes
+ * @note       none
+ */
+static uint32_t a_st7789_fill_666(uint8_t *buf, uint32_t points, uint32_t color)
+{
+    uint32_t i;
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)        /* write set column address command */
+    for (i = 0; i < points; i++)                                                           /* all points */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        buf[i * 3 + 0] = ((color >> 12) & 0x3F) << 2;                                      /* set the color */
+        buf[i * 3 + 1] = ((color >> 6) & 0x3F) << 2;                                       /* set the color */
+        buf[i * 3 + 2] = ((color >> 0) & 0x3F) << 2;                                       /* set the color */
     }
-    buf[0] = (start_address >> 8) & 0xFF;                                      /* start address msb */
-    buf[1] = (start_address >> 0) & 0xFF;                                      /* start address lsb */
-    buf[2] = (end_address >> 8) & 0xFF;                                        /* end address msb */
-    buf[3] = (end_address >> 0) & 0xFF;                                        /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
 
-        return 1;                                                              /* return error */
-    }
+    return points * 3;                                                                     /* return the length */
+}
 
-    return 0;                                                                  /* success return 0 */
+/**
+ * @brief      put an rgb444 point in the framebuffer
+ * @param[out] *p pointer to the point address
+ * @param[in]  color point color
+ * @note       the point is stored unpacked in 2 bytes
+ */
+static void a_st7789_put_444(uint8_t *p, uint32_t color)
+{
+    p[0] = (color >> 8) & 0x0F;                                                            /* set the color */
+    p[1] = (color >> 0) & 0xFF;                                                            /* set the color */
 }
 
 /**
- * @brief     set the row address
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] start_address start address
- * @param[in] end_address end address
- * @return    status code
- *            - 0 success
- *            - 1 set row address failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 address is invalid
- *            - 5 start_address >= end_address
- * @note      start_address <= 319 && end_address <= 319 && start_address >= start_address
+ * @brief      put an rgb565 point in the framebuffer
+ * @param[out] *p pointer to the point address
+ * @param[in]  color point color
+ * @note       none
  */
-uint8_t st7789_set_row_address(st7789_handle_t *handle, uint16_t start_address, uint16_t end_address)
+static void a_st7789_put_565(uint8_t *p, uint32_t color)
 {
-    uint8_t buf[4];
+    p[0] = (color >> 8) & 0xFF;                                                            /* set the color */
+    p[1] = (color >> 0) & 0xFF;                                                            /* set the color */
+}
 
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+/**
+ * @brief      put an rgb666 point in the framebuffer
+ * @param[out] *p pointer to the point address
+ * @param[in]  color point color
+ * @note       none
+ */
+static void a_st7789_put_666(uint8_t *p, uint32_t color)
+{
+    p[0] = ((color >> 12) & 0x3F) << 2;                                                    /* set the color */
+    p[1] = ((color >> 6) & 0x3F) << 2;                                                     /* set the color */
+    p[2] = ((color >> 0) & 0x3F) << 2;                                                     /* set the color */
+}
+
+/**
+ * @brief     get an rgb444 point from the framebuffer
+ * @param[in] *p pointer to the point address
+ * @return    point color
+ * @note      none
+ */
+static uint32_t a_st7789_get_444(const uint8_t *p)
+{
+    return ((uint32_t)(p[0] & 0x0F) << 8) | p[1];                                          /* get the color */
+}
+
+/**
+ * @brief     get an rgb444 point from packed transfer bytes
+ * @param[in] *data pointer to the transfer bytes
+ * @param[in] i point index
+ * @return    point color
+ * @note      none
+ */
+static uint32_t a_st7789_unpack_444(const uint8_t *data, uint32_t i)
+{
+    if ((i % 2) == 0)                                                                      /* the first of two points */
     {
-        return 3;                                                              /* return error */
+        return ((uint32_t)data[i / 2 * 3] << 4) | (data[i / 2 * 3 + 1] >> 4);              /* get the color */
     }
-    if ((start_address > 319) || (end_address > 319))                          /* check range */
+
+    return ((uint32_t)(data[i / 2 * 3 + 1] & 0x0F) << 8) | data[i / 2 * 3 + 2];            /* get the color */
+}
+
+/**
+ * @brief         push an rgb444 point to the inner buffer
+ * @param[in]     *handle pointer to an st7789 handle structure
+ * @param[in]     color pushed color
+ * @param[in,out] *index pointer to the inner buffer index
+ * @param[in,out] *odd pointer to the odd point flag
+ * @return        status code
+ *                - 0 success
+ *                - 1 push color failed
+ * @note          the buffer is only sent on whole points, so a point never spans two transfers
+ */
+static uint8_t a_st7789_push_444(st7789_handle_t *handle, uint32_t color, uint32_t *index, uint8_t *odd)
+{
+    uint32_t j;
+    uint32_t size;
+    uint8_t *buf;
+
+    j = *index;                                                                            /* get index */
+    buf = a_st7789_get_buffer(handle, &size);                                              /* get the buffer */
+    if (*odd == 0)                                                                         /* the first of two points */
     {
-        handle->debug_print("st7789: address is invalid.\n");                  /* address is invalid */
+        buf[j] = (((color >> 8) & 0xF) << 4) |
+                 (((color >> 4) & 0xF) << 0);                                              /* set the color */
+        buf[j + 1] = (((color >> 0) & 0xF) << 4);                                          /* set the color */
+        *odd = 1;                                                                          /* set odd */
 
-        return 4;                                                              /* return error */
+        return 0;                                                                          /* success return 0 */
     }
-    if (start_address >= end_address)                                          /* check range */
+    buf[j + 1] |= (((color >> 8) & 0xF) << 0);                                             /* set the color */
+    buf[j + 2] = (((color >> 4) & 0xF) << 4) |
+                 (((color >> 0) & 0xF) << 0);                                              /* set the color */
+    *odd = 0;                                                                              /* clear odd */
+    j += 3;                                                                                /* 2 points 3 bytes */
+    if ((j + 3) > size)                                                                    /* buffer is full */
     {
-        handle->debug_print("st7789: start_address >= end_address.\n");        /* start_address >= end_address */
-
-        return 5;                                                              /* return error */
+        if (a_st7789_send_buffer(handle, buf, j) != 0)                                     /* send the buffer */
+        {
+            return 1;                                                                      /* return error */
+        }
+        j = 0;                                                                             /* reset 0 */
     }
+    *index = j;                                                                            /* save index */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)        /* write set row address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+    return 0;                                                                              /* success return 0 */
+}
 
-        return 1;                                                              /* return error */
+/**
+ * @brief         push an rgb565 point to the inner buffer
+ * @param[in]     *handle pointer to an st7789 handle structure
+ * @param[in]     color pushed color
+ * @param[in,out] *index pointer to the inner buffer index
+ * @param[in,out] *odd pointer to the odd point flag
+ * @return        status code
+ *                - 0 success
+ *                - 1 push color failed
+ * @note          odd is not used
+ */
+static uint8_t a_st7789_push_565(st7789_handle_t *handle, uint32_t color, uint32_t *index, uint8_t *odd)
+{
+    uint32_t j;
+    uint32_t size;
+    uint8_t *buf;
+
+    (void)odd;                                                                             /* not used */
+    j = *index;                                                                            /* get index */
+    buf = a_st7789_get_buffer(handle, &size);                                              /* get the buffer */
+    buf[j] = (color >> 8) & 0xFF;                                                          /* set the color */
+    buf[j + 1] = (color >> 0) & 0xFF;                                                      /* set the color */
+    j += 2;                                                                                /* 2 bytes */
+    if ((j + 2) > size)                                                                    /* buffer is full */
+    {
+        if (a_st7789_send_buffer(handle, buf, j) != 0)                                     /* send the buffer */
+        {
+            return 1;                                                                      /* return error */
+        }
+        j = 0;                                                                             /* reset 0 */
     }
-    buf[0] = (start_address >> 8) & 0xFF;                                      /* start address msb */
-    buf[1] = (start_address >> 0) & 0xFF;                                      /* start address lsb */
-    buf[2] = (end_address >> 8) & 0xFF;                                        /* end address msb */
-    buf[3] = (end_address >> 0) & 0xFF;                                        /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+    *index = j;                                                                            /* save index */
 
-        return 1;                                                              /* return error */
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief         push an rgb666 point to the inner buffer
+ * @param[in]     *handle pointer to an st7789 handle structure
+ * @param[in]     color pushed color
+ * @param[in,out] *index pointer to the inner buffer index
+ * @param[in,out] *odd pointer to the odd point flag
+ * @return        status code
+ *                - 0 success
+ *                - 1 push color failed
+ * @note          odd is not used
+ */
+static uint8_t a_st7789_push_666(st7789_handle_t *handle, uint32_t color, uint32_t *index, uint8_t *odd)
+{
+    uint32_t j;
+    uint32_t size;
+    uint8_t *buf;
+
+    (void)odd;                                                                             /* not used */
+    j = *index;                                                                            /* get index */
+    buf = a_st7789_get_buffer(handle, &size);                                              /* get the buffer */
+    buf[j] = ((color >> 12) & 0x3F) << 2;                                                  /* set the color */
+    buf[j + 1] = ((color >> 6) & 0x3F) << 2;                                               /* set the color */
+    buf[j + 2] = ((color >> 0) & 0x3F) << 2;                                               /* set the color */
+    j += 3;                                                                                /* 3 bytes */
+    if ((j + 3) > size)                                                                    /* buffer is full */
+    {
+        if (a_st7789_send_buffer(handle, buf, j) != 0)                                     /* send the buffer */
+        {
+            return 1;                                                                      /* return error */
+        }
+        j = 0;                                                                             /* reset 0 */
     }
+    *index = j;                                                                            /* save index */
 
-    return 0;                                                                  /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     memory write
+ * @brief rgb444 kernel
+ */
+static const st7789_kernel_t gsc_st7789_kernel_444 =
+{
+    2, 2, 3,
+    {8, 4, 0}, {0x0F, 0x0F, 0x0F},
+    a_st7789_fill_444, a_st7789_put_444, a_st7789_get_444, a_st7789_unpack_444,
+    a_st7789_push_444, a_st7789_convert_444, NULL
+};
+
+/**
+ * @brief rgb565 kernel
+ */
+static const st7789_kernel_t gsc_st7789_kernel_565 =
+{
+    2, 1, 2,
+    {11, 5, 0}, {0x1F, 0x3F, 0x1F},
+    a_st7789_fill_565, a_st7789_put_565, NULL, NULL,
+    a_st7789_push_565, a_st7789_convert_565, NULL
+};
+
+/**
+ * @brief rgb666 kernel
+ */
+static const st7789_kernel_t gsc_st7789_kernel_666 =
+{
+    3, 1, 3,
+    {12, 6, 0}, {0x3F, 0x3F, 0x3F},
+    a_st7789_fill_666, a_st7789_put_666, NULL, NULL,
+    a_st7789_push_666, NULL, a_st7789_convert_666
+};
+
+/**
+ * @brief     resolve the pixel format kernel
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *data pointer to a data buffer
- * @param[in] len data length
- * @return    status code
- *            - 0 success
- *            - 1 memory write failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @note      called once when the interface pixel format changes, NULL means the format is invalid
  */
-uint8_t st7789_memory_write(st7789_handle_t *handle, uint8_t *data, uint16_t len)
+static void a_st7789_kernel_resolve(st7789_handle_t *handle)
 {
-    if (handle == NULL)                                                        /* check handle */
+    if ((handle->format & 0x03) == 0x03)                                                   /* rgb444 */
     {
-        return 2;                                                              /* return error */
+        handle->kernel = &gsc_st7789_kernel_444;                                           /* set kernel */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    else if ((handle->format & 0x05) == 0x05)                                              /* rgb565 */
     {
-        return 3;                                                              /* return error */
+        handle->kernel = &gsc_st7789_kernel_565;                                           /* set kernel */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)        /* write memory write command */
+    else if ((handle->format & 0x06) == 0x06)                                              /* rgb666 */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        handle->kernel = &gsc_st7789_kernel_666;                                           /* set kernel */
     }
-    if (a_st7789_write_bytes(handle, data, len, ST7789_DATA) != 0)             /* write data */
+    else
     {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
-
-        return 1;                                                              /* return error */
+        handle->kernel = NULL;                                                             /* invalid */
     }
-
-    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set partial areas
+ * @brief     send the pushed colors left in the inner buffer
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] start_row start row
- * @param[in] end_row end row
+ * @param[in] index inner buffer index
+ * @param[in] odd rgb444 odd point flag
  * @return    status code
  *            - 0 success
- *            - 1 set partial areas failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 push end failed
  * @note      none
  */
-uint8_t st7789_set_partial_areas(st7789_handle_t *handle, uint16_t start_row, uint16_t end_row)
+static uint8_t a_st7789_push_end(st7789_handle_t *handle, uint32_t index, uint8_t odd)
 {
-    uint8_t buf[4];
+    uint32_t size;
+    uint8_t *buf;
 
-    if (handle == NULL)                                                        /* check handle */
+    if (odd != 0)                                                                  /* the last single point */
     {
-        return 2;                                                              /* return error */
+        index += 2;                                                                /* 1 point 2 bytes */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (index != 0)                                                                /* not end */
     {
-        return 3;                                                              /* return error */
+        buf = a_st7789_get_buffer(handle, &size);                                  /* get the buffer */
+        if (a_st7789_send_buffer(handle, buf, index) != 0)                         /* send the buffer */
+        {
+            return 1;                                                              /* return error */
+        }
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PTLAR, ST7789_CMD) != 0)        /* write set partial areas command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+    return a_st7789_wait(handle);                                                  /* wait for the last half */
+}
 
-        return 1;                                                              /* return error */
+/**
+ * @brief     check the framebuffer size
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @note      the framebuffer is detached when it can't hold the whole screen
+ */
+static void a_st7789_framebuffer_check(st7789_handle_t *handle)
+{
+    if (handle->framebuffer == NULL)                                              /* check framebuffer */
+    {
+        return;                                                                   /* return */
     }
-    buf[0] = (start_row >> 8) & 0xFF;                                          /* start row msb */
-    buf[1] = (start_row >> 0) & 0xFF;                                          /* start row lsb */
-    buf[2] = (end_row >> 8) & 0xFF;                                            /* end row msb */
-    buf[3] = (end_row >> 0) & 0xFF;                                            /* end row lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                /* write data */
+    if ((handle->kernel == NULL) ||
+        ((uint32_t)(handle->column) * handle->row * handle->kernel->point_size >
+         handle->framebuffer_size))                                               /* check size */
     {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
-
-        return 1;                                                              /* return error */
+        handle->debug_print("st7789: framebuffer is too small, detach it.\n");    /* framebuffer is too small */
+        handle->framebuffer = NULL;                                               /* detach framebuffer */
+        handle->framebuffer_size = 0;                                             /* clear size */
+        handle->dirty_num = 0;                                                    /* clear dirty areas */
     }
+}
 
-    return 0;                                                                  /* success return 0 */
+/**
+ * @brief     reset the driver state after a software reset
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @note      the scrolling and the pixel format go back to the power on values
+ */
+static void a_st7789_software_reset_state(st7789_handle_t *handle)
+{
+    handle->scroll_top = 0;                                                        /* no top fixed area */
+    handle->scroll_area = ST7789_MEMORY_ROW;                                       /* whole memory */
+    handle->scroll_start = 0;                                                      /* no scrolling */
+    handle->format = ST7789_COLMOD_DEFAULT;                                        /* power on format */
+    a_st7789_kernel_resolve(handle);                                               /* resolve the kernel */
+    a_st7789_framebuffer_check(handle);                                            /* check framebuffer */
+    a_st7789_invalidate(handle);                                                   /* the caches are unknown */
 }
 
 /**
- * @brief     set vertical scrolling
+ * @brief     write a point in the framebuffer
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] top_fixed_area top fixed area line
- * @param[in] scrolling_area scrolling area line
- * @param[in] bottom_fixed_area bottom fixed area line
- * @return    status code
- *            - 0 success
- *            - 1 set vertical scrolling failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color point color
+ * @note      x < column && y < row
  */
-uint8_t st7789_set_vertical_scrolling(st7789_handle_t *handle, uint16_t top_fixed_area,
-                                      uint16_t scrolling_area, uint16_t bottom_fixed_area)
+static void a_st7789_framebuffer_put(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color)
 {
-    uint8_t buf[6];
+    handle->kernel->put(&handle->framebuffer[((uint32_t)(y) * handle->column + x) *
+                        handle->kernel->point_size], color);                      /* put the point */
+}
 
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
+/**
+ * @brief     get the wasted pixels of merging two areas
+ * @param[in] *a pointer to an area
+ * @param[in] *b pointer to an area
+ * @return    wasted pixels
+ * @note      none
+ */
+static uint32_t a_st7789_area_merge_cost(st7789_area_t *a, st7789_area_t *b)
+{
+    uint32_t area_a;
+    uint32_t area_b;
+    uint32_t area_u;
+    uint32_t area_i;
+    uint16_t l, t, r, bm;
+
+    area_a = (uint32_t)(a->right - a->left + 1) * (a->bottom - a->top + 1);      /* area of a */
+    area_b = (uint32_t)(b->right - b->left + 1) * (b->bottom - b->top + 1);      /* area of b */
+    l = (a->left < b->left) ? a->left : b->left;                                 /* union left */
+    t = (a->top < b->top) ? a->top : b->top;                                     /* union top */
+    r = (a->right > b->right) ? a->right : b->right;                             /* union right */
+    bm = (a->bottom > b->bottom) ? a->bottom : b->bottom;                        /* union bottom */
+    area_u = (uint32_t)(r - l + 1) * (bm - t + 1);                               /* area of union */
+    l = (a->left > b->left) ? a->left : b->left;                                 /* intersection left */
+    t = (a->top > b->top) ? a->top : b->top;                                     /* intersection top */
+    r = (a->right < b->right) ? a->right : b->right;                             /* intersection right */
+    bm = (a->bottom < b->bottom) ? a->bottom : b->bottom;                        /* intersection bottom */
+    if ((l <= r) && (t <= bm))                                                   /* overlap */
+    {
+        area_i = (uint32_t)(r - l + 1) * (bm - t + 1);                           /* area of intersection */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    else
     {
-        return 3;                                                              /* return error */
+        area_i = 0;                                                              /* no intersection */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VSCRDEF, ST7789_CMD) != 0)      /* write set vertical scrolling definition command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+    return area_u + area_i - area_a - area_b;                                    /* return wasted pixels */
+}
 
-        return 1;                                                              /* return error */
+/**
+ * @brief         merge an area into another one
+ * @param[in,out] *a pointer to the merged area
+ * @param[in]     *b pointer to an area
+ * @note          none
+ */
+static void a_st7789_area_merge(st7789_area_t *a, st7789_area_t *b)
+{
+    a->left = (a->left < b->left) ? a->left : b->left;                  /* union left */
+    a->top = (a->top < b->top) ? a->top : b->top;                       /* union top */
+    a->right = (a->right > b->right) ? a->right : b->right;             /* union right */
+    a->bottom = (a->bottom > b->bottom) ? a->bottom : b->bottom;        /* union bottom */
+}
+
+/**
+ * @brief     mark an area of the framebuffer dirty
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @note      left <= right && top <= bottom
+ */
+static void a_st7789_framebuffer_mark(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    st7789_area_t area;
+    uint8_t i;
+    uint8_t best;
+    uint32_t cost;
+    uint32_t best_cost;
+
+    area.left = left;                                                                 /* set left */
+    area.top = top;                                                                   /* set top */
+    area.right = right;                                                               /* set right */
+    area.bottom = bottom;                                                             /* set bottom */
+    i = 0;                                                                            /* init 0 */
+    while (i < handle->dirty_num)                                                     /* merge the cheap areas */
+    {
+        if (a_st7789_area_merge_cost(&handle->dirty[i], &area) <=
+            ST7789_DIRTY_MERGE_COST)                                                  /* check cost */
+        {
+            a_st7789_area_merge(&area, &handle->dirty[i]);                            /* merge area */
+            handle->dirty_num--;                                                      /* remove the area */
+            handle->dirty[i] = handle->dirty[handle->dirty_num];                      /* move the last area */
+            i = 0;                                                                    /* the area grows, check again */
+
+            continue;                                                                 /* continue */
+        }
+        i++;                                                                          /* next area */
     }
-    buf[0] = (top_fixed_area >> 8) & 0xFF;                                     /* top fixed area msb */
-    buf[1] = (top_fixed_area >> 0) & 0xFF;                                     /* top fixed area lsb */
-    buf[2] = (scrolling_area >> 8) & 0xFF;                                     /* scrolling area msb */
-    buf[3] = (scrolling_area >> 0) & 0xFF;                                     /* scrolling area lsb */
-    buf[4] = (bottom_fixed_area >> 8) & 0xFF;                                  /* bottom fixed area msb */
-    buf[5] = (bottom_fixed_area >> 0) & 0xFF;                                  /* bottom fixed area lsb */
-    if (a_st7789_write_bytes(handle, buf, 6, ST7789_DATA) != 0)                /* write data */
+    if (handle->dirty_num < ST7789_DIRTY_AREA_MAX)                                    /* not full */
     {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+        handle->dirty[handle->dirty_num] = area;                                      /* add area */
+        handle->dirty_num++;                                                          /* area number++ */
 
-        return 1;                                                              /* return error */
+        return;                                                                       /* return */
     }
 
-    return 0;                                                                  /* success return 0 */
+    best = 0;                                                                         /* init 0 */
+    best_cost = 0xFFFFFFFFU;                                                          /* init max */
+    for (i = 0; i < handle->dirty_num; i++)                                           /* find the cheapest area */
+    {
+        cost = a_st7789_area_merge_cost(&handle->dirty[i], &area);                    /* get cost */
+        if (cost < best_cost)                                                         /* check cost */
+        {
+            best_cost = cost;                                                         /* save cost */
+            best = i;                                                                 /* save index */
+        }
+    }
+    a_st7789_area_merge(&handle->dirty[best], &area);                                 /* merge area */
 }
 
 /**
- * @brief     tearing effect line off
+ * @brief     fill a rect in the framebuffer
  * @param[in] *handle pointer to an st7789 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 tearing effect line off failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color fill color
+ * @note      left <= right && top <= bottom
  */
-uint8_t st7789_tearing_effect_line_off(st7789_handle_t *handle)
+static void a_st7789_framebuffer_fill(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t color)
 {
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    uint8_t size;
+    uint16_t x;
+    uint16_t y;
+    uint32_t line;
+    uint8_t *first;
+
+    size = handle->kernel->point_size;                                                     /* get point size */
+    for (x = left; x <= right; x++)                                                        /* fill the first line */
     {
-        return 3;                                                              /* return error */
+        a_st7789_framebuffer_put(handle, x, top, color);                                   /* put the point */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_TEOFF, ST7789_CMD) != 0)        /* write tearing effect line off command */
+    first = &handle->framebuffer[((uint32_t)(top) * handle->column + left) * size];        /* first line address */
+    line = (uint32_t)(right - left + 1) * size;                                            /* line size */
+    for (y = top + 1; y <= bottom; y++)                                                    /* copy the other lines */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        memcpy(&handle->framebuffer[((uint32_t)(y) * handle->column + left) * size],
+               first, line);                                                               /* copy line */
     }
-
-    return 0;                                                                  /* success return 0 */
+    a_st7789_framebuffer_mark(handle, left, top, right, bottom);                           /* mark dirty */
 }
 
 /**
- * @brief     tearing effect line on
+ * @brief     flush an area of the framebuffer
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] effect tearing effect
+ * @param[in] *area pointer to an area
  * @return    status code
  *            - 0 success
- *            - 1 tearing effect line on failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 flush failed
  * @note      none
  */
-uint8_t st7789_tearing_effect_line_on(st7789_handle_t *handle, st7789_tearing_effect_t effect)
+static uint8_t a_st7789_framebuffer_flush_area(st7789_handle_t *handle, st7789_area_t *area)
 {
-    if (handle == NULL)                                                       /* check handle */
+    const st7789_kernel_t *kernel;
+    uint8_t size;
+    uint16_t x;
+    uint16_t y;
+    uint8_t odd;
+    uint32_t j;
+    uint32_t len;
+    uint32_t total;
+    uint32_t free_size;
+    uint8_t *p;
+    uint8_t *buf;
+
+    if (a_st7789_set_window(handle, area->left, area->top,
+                            area->right, area->bottom) != 0)                               /* set window */
     {
-        return 2;                                                             /* return error */
+        return 1;                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+
+    kernel = handle->kernel;                                                               /* get kernel */
+    size = kernel->point_size;                                                             /* get point size */
+    if (kernel->get != NULL)                                                               /* packed format */
     {
-        return 3;                                                             /* return error */
+        j = 0;                                                                             /* init 0 */
+        odd = 0;                                                                           /* init 0 */
+        for (y = area->top; y <= area->bottom; y++)                                        /* all lines */
+        {
+            p = &handle->framebuffer[((uint32_t)(y) * handle->column + area->left) * size]; /* line address */
+            for (x = area->left; x <= area->right; x++)                                    /* all points */
+            {
+                if (kernel->push(handle, kernel->get(p), &j, &odd) != 0)                   /* push color */
+                {
+                    return 1;                                                              /* return error */
+                }
+                p += size;                                                                 /* next point */
+            }
+        }
+        if (a_st7789_push_end(handle, j, odd) != 0)                                        /* push end */
+        {
+            return 1;                                                                      /* return error */
+        }
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_TEON, ST7789_CMD) != 0)        /* write tearing effect line off command */
+    else if ((area->left == 0) && (area->right == (handle->column - 1)))                   /* whole lines */
     {
-        handle->debug_print("st7789: write command failed.\n");               /* write command failed */
-
-        return 1;                                                             /* return error */
+        p = &handle->framebuffer[(uint32_t)(area->top) * handle->column * size];           /* start address */
+        total = (uint32_t)(area->bottom - area->top + 1) * handle->column * size;          /* total size */
+        while (total != 0)                                                                 /* send in place */
+        {
+            len = (total > handle->buf_size) ? handle->buf_size : total;                   /* get length */
+            if (a_st7789_send_buffer(handle, p, len) != 0)                                 /* send the part */
+            {
+                return 1;                                                                  /* return error */
+            }
+            p += len;                                                                      /* next part */
+            total -= len;                                                                  /* total - len */
+        }
+        if (a_st7789_wait(handle) != 0)                                                    /* wait for the last part */
+        {
+            return 1;                                                                      /* return error */
+        }
     }
-    if (a_st7789_write_byte(handle, effect, ST7789_DATA) != 0)                /* write data */
+    else
     {
-        handle->debug_print("st7789: write data failed.\n");                  /* write data failed */
-
-        return 1;                                                             /* return error */
+        j = 0;                                                                             /* init 0 */
+        buf = a_st7789_get_buffer(handle, &free_size);                                     /* get the buffer */
+        for (y = area->top; y <= area->bottom; y++)                                        /* all lines */
+        {
+            p = &handle->framebuffer[((uint32_t)(y) * handle->column + area->left) * size]; /* line address */
+            total = (uint32_t)(area->right - area->left + 1) * size;                       /* line size */
+            while (total != 0)                                                             /* copy the line */
+            {
+                len = free_size - j;                                                       /* free size */
+                len = (total > len) ? len : total;                                         /* get length */
+                memcpy(&buf[j], p, len);                                                   /* copy data */
+                p += len;                                                                  /* next part */
+                total -= len;                                                              /* total - len */
+                j += len;                                                                  /* j + len */
+                if (j == free_size)                                                        /* buffer is full */
+                {
+                    if (a_st7789_send_buffer(handle, buf, j) != 0)                         /* send the buffer */
+                    {
+                        return 1;                                                          /* return error */
+                    }
+                    buf = a_st7789_get_buffer(handle, &free_size);                         /* get the next buffer */
+                    j = 0;                                                                 /* reset 0 */
+                }
+            }
+        }
+        if (j != 0)                                                                        /* not end */
+        {
+            if (a_st7789_send_buffer(handle, buf, j) != 0)                                 /* send the buffer */
+            {
+                return 1;                                                                  /* return error */
+            }
+        }
+        if (a_st7789_wait(handle) != 0)                                                    /* wait for the last half */
+        {
+            return 1;                                                                      /* return error */
+        }
     }
 
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
- * @brief     set memory data access control
+ * @brief     invalidate the register shadow and the address window cache
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] order memory data access control order
  * @return    status code
  *            - 0 success
- *            - 1 set memory data access control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_memory_data_access_control(st7789_handle_t *handle, uint8_t order)
+uint8_t st7789_invalidate_cache(st7789_handle_t *handle)
 {
-    if (handle == NULL)                                                         /* check handle */
+    if (handle == NULL)                                       /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                             /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle->inited != 1)                                  /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                             /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_MADCTL, ST7789_CMD) != 0)        /* write set memory data access control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+    a_st7789_invalidate(handle);                              /* the caches are unknown */
 
-        return 1;                                                               /* return error */
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     nop
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 nop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_nop(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
     }
-    if (a_st7789_write_byte(handle, order, ST7789_DATA) != 0)                   /* write data */
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_NOP, ST7789_CMD) != 0)        /* write nop command */
     {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");              /* write command failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                            /* return error */
     }
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                /* success return 0 */
 }
 
 /**
- * @brief     set the vertical scroll start address
+ * @brief     software reset
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] start_address start address
  * @return    status code
  *            - 0 success
- *            - 1 set vertical scroll start address failed
+ *            - 1 software reset failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 address is invalid
- * @note      none
+ * @note      the pixel format goes back to the power on rgb666 and the scrolling area to the whole memory
  */
-uint8_t st7789_set_vertical_scroll_start_address(st7789_handle_t *handle, uint16_t start_address)
+uint8_t st7789_software_reset(st7789_handle_t *handle)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                          /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                                /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                     /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                                /* return error */
     }
-    if (start_address > 319)                                                      /* check range */
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_SWRESET, ST7789_CMD) != 0)        /* write software reset command */
     {
-        handle->debug_print("st7789: address is invalid.\n");                     /* address is invalid */
+        handle->debug_print("st7789: write command failed.\n");                  /* write command failed */
 
-        return 4;                                                                 /* return error */
+        return 1;                                                                /* return error */
     }
+    handle->delay_ms(200);                                                       /* delay 200ms */
+    a_st7789_software_reset_state(handle);                                       /* power on state */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VSCRSADD, ST7789_CMD) != 0)        /* write vertical scrolling start address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+    return 0;                                                                    /* success return 0 */
+}
 
-        return 1;                                                                 /* return error */
+/**
+ * @brief     sleep in
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sleep in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_sleep_in(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
     }
-    buf[0] = (start_address >> 8) & 0xFF;                                         /* start address msb */
-    buf[1] = (start_address >> 0) & 0xFF;                                         /* start address lsb */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        return 3;                                                              /* return error */
+    }
 
-        return 1;                                                                 /* return error */
+    if (a_st7789_write_byte(handle, ST7789_CMD_SLPIN, ST7789_CMD) != 0)        /* write sleep in command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     idle mode off
+ * @brief     sleep out
  * @param[in] *handle pointer to an st7789 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 idle mode off failed
+ *            - 1 sleep out failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_idle_mode_off(st7789_handle_t *handle)
+uint8_t st7789_sleep_out(st7789_handle_t *handle)
 {
     if (handle == NULL)                                                         /* check handle */
     {
@@ -958,27 +1867,29 @@ uint8_t st7789_idle_mode_off(st7789_handle_t *handle)
         return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_IDMOFF, ST7789_CMD) != 0)        /* write idle mode off command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_SLPOUT, ST7789_CMD) != 0)        /* write sleep out command */
     {
         handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
 
         return 1;                                                               /* return error */
     }
+    handle->delay_ms(ST7789_SLEEP_OUT_MS);                                      /* delay 200ms */
 
     return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     idle mode on
+ * @brief     start the sleep in without blocking
  * @param[in] *handle pointer to an st7789 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 idle mode on failed
+ *            - 1 sleep in failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 get_time_ms is NULL
+ * @note      st7789_poll reports the panel ready again
  */
-uint8_t st7789_idle_mode_on(st7789_handle_t *handle)
+uint8_t st7789_sleep_in_start(st7789_handle_t *handle)
 {
     if (handle == NULL)                                                        /* check handle */
     {
@@ -988,75 +1899,74 @@ uint8_t st7789_idle_mode_on(st7789_handle_t *handle)
     {
         return 3;                                                              /* return error */
     }
+    if (handle->get_time_ms == NULL)                                           /* check get_time_ms */
+    {
+        handle->debug_print("st7789: get_time_ms is null.\n");                 /* get_time_ms is null */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_IDMON, ST7789_CMD) != 0)        /* write idle mode on command */
+        return 4;                                                              /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_SLPIN, ST7789_CMD) != 0)        /* write sleep in command */
     {
         handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
         return 1;                                                              /* return error */
     }
+    a_st7789_panel_start(handle, ST7789_WAIT_SLEEP, ST7789_SLEEP_IN_MS);       /* wait for the sleep in */
 
     return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set interface pixel format
+ * @brief     start the sleep out without blocking
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] rgb rgb interface color format
- * @param[in] control control interface color format
  * @return    status code
  *            - 0 success
- *            - 1 set interface pixel format failed
+ *            - 1 sleep out failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 get_time_ms is NULL
+ * @note      st7789_poll reports the panel ready again
  */
-uint8_t st7789_set_interface_pixel_format(st7789_handle_t *handle, st7789_rgb_interface_color_format_t rgb,
-                                          st7789_control_interface_color_format_t control)
+uint8_t st7789_sleep_out_start(st7789_handle_t *handle)
 {
-    uint8_t data;
-
-    if (handle == NULL)                                                         /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                                              /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_COLMOD, ST7789_CMD) != 0)        /* write interface pixel format command */
+    if (handle->get_time_ms == NULL)                                           /* check get_time_ms */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+        handle->debug_print("st7789: get_time_ms is null.\n");                 /* get_time_ms is null */
 
-        return 1;                                                               /* return error */
+        return 4;                                                              /* return error */
     }
 
-    data = (rgb << 4) | (control << 0);                                         /* set pixel format */
-    if (a_st7789_write_byte(handle, data, ST7789_DATA) != 0)                    /* write data */
+    if (a_st7789_write_byte(handle, ST7789_CMD_SLPOUT, ST7789_CMD) != 0)       /* write sleep out command */
     {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                              /* return error */
     }
-    handle->format = data;                                                      /* set format */
+    a_st7789_panel_start(handle, ST7789_WAIT_SLEEP, ST7789_SLEEP_OUT_MS);      /* wait for the sleep out */
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     memory continue write
+ * @brief     partial display mode on
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *data pointer to a data buffer
- * @param[in] len data length
  * @return    status code
  *            - 0 success
- *            - 1 memory continue write failed
+ *            - 1 partial display mode on failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_memory_continue_write(st7789_handle_t *handle, uint8_t *data, uint16_t len)
+uint8_t st7789_partial_display_mode_on(st7789_handle_t *handle)
 {
     if (handle == NULL)                                                        /* check handle */
     {
@@ -1067,76 +1977,58 @@ uint8_t st7789_memory_continue_write(st7789_handle_t *handle, uint8_t *data, uin
         return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWRC, ST7789_CMD) != 0)       /* write memory write continue command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_PTLON, ST7789_CMD) != 0)        /* write partial display mode on command */
     {
         handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
         return 1;                                                              /* return error */
     }
-    if (a_st7789_write_bytes(handle, data, len, ST7789_DATA) != 0)             /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
-
-        return 1;                                                              /* return error */
-    }
 
     return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set tear scanline
+ * @brief     normal display mode on
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] l tear line
  * @return    status code
  *            - 0 success
- *            - 1 set tear scanline failed
+ *            - 1 normal display mode on failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_tear_scanline(st7789_handle_t *handle, uint16_t l)
+uint8_t st7789_normal_display_mode_on(st7789_handle_t *handle)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                         /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_TESCAN, ST7789_CMD) != 0)        /* write set tear scanline command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
-
-        return 1;                                                               /* return error */
-    }
-    buf[0] = (l >> 8) & 0xFF;                                                   /* start line msb */
-    buf[1] = (l >> 0) & 0xFF;                                                   /* start line lsb */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                 /* write data */
+    if (a_st7789_write_byte(handle, ST7789_CMD_NORON, ST7789_CMD) != 0)        /* write normal display mode on command */
     {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set display brightness
+ * @brief     display inversion off
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] brightness display brightness
  * @return    status code
  *            - 0 success
- *            - 1 set display brightness failed
+ *            - 1 display inversion off failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_display_brightness(st7789_handle_t *handle, uint8_t brightness)
+uint8_t st7789_display_inversion_off(st7789_handle_t *handle)
 {
     if (handle == NULL)                                                         /* check handle */
     {
@@ -1147,126 +2039,120 @@ uint8_t st7789_set_display_brightness(st7789_handle_t *handle, uint8_t brightnes
         return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_WRDISBV, ST7789_CMD) != 0)       /* write display brightness command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_INVOFF, ST7789_CMD) != 0)        /* write display inversion off command */
     {
         handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
 
         return 1;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, brightness, ST7789_DATA) != 0)              /* write brightness */
-    {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
-
-        return 1;                                                               /* return error */
-    }
-
     return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set display control
+ * @brief     display inversion on
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] brightness_control_block bool value
- * @param[in] display_dimming bool value
- * @param[in] backlight_control bool value
  * @return    status code
  *            - 0 success
- *            - 1 set display control failed
+ *            - 1 display inversion on failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_display_control(st7789_handle_t *handle, st7789_bool_t brightness_control_block,
-                                   st7789_bool_t display_dimming, st7789_bool_t backlight_control)
+uint8_t st7789_display_inversion_on(st7789_handle_t *handle)
 {
-    uint8_t data;
-
-    if (handle == NULL)                                                         /* check handle */
-    {
-        return 2;                                                               /* return error */
-    }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 3;                                                               /* return error */
+        return 2;                                                              /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_WRCTRLD, ST7789_CMD) != 0)       /* write CTRL display command */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
-
-        return 1;                                                               /* return error */
+        return 3;                                                              /* return error */
     }
 
-    data = (brightness_control_block << 5) | (display_dimming << 3)
-            | (backlight_control << 2);                                         /* set control data */
-    if (a_st7789_write_byte(handle, data, ST7789_DATA) != 0)                    /* write control */
+    if (a_st7789_write_byte(handle, ST7789_CMD_INVON, ST7789_CMD) != 0)        /* write display inversion on command */
     {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set brightness control and color enhancement
+ * @brief     set gamma
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] color_enhancement bool value
- * @param[in] mode color enhancement mode
- * @param[in] level color enhancement level
+ * @param[in] gamma set gamma
  * @return    status code
  *            - 0 success
- *            - 1 set brightness control and color enhancement failed
+ *            - 1 set gamma failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_brightness_control_and_color_enhancement(st7789_handle_t *handle, st7789_bool_t color_enhancement,
-                                                            st7789_color_enhancement_mode_t mode, st7789_color_enhancement_level_t level)
+uint8_t st7789_set_gamma(st7789_handle_t *handle, uint8_t gamma)
 {
-    uint8_t data;
-
-    if (handle == NULL)                                                         /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                    /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_WRCACE, ST7789_CMD) != 0)       /* write content adaptive brightness control and color enhancement command */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_GAMSET,
+                                     gamma & 0x0F) != 0)                       /* write set gamma */
     {
-        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+        return 1;                                                              /* return error */
+    }
 
-        return 1;                                                               /* return error */
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     display off
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 display off failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_display_off(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
     }
 
-    data = (color_enhancement << 7) | (level << 4) | (mode << 0);               /* set control data */
-    if (a_st7789_write_byte(handle, data, ST7789_DATA) != 0)                    /* write control */
+    if (a_st7789_write_byte(handle, ST7789_CMD_DISPOFF, ST7789_CMD) != 0)        /* write display off command */
     {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                  /* write command failed */
 
-        return 1;                                                               /* return error */
+        return 1;                                                                /* return error */
     }
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                    /* success return 0 */
 }
 
 /**
- * @brief     set cabc minimum brightness
+ * @brief     display on
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] brightness display brightness
  * @return    status code
  *            - 0 success
- *            - 1 set cabc minimum brightness failed
+ *            - 1 display on failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_cabc_minimum_brightness(st7789_handle_t *handle, uint8_t brightness)
+uint8_t st7789_display_on(st7789_handle_t *handle)
 {
     if (handle == NULL)                                                         /* check handle */
     {
@@ -1277,497 +2163,376 @@ uint8_t st7789_set_cabc_minimum_brightness(st7789_handle_t *handle, uint8_t brig
         return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_WRCABCMB, ST7789_CMD) != 0)      /* write CABC minimum brightness command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_DISPON, ST7789_CMD) != 0)        /* write display on command */
     {
         handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
 
         return 1;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, brightness, ST7789_DATA) != 0)              /* write brightness */
-    {
-        handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
-
-        return 1;                                                               /* return error */
-    }
-
     return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set ram control
+ * @brief     set the column address
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] ram_mode ram mode
- * @param[in] display_mode display mode
- * @param[in] frame_type frame type
- * @param[in] data_mode data mode
- * @param[in] bus_width bus width
- * @param[in] pixel_type pixel type
+ * @param[in] start_address start address
+ * @param[in] end_address end address
  * @return    status code
  *            - 0 success
- *            - 1 set ram control failed
+ *            - 1 set column address failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 address is invalid
+ *            - 5 start_address >= end_address
+ * @note      start_address <= 319 && end_address <= 319 && start_address >= start_address
  */
-uint8_t st7789_set_ram_control(st7789_handle_t *handle,
-                               st7789_ram_access_t ram_mode,
-                               st7789_display_mode_t display_mode,
-                               st7789_frame_type_t frame_type,
-                               st7789_data_mode_t data_mode,
-                               st7789_rgb_bus_width_t bus_width,
-                               st7789_pixel_type_t pixel_type)
+uint8_t st7789_set_column_address(st7789_handle_t *handle, uint16_t start_address, uint16_t end_address)
 {
-    uint8_t buf[2];
+    uint8_t buf[4];
 
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
+    if ((start_address > 319) || (end_address > 319))                          /* check range */
+    {
+        handle->debug_print("st7789: address is invalid.\n");                  /* address is invalid */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMCTRL, ST7789_CMD) != 0)         /* write ram control command */
+        return 4;                                                              /* return error */
+    }
+    if (start_address >= end_address)                                          /* check range */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: start_address >= end_address.\n");        /* start_address >= end_address */
 
-        return 1;                                                                 /* return error */
+        return 5;                                                              /* return error */
     }
-    buf[0] = (ram_mode << 4) | (display_mode << 0);                               /* set param1 */
-    buf[1] = (frame_type << 4) | (data_mode << 3) |
-             (bus_width << 2) | (pixel_type << 0);                                /* set param2 */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)        /* write set column address command */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
+    }
+    buf[0] = (start_address >> 8) & 0xFF;                                      /* start address msb */
+    buf[1] = (start_address >> 0) & 0xFF;                                      /* start address lsb */
+    buf[2] = (end_address >> 8) & 0xFF;                                        /* end address msb */
+    buf[3] = (end_address >> 0) & 0xFF;                                        /* end address lsb */
+    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+        return 1;                                                              /* return error */
     }
+    handle->window_left = start_address;                                       /* save left */
+    handle->window_right = end_address;                                        /* save right */
+    handle->window_valid |= ST7789_WINDOW_COLUMN;                              /* column is known */
+    handle->window_valid &= ~ST7789_WINDOW_POINTER;                            /* the pointer needs a memory write */
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set rgb interface control
+ * @brief     set the row address
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] rgb_mode rgb mode
- * @param[in] rgb_if_mode rgb if enable mode
- * @param[in] vspl vspl active level
- * @param[in] hspl hspl active level
- * @param[in] dpl dpl active level
- * @param[in] epl epl active level
- * @param[in] vbp rgb interface vsync back porch setting
- * @param[in] hbp rgb interface hsync back porch setting
+ * @param[in] start_address start address
+ * @param[in] end_address end address
  * @return    status code
  *            - 0 success
- *            - 1 set rgb interface control failed
+ *            - 1 set row address failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vbp > 0x7F
- *            - 5 hbp > 0x1F
- * @note      0x02 <= vbp <= 0x7F
- *            0x02 <= hbp <= 0x1F
+ *            - 4 address is invalid
+ *            - 5 start_address >= end_address
+ * @note      start_address <= 319 && end_address <= 319 && start_address >= start_address
  */
-uint8_t st7789_set_rgb_interface_control(st7789_handle_t *handle,
-                                         st7789_direct_rgb_mode_t rgb_mode,
-                                         st7789_rgb_if_enable_mode_t rgb_if_mode,
-                                         st7789_pin_level_t vspl,
-                                         st7789_pin_level_t hspl,
-                                         st7789_pin_level_t dpl,
-                                         st7789_pin_level_t epl,
-                                         uint8_t vbp,
-                                         uint8_t hbp)
+uint8_t st7789_set_row_address(st7789_handle_t *handle, uint16_t start_address, uint16_t end_address)
 {
-    uint8_t buf[3];
+    uint8_t buf[4];
 
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
-    if (vbp > 0x7F)                                                               /* check vbp */
+    if ((start_address > 319) || (end_address > 319))                          /* check range */
     {
-        handle->debug_print("st7789: vbp > 0x7F.\n");                             /* vbp > 0x7F */
+        handle->debug_print("st7789: address is invalid.\n");                  /* address is invalid */
 
-        return 4;                                                                 /* return error */
+        return 4;                                                              /* return error */
     }
-    if (hbp > 0x1F)                                                               /* check hbp */
+    if (start_address >= end_address)                                          /* check range */
     {
-        handle->debug_print("st7789: hbp > 0x1F.\n");                             /* hbp > 0x1F */
+        handle->debug_print("st7789: start_address >= end_address.\n");        /* start_address >= end_address */
 
-        return 5;                                                                 /* return error */
+        return 5;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RGBCTRL, ST7789_CMD) != 0)         /* write rgb control command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)        /* write set row address command */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
-    buf[0] = (rgb_mode << 7) | (rgb_if_mode << 5) |
-             (vspl << 3) | (hspl << 2) | (dpl << 1) | (epl << 0);                 /* set param1 */
-    buf[1] = vbp & 0x7F;                                                          /* set param2 */
-    buf[2] = hbp & 0x1F;                                                          /* set param3 */
-    if (a_st7789_write_bytes(handle, buf, 3, ST7789_DATA) != 0)                   /* write data */
+    buf[0] = (start_address >> 8) & 0xFF;                                      /* start address msb */
+    buf[1] = (start_address >> 0) & 0xFF;                                      /* start address lsb */
+    buf[2] = (end_address >> 8) & 0xFF;                                        /* end address msb */
+    buf[3] = (end_address >> 0) & 0xFF;                                        /* end address lsb */
+    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                /* write data */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
+    handle->window_top = start_address;                                        /* save top */
+    handle->window_bottom = end_address;                                       /* save bottom */
+    handle->window_valid |= ST7789_WINDOW_ROW;                                 /* row is known */
+    handle->window_valid &= ~ST7789_WINDOW_POINTER;                            /* the pointer needs a memory write */
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set porch
+ * @brief     memory write
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] back_porch_normal back porch setting in normal mode
- * @param[in] front_porch_normal front porch setting in normal mode
- * @param[in] separate_porch_enable bool value
- * @param[in] back_porch_idle back porch setting in idle mode
- * @param[in] front_porch_idle front porch setting in idle mode
- * @param[in] back_porch_partial back porch setting in partial mode
- * @param[in] front_porch_partial front porch setting in partial mode
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
  * @return    status code
  *            - 0 success
- *            - 1 set porch failed
+ *            - 1 memory write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 back_porch_normal > 0x7F
- *            - 5 front_porch_normal > 0x7F
- *            - 6 back_porch_idle > 0xF
- *            - 7 front_porch_idle > 0xF
- *            - 8 back_porch_partial > 0xF
- *            - 9 front_porch_partial > 0xF
- * @note      0x01 <= back_porch_normal <= 0x7F
- *            0x01 <= front_porch_normal <= 0x7F
- *            0x01 <= back_porch_idle <= 0xF
- *            0x01 <= front_porch_idle <= 0xF
- *            0x01 <= back_porch_partial <= 0xF
- *            0x01 <= front_porch_partial <= 0xF
+ * @note      none
  */
-uint8_t st7789_set_porch(st7789_handle_t *handle,
-                         uint8_t back_porch_normal,
-                         uint8_t front_porch_normal,
-                         st7789_bool_t separate_porch_enable,
-                         uint8_t back_porch_idle,
-                         uint8_t front_porch_idle,
-                         uint8_t back_porch_partial,
-                         uint8_t front_porch_partial)
+uint8_t st7789_memory_write(st7789_handle_t *handle, uint8_t *data, uint32_t len)
 {
-    uint8_t buf[5];
-
-    if (handle == NULL)                                                           /* check handle */
-    {
-        return 2;                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 3;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (back_porch_normal > 0x7F)                                                 /* check back_porch_normal */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("st7789: back_porch_normal > 0x7F.\n");               /* back_porch_normal > 0x7F */
-
-        return 4;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
-    if (front_porch_normal > 0x7F)                                                /* check front_porch_normal */
-    {
-        handle->debug_print("st7789: front_porch_normal > 0x7F.\n");              /* front_porch_normal > 0x7F */
 
-        return 5;                                                                 /* return error */
-    }
-    if (back_porch_idle > 0xF)                                                    /* check back_porch_idle */
+    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)        /* write memory write command */
     {
-        handle->debug_print("st7789: back_porch_idle > 0xF.\n");                  /* back_porch_idle > 0xF */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 6;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
-    if (front_porch_idle > 0xF)                                                   /* check front_porch_idle */
+    if (a_st7789_write_bytes(handle, data, len, ST7789_DATA) != 0)             /* write data */
     {
-        handle->debug_print("st7789: front_porch_idle > 0xF.\n");                 /* front_porch_idle > 0xF */
+        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
 
-        return 7;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
-    if (back_porch_partial > 0xF)                                                 /* check back_porch_partial */
-    {
-        handle->debug_print("st7789: back_porch_partial > 0xF.\n");               /* back_porch_partial > 0xF */
+    handle->window_valid &= ~ST7789_WINDOW_POINTER;                            /* the pointer is unknown */
 
-        return 8;                                                                 /* return error */
-    }
-    if (front_porch_partial > 0xF)                                                /* check front_porch_partial */
-    {
-        handle->debug_print("st7789: front_porch_partial > 0xF.\n");              /* front_porch_partial > 0xF */
+    return 0;                                                                  /* success return 0 */
+}
 
-        return 9;                                                                 /* return error */
-    }
+/**
+ * @brief     set partial areas
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] start_row start row
+ * @param[in] end_row end row
+ * @return    status code
+ *            - 0 success
+ *            - 1 set partial areas failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_partial_areas(st7789_handle_t *handle, uint16_t start_row, uint16_t end_row)
+{
+    uint8_t buf[4];
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PORCTRL, ST7789_CMD) != 0)         /* write porch control command */
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    buf[0] = back_porch_normal;                                                   /* set param1 */
-    buf[1] = front_porch_normal;                                                  /* set param2 */
-    buf[2] = separate_porch_enable;                                               /* set param3 */
-    buf[3] = (back_porch_idle & 0xF) << 4 | (front_porch_idle & 0xF);             /* set param4 */
-    buf[4] = (back_porch_partial & 0xF) << 4 | (front_porch_partial & 0xF);       /* set param5 */
-    if (a_st7789_write_bytes(handle, buf, 5, ST7789_DATA) != 0)                   /* write data */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        return 3;                                                              /* return error */
+    }
 
-        return 1;                                                                 /* return error */
+    buf[0] = (start_row >> 8) & 0xFF;                                          /* start row msb */
+    buf[1] = (start_row >> 0) & 0xFF;                                          /* start row lsb */
+    buf[2] = (end_row >> 8) & 0xFF;                                            /* end row msb */
+    buf[3] = (end_row >> 0) & 0xFF;                                            /* end row lsb */
+    if (a_st7789_write_register(handle, ST7789_CMD_PTLAR, buf, 4) != 0)        /* write set partial areas */
+    {
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set frame rate control
+ * @brief     set vertical scrolling
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] separate_fr_control bool value
- * @param[in] div_control frame rate divided control
- * @param[in] idle_mode inversion idle mode
- * @param[in] idle_frame_rate idle frame rate
- * @param[in] partial_mode inversion partial mode
- * @param[in] partial_frame_rate partial frame rate
+ * @param[in] top_fixed_area top fixed area line
+ * @param[in] scrolling_area scrolling area line
+ * @param[in] bottom_fixed_area bottom fixed area line
  * @return    status code
  *            - 0 success
- *            - 1 set frame rate control failed
+ *            - 1 set vertical scrolling failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 idle_frame_rate > 0x1F
- *            - 5 partial_frame_rate > 0x1F
- * @note      0 <= idle_frame_rate <= 0x1F
- *            0 <= partial_frame_rate <= 0x1F
+ * @note      none
  */
-uint8_t st7789_set_frame_rate_control(st7789_handle_t *handle,
-                                      st7789_bool_t separate_fr_control,
-                                      st7789_frame_rate_divided_control_t div_control,
-                                      st7789_inversion_idle_mode_t idle_mode,
-                                      uint8_t idle_frame_rate,
-                                      st7789_inversion_partial_mode_t partial_mode,
-                                      uint8_t partial_frame_rate)
+uint8_t st7789_set_vertical_scrolling(st7789_handle_t *handle, uint16_t top_fixed_area,
+                                      uint16_t scrolling_area, uint16_t bottom_fixed_area)
 {
-    uint8_t buf[3];
+    uint8_t buf[6];
 
-    if (handle == NULL)                                                           /* check handle */
-    {
-        return 2;                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
-    {
-        return 3;                                                                 /* return error */
-    }
-    if (idle_frame_rate > 0x1F)                                                   /* check idle_frame_rate */
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("st7789: idle_frame_rate > 0x1F.\n");                 /* idle_frame_rate > 0x1F */
-
-        return 4;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (partial_frame_rate > 0x1F)                                                /* check partial_frame_rate */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("st7789: partial_frame_rate > 0x1F.\n");              /* partial_frame_rate > 0x1F */
-
-        return 5;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_FRCTRL1, ST7789_CMD) != 0)         /* write frame rate control 1 command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = (separate_fr_control << 4) | (div_control << 0);                     /* set param1 */
-    buf[1] = (idle_mode << 5) | ((idle_frame_rate & 0x1F) << 0);                  /* set param2 */
-    buf[2] = (partial_mode << 5) | ((partial_frame_rate & 0x1F) << 0);            /* set param3 */
-    if (a_st7789_write_bytes(handle, buf, 3, ST7789_DATA) != 0)                   /* write data */
+    buf[0] = (top_fixed_area >> 8) & 0xFF;                                     /* top fixed area msb */
+    buf[1] = (top_fixed_area >> 0) & 0xFF;                                     /* top fixed area lsb */
+    buf[2] = (scrolling_area >> 8) & 0xFF;                                     /* scrolling area msb */
+    buf[3] = (scrolling_area >> 0) & 0xFF;                                     /* scrolling area lsb */
+    buf[4] = (bottom_fixed_area >> 8) & 0xFF;                                  /* bottom fixed area msb */
+    buf[5] = (bottom_fixed_area >> 0) & 0xFF;                                  /* bottom fixed area lsb */
+    if (a_st7789_write_register(handle, ST7789_CMD_VSCRDEF, buf, 6) != 0)      /* write set vertical scrolling definition */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
+    handle->scroll_top = top_fixed_area;                                       /* save top fixed area */
+    handle->scroll_area = scrolling_area;                                      /* save scrolling area */
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set partial mode control
+ * @brief     tearing effect line off
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] level non-display source output level
- * @param[in] mode non-display area scan mode
- * @param[in] frequency non-display frame frequency
  * @return    status code
  *            - 0 success
- *            - 1 set partial mode control failed
+ *            - 1 tearing effect line off failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_partial_mode_control(st7789_handle_t *handle,
-                                        st7789_non_display_source_output_level_t level,
-                                        st7789_non_display_area_scan_mode_t mode,
-                                        st7789_non_display_frame_frequency_t frequency)
+uint8_t st7789_tearing_effect_line_off(st7789_handle_t *handle)
 {
-    uint8_t reg;
-
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PARCTRL, ST7789_CMD) != 0)         /* write partial mode control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = (level << 7) | (mode << 4) | (frequency << 0);                          /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (a_st7789_write_byte(handle, ST7789_CMD_TEOFF, ST7789_CMD) != 0)        /* write tearing effect line off command */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set gate control
+ * @brief     tearing effect line on
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] vghs vghs level
- * @param[in] vgls vgls level
+ * @param[in] effect tearing effect
  * @return    status code
  *            - 0 success
- *            - 1 set gate control failed
+ *            - 1 tearing effect line on failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_gate_control(st7789_handle_t *handle, st7789_vghs_t vghs, st7789_vgls_t vgls)
+uint8_t st7789_tearing_effect_line_on(st7789_handle_t *handle, st7789_tearing_effect_t effect)
 {
-    uint8_t reg;
-
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                       /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                             /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                  /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                             /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_GCTRL, ST7789_CMD) != 0)           /* write gate control command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_TEON, ST7789_CMD) != 0)        /* write tearing effect line off command */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: write command failed.\n");               /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                             /* return error */
     }
-    reg = (vghs << 4) | (vgls << 0);                                              /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (a_st7789_write_byte(handle, effect, ST7789_DATA) != 0)                /* write data */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write data failed.\n");                  /* write data failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                             /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                 /* success return 0 */
 }
 
 /**
- * @brief     set gate on timing adjustment
+ * @brief     set memory data access control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] gate_on_timing_adjustment gate on timing adjustment
- * @param[in] gate_off_timing_adjustment_rgb gate off timing adjustment in rgb interface
- * @param[in] gate_off_timing_adjustment gate off timing adjustment
+ * @param[in] order memory data access control order
  * @return    status code
  *            - 0 success
- *            - 1 set gate on timing adjustment failed
+ *            - 1 set memory data access control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      gate_on_timing_adjustment <= 0x3F
- *            gate_off_timing_adjustment_rgb <= 0xF
- *            gate_off_timing_adjustment <= 0xF
+ * @note      none
  */
-uint8_t st7789_set_gate_on_timing_adjustment(st7789_handle_t *handle,
-                                             uint8_t gate_on_timing_adjustment,
-                                             uint8_t gate_off_timing_adjustment_rgb,
-                                             uint8_t gate_off_timing_adjustment)
+uint8_t st7789_set_memory_data_access_control(st7789_handle_t *handle, uint8_t order)
 {
-    uint8_t buf[4];
-
-    if (handle == NULL)                                                           /* check handle */
-    {
-        return 2;                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
-    {
-        return 3;                                                                 /* return error */
-    }
-    if (gate_on_timing_adjustment > 0x3F)                                         /* check gate_on_timing_adjustment */
-    {
-        handle->debug_print("st7789: gate_on_timing_adjustment > 0x3F.\n");       /* gate_on_timing_adjustment > 0x3F */
-
-        return 4;                                                                 /* return error */
-    }
-    if (gate_off_timing_adjustment_rgb > 0xF)                                     /* check gate_off_timing_adjustment_rgb */
+    if (handle == NULL)                                                         /* check handle */
     {
-        handle->debug_print("st7789: gate_off_timing_adjustment_rgb > 0xF.\n");   /* gate_off_timing_adjustment_rgb > 0xF */
-
-        return 5;                                                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (gate_off_timing_adjustment > 0xF)                                         /* check gate_off_timing_adjustment */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        handle->debug_print("st7789: gate_off_timing_adjustment > 0xF.\n");       /* gate_off_timing_adjustment > 0xF */
-
-        return 6;                                                                 /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_GTADJ, ST7789_CMD) != 0)           /* write gate on timing adjustment command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = 0x2A;                                                                /* set param1 */
-    buf[1] = 0x2B;                                                                /* set param2 */
-    buf[2] = gate_on_timing_adjustment & 0x3F;                                    /* set param3 */
-    buf[3] = ((gate_off_timing_adjustment_rgb & 0xF) << 4) |
-             ((gate_off_timing_adjustment & 0xF) << 0);                           /* set param4 */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                   /* write data */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_MADCTL, order) != 0)    /* write set memory data access control */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 1;                                                               /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     enable or disable digital gamma
+ * @brief     set the vertical scroll start address
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] enable bool value
+ * @param[in] start_address start address
  * @return    status code
  *            - 0 success
- *            - 1 set digital gamma failed
+ *            - 1 set vertical scroll start address failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
+ *            - 4 address is invalid
  * @note      none
  */
-uint8_t st7789_set_digital_gamma(st7789_handle_t *handle, st7789_bool_t enable)
+uint8_t st7789_set_vertical_scroll_start_address(st7789_handle_t *handle, uint16_t start_address)
 {
-    uint8_t reg;
+    uint8_t buf[2];
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -1777,378 +2542,411 @@ uint8_t st7789_set_digital_gamma(st7789_handle_t *handle, st7789_bool_t enable)
     {
         return 3;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_DGMEN, ST7789_CMD) != 0)           /* write digital gamma enable command */
+    if (start_address > 319)                                                      /* check range */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: address is invalid.\n");                     /* address is invalid */
 
-        return 1;                                                                 /* return error */
+        return 4;                                                                 /* return error */
     }
-    reg = enable << 2;                                                            /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
 
+    buf[0] = (start_address >> 8) & 0xFF;                                         /* start address msb */
+    buf[1] = (start_address >> 0) & 0xFF;                                         /* start address lsb */
+    if (a_st7789_write_register(handle, ST7789_CMD_VSCRSADD, buf, 2) != 0)        /* write vertical scrolling start address */
+    {
         return 1;                                                                 /* return error */
     }
+    handle->scroll_start = start_address;                                         /* save start address */
 
     return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set vcoms
+ * @brief     idle mode off
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] vcoms set vcoms
  * @return    status code
  *            - 0 success
- *            - 1 set vcoms failed
+ *            - 1 idle mode off failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vcoms > 0x3F
- * @note      0 <= vcoms <= 0x3F
+ * @note      none
  */
-uint8_t st7789_set_vcoms(st7789_handle_t *handle, uint8_t vcoms)
+uint8_t st7789_idle_mode_off(st7789_handle_t *handle)
 {
-    uint8_t reg;
-
-    if (handle == NULL)                                                           /* check handle */
-    {
-        return 2;                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 3;                                                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (vcoms > 0x3F)                                                             /* check vcoms */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        handle->debug_print("st7789: vcoms > 0x3F.\n");                           /* vcoms > 0x3F */
-
-        return 4;                                                                 /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VCOMS, ST7789_CMD) != 0)           /* write vcoms setting command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = vcoms & 0x3F;                                                           /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (a_st7789_write_byte(handle, ST7789_CMD_IDMOFF, ST7789_CMD) != 0)        /* write idle mode off command */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                               /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief      convert the vcom to the register raw data
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  v vcom
- * @param[out] *reg pointer to a register raw buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     idle mode on
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 idle mode on failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
  */
-uint8_t st7789_vcom_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
+uint8_t st7789_idle_mode_on(st7789_handle_t *handle)
 {
-    if (handle == NULL)                           /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                      /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                 /* return error */
+        return 3;                                                              /* return error */
     }
 
-    *reg = (uint8_t)((v - 0.1f) / 0.025f);        /* convert real data to register data */
-
-    return 0;                                     /* success return 0 */
-}
-
-/**
- * @brief      convert the register raw data to the vcom
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  reg register raw data
- * @param[out] *v pointer to a vcom buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t st7789_vcom_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
-{
-    if (handle == NULL)                                  /* check handle */
-    {
-        return 2;                                        /* return error */
-    }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (a_st7789_write_byte(handle, ST7789_CMD_IDMON, ST7789_CMD) != 0)        /* write idle mode on command */
     {
-        return 3;                                        /* return error */
-    }
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-    *v = (uint8_t)((float)(reg) * 0.025f + 0.1f);        /* convert raw data to real data */
+        return 1;                                                              /* return error */
+    }
 
-    return 0;                                            /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set lcm control
+ * @brief     set interface pixel format
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] xmy bool value
- * @param[in] xbgr bool value
- * @param[in] xinv bool value
- * @param[in] xmx bool value
- * @param[in] xmh bool value
- * @param[in] xmv bool value
- * @param[in] xgs bool value
+ * @param[in] rgb rgb interface color format
+ * @param[in] control control interface color format
  * @return    status code
  *            - 0 success
- *            - 1 set lcm control failed
+ *            - 1 set interface pixel format failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_lcm_control(st7789_handle_t *handle,
-                               st7789_bool_t xmy,
-                               st7789_bool_t xbgr,
-                               st7789_bool_t xinv,
-                               st7789_bool_t xmx,
-                               st7789_bool_t xmh,
-                               st7789_bool_t xmv,
-                               st7789_bool_t xgs)
+uint8_t st7789_set_interface_pixel_format(st7789_handle_t *handle, st7789_rgb_interface_color_format_t rgb,
+                                          st7789_control_interface_color_format_t control)
 {
-    uint8_t reg;
+    uint8_t data;
 
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_LCMCTRL, ST7789_CMD) != 0)         /* write lcm control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = (xmy << 6) | (xbgr << 5) | (xinv << 4) | (xmx << 3) |
-          (xmh << 2) | (xmv << 1) | (xgs << 0);                                   /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    data = (rgb << 4) | (control << 0);                                         /* set pixel format */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_COLMOD, data) != 0)     /* write interface pixel format */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 1;                                                               /* return error */
     }
+    handle->format = data;                                                      /* set format */
+    a_st7789_kernel_resolve(handle);                                            /* resolve the kernel */
+    a_st7789_framebuffer_check(handle);                                         /* check framebuffer */
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set id code setting
+ * @brief     memory continue write
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *id pointer to an id buffer
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
  * @return    status code
  *            - 0 success
- *            - 1 set id code setting failed
+ *            - 1 memory continue write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_id_code_setting(st7789_handle_t *handle, uint8_t id[3])
+uint8_t st7789_memory_continue_write(st7789_handle_t *handle, uint8_t *data, uint32_t len)
 {
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_IDSET, ST7789_CMD) != 0)           /* write id setting command */
+    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWRC, ST7789_CMD) != 0)       /* write memory write continue command */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
-    if (a_st7789_write_bytes(handle, id, 3, ST7789_DATA) != 0)                    /* write data */
+    if (a_st7789_write_bytes(handle, data, len, ST7789_DATA) != 0)             /* write data */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
 
-        return 1;                                                                 /* return error */
+        return 1;                                                              /* return error */
     }
+    handle->window_valid &= ~ST7789_WINDOW_POINTER;                            /* the pointer is unknown */
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set vdv vrh from
+ * @brief     set tear scanline
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] from vdv and vrh from
+ * @param[in] l tear line
  * @return    status code
  *            - 0 success
- *            - 1 set vdv vrh from failed
+ *            - 1 set tear scanline failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_vdv_vrh_from(st7789_handle_t *handle, st7789_vdv_vrh_from_t from)
+uint8_t st7789_set_tear_scanline(st7789_handle_t *handle, uint16_t l)
 {
     uint8_t buf[2];
 
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VDVVRHEN, ST7789_CMD) != 0)        /* write vdv and vrh command enable command */
+    buf[0] = (l >> 8) & 0xFF;                                                   /* start line msb */
+    buf[1] = (l >> 0) & 0xFF;                                                   /* start line lsb */
+    if (a_st7789_write_register(handle, ST7789_CMD_TESCAN, buf, 2) != 0)        /* write set tear scanline */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        return 1;                                                               /* return error */
+    }
 
-        return 1;                                                                 /* return error */
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set display brightness
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] brightness display brightness
+ * @return    status code
+ *            - 0 success
+ *            - 1 set display brightness failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_display_brightness(st7789_handle_t *handle, uint8_t brightness)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
     }
-    buf[0] = from;                                                                /* set param1 */
-    buf[1] = 0xFF;                                                                /* set param2 */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        return 3;                                                               /* return error */
+    }
 
-        return 1;                                                                 /* return error */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_WRDISBV,
+                                     brightness) != 0)                          /* write display brightness */
+    {
+        return 1;                                                               /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set vrhs
+ * @brief     set display control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] vrhs set vrhs
+ * @param[in] brightness_control_block bool value
+ * @param[in] display_dimming bool value
+ * @param[in] backlight_control bool value
  * @return    status code
  *            - 0 success
- *            - 1 set vrhs failed
+ *            - 1 set display control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vrhs > 0x27
- * @note      0 <= vrhs <= 0x27
+ * @note      none
  */
-uint8_t st7789_set_vrhs(st7789_handle_t *handle, uint8_t vrhs)
+uint8_t st7789_set_display_control(st7789_handle_t *handle, st7789_bool_t brightness_control_block,
+                                   st7789_bool_t display_dimming, st7789_bool_t backlight_control)
 {
-    uint8_t reg;
+    uint8_t data;
 
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                                               /* return error */
     }
-    if (vrhs > 0x27)                                                              /* check vrhs */
-    {
-        handle->debug_print("st7789: vrhs > 0x27.\n");                            /* vrhs > 0x27 */
 
-        return 4;                                                                 /* return error */
+    data = (brightness_control_block << 5) | (display_dimming << 3)
+            | (backlight_control << 2);                                         /* set control data */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_WRCTRLD, data) != 0)    /* write CTRL display */
+    {
+        return 1;                                                               /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VRHS, ST7789_CMD) != 0)            /* write vrh set command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+    return 0;                                                                   /* success return 0 */
+}
 
-        return 1;                                                                 /* return error */
+/**
+ * @brief     set brightness control and color enhancement
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] color_enhancement bool value
+ * @param[in] mode color enhancement mode
+ * @param[in] level color enhancement level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set brightness control and color enhancement failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_brightness_control_and_color_enhancement(st7789_handle_t *handle, st7789_bool_t color_enhancement,
+                                                            st7789_color_enhancement_mode_t mode, st7789_color_enhancement_level_t level)
+{
+    uint8_t data;
+
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
     }
-    reg = vrhs & 0x3F;                                                            /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        return 3;                                                               /* return error */
+    }
 
-        return 1;                                                                 /* return error */
+    data = (color_enhancement << 7) | (level << 4) | (mode << 0);               /* set control data */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_WRCACE, data) != 0)    /* write content adaptive brightness control and color enhancement */
+    {
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief      convert the vrhs to the register raw data
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  v vcom
- * @param[out] *reg pointer to a register raw buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     set cabc minimum brightness
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] brightness display brightness
+ * @return    status code
+ *            - 0 success
+ *            - 1 set cabc minimum brightness failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
  */
-uint8_t st7789_vrhs_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
+uint8_t st7789_set_cabc_minimum_brightness(st7789_handle_t *handle, uint8_t brightness)
 {
-    if (handle == NULL)                           /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                 /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                      /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                 /* return error */
+        return 3;                                                               /* return error */
     }
 
-    *reg = (uint8_t)((v - 3.55f) / 0.05f);        /* convert real data to register data */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_WRCABCMB,
+                                     brightness) != 0)                          /* write CABC minimum brightness */
+    {
+        return 1;                                                               /* return error */
+    }
 
-    return 0;                                     /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the vrhs
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  reg register raw data
- * @param[out] *v pointer to a vcom buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     set ram control
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] ram_mode ram mode
+ * @param[in] display_mode display mode
+ * @param[in] frame_type frame type
+ * @param[in] data_mode data mode
+ * @param[in] bus_width bus width
+ * @param[in] pixel_type pixel type
+ * @return    status code
+ *            - 0 success
+ *            - 1 set ram control failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
  */
-uint8_t st7789_vrhs_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
+uint8_t st7789_set_ram_control(st7789_handle_t *handle,
+                               st7789_ram_access_t ram_mode,
+                               st7789_display_mode_t display_mode,
+                               st7789_frame_type_t frame_type,
+                               st7789_data_mode_t data_mode,
+                               st7789_rgb_bus_width_t bus_width,
+                               st7789_pixel_type_t pixel_type)
 {
-    if (handle == NULL)                                  /* check handle */
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                        /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                        /* return error */
+        return 3;                                                                 /* return error */
     }
 
-    *v = (uint8_t)((float)(reg) * 0.05f + 3.55f);        /* convert raw data to real data */
+    buf[0] = (ram_mode << 4) | (display_mode << 0);                               /* set param1 */
+    buf[1] = (frame_type << 4) | (data_mode << 3) |
+             (bus_width << 2) | (pixel_type << 0);                                /* set param2 */
+    if (a_st7789_write_register(handle, ST7789_CMD_RAMCTRL, buf, 2) != 0)         /* write ram control */
+    {
+        return 1;                                                                 /* return error */
+    }
 
-    return 0;                                            /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set vdv
+ * @brief     set rgb interface control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] vdv set vdv
+ * @param[in] rgb_mode rgb mode
+ * @param[in] rgb_if_mode rgb if enable mode
+ * @param[in] vspl vspl active level
+ * @param[in] hspl hspl active level
+ * @param[in] dpl dpl active level
+ * @param[in] epl epl active level
+ * @param[in] vbp rgb interface vsync back porch setting
+ * @param[in] hbp rgb interface hsync back porch setting
  * @return    status code
  *            - 0 success
- *            - 1 set vdv failed
+ *            - 1 set rgb interface control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 vdv > 0x3F
- * @note      0 <= vdv <= 0x3F
+ *            - 4 vbp > 0x7F
+ *            - 5 hbp > 0x1F
+ * @note      0x02 <= vbp <= 0x7F
+ *            0x02 <= hbp <= 0x1F
  */
-uint8_t st7789_set_vdv(st7789_handle_t *handle, uint8_t vdv)
+uint8_t st7789_set_rgb_interface_control(st7789_handle_t *handle,
+                                         st7789_direct_rgb_mode_t rgb_mode,
+                                         st7789_rgb_if_enable_mode_t rgb_if_mode,
+                                         st7789_pin_level_t vspl,
+                                         st7789_pin_level_t hspl,
+                                         st7789_pin_level_t dpl,
+                                         st7789_pin_level_t epl,
+                                         uint8_t vbp,
+                                         uint8_t hbp)
 {
-    uint8_t reg;
+    uint8_t buf[3];
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2158,24 +2956,25 @@ uint8_t st7789_set_vdv(st7789_handle_t *handle, uint8_t vdv)
     {
         return 3;                                                                 /* return error */
     }
-    if (vdv > 0x3F)                                                               /* check vdv */
+    if (vbp > 0x7F)                                                               /* check vbp */
     {
-        handle->debug_print("st7789: vdv > 0x3F.\n");                             /* vdv > 0x3F */
+        handle->debug_print("st7789: vbp > 0x7F.\n");                             /* vbp > 0x7F */
 
         return 4;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_VDVSET, ST7789_CMD) != 0)          /* write vdv setting command */
+    if (hbp > 0x1F)                                                               /* check hbp */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: hbp > 0x1F.\n");                             /* hbp > 0x1F */
 
-        return 1;                                                                 /* return error */
+        return 5;                                                                 /* return error */
     }
-    reg = vdv & 0x3F;                                                             /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
 
+    buf[0] = (rgb_mode << 7) | (rgb_if_mode << 5) |
+             (vspl << 3) | (hspl << 2) | (dpl << 1) | (epl << 0);                 /* set param1 */
+    buf[1] = vbp & 0x7F;                                                          /* set param2 */
+    buf[2] = hbp & 0x1F;                                                          /* set param3 */
+    if (a_st7789_write_register(handle, ST7789_CMD_RGBCTRL, buf, 3) != 0)         /* write rgb control */
+    {
         return 1;                                                                 /* return error */
     }
 
@@ -2183,74 +2982,43 @@ uint8_t st7789_set_vdv(st7789_handle_t *handle, uint8_t vdv)
 }
 
 /**
- * @brief      convert the vdv to the register raw data
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  v vcom
- * @param[out] *reg pointer to a register raw buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t st7789_vdv_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
-{
-    if (handle == NULL)                           /* check handle */
-    {
-        return 2;                                 /* return error */
-    }
-    if (handle->inited != 1)                      /* check handle initialization */
-    {
-        return 3;                                 /* return error */
-    }
-
-    *reg = (uint8_t)((v + 0.8f) / 0.025f);        /* convert real data to register data */
-
-    return 0;                                     /* success return 0 */
-}
-
-/**
- * @brief      convert the register raw data to the vdv
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  reg register raw data
- * @param[out] *v pointer to a vcom buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t st7789_vdv_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
-{
-    if (handle == NULL)                                  /* check handle */
-    {
-        return 2;                                        /* return error */
-    }
-    if (handle->inited != 1)                             /* check handle initialization */
-    {
-        return 3;                                        /* return error */
-    }
-
-    *v = (uint8_t)((float)(reg) * 0.025f - 0.8f);        /* convert raw data to real data */
-
-    return 0;                                            /* success return 0 */
-}
-
-/**
- * @brief     set vcoms offset
+ * @brief     set porch
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] offset vcoms offset
+ * @param[in] back_porch_normal back porch setting in normal mode
+ * @param[in] front_porch_normal front porch setting in normal mode
+ * @param[in] separate_porch_enable bool value
+ * @param[in] back_porch_idle back porch setting in idle mode
+ * @param[in] front_porch_idle front porch setting in idle mode
+ * @param[in] back_porch_partial back porch setting in partial mode
+ * @param[in] front_porch_partial front porch setting in partial mode
  * @return    status code
  *            - 0 success
- *            - 1 set vcoms offset failed
+ *            - 1 set porch failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 offset > 0x3F
- * @note      0 <= offset <= 0x3F
+ *            - 4 back_porch_normal > 0x7F
+ *            - 5 front_porch_normal > 0x7F
+ *            - 6 back_porch_idle > 0xF
+ *            - 7 front_porch_idle > 0xF
+ *            - 8 back_porch_partial > 0xF
+ *            - 9 front_porch_partial > 0xF
+ * @note      0x01 <= back_porch_normal <= 0x7F
+ *            0x01 <= front_porch_normal <= 0x7F
+ *            0x01 <= back_porch_idle <= 0xF
+ *            0x01 <= front_porch_idle <= 0xF
+ *            0x01 <= back_porch_partial <= 0xF
+ *            0x01 <= front_porch_partial <= 0xF
  */
-uint8_t st7789_set_vcoms_offset(st7789_handle_t *handle, uint8_t offset)
+uint8_t st7789_set_porch(st7789_handle_t *handle,
+                         uint8_t back_porch_normal,
+                         uint8_t front_porch_normal,
+                         st7789_bool_t separate_porch_enable,
+                         uint8_t back_porch_idle,
+                         uint8_t front_porch_idle,
+                         uint8_t back_porch_partial,
+                         uint8_t front_porch_partial)
 {
-    uint8_t reg;
+    uint8_t buf[5];
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2260,99 +3028,84 @@ uint8_t st7789_set_vcoms_offset(st7789_handle_t *handle, uint8_t offset)
     {
         return 3;                                                                 /* return error */
     }
-    if (offset > 0x3F)                                                            /* check offset */
+    if (back_porch_normal > 0x7F)                                                 /* check back_porch_normal */
     {
-        handle->debug_print("st7789: offset > 0x3F.\n");                          /* offset > 0x3F */
+        handle->debug_print("st7789: back_porch_normal > 0x7F.\n");               /* back_porch_normal > 0x7F */
 
         return 4;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_VCMOFSET, ST7789_CMD) != 0)        /* write vcoms offset set command */
+    if (front_porch_normal > 0x7F)                                                /* check front_porch_normal */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: front_porch_normal > 0x7F.\n");              /* front_porch_normal > 0x7F */
 
-        return 1;                                                                 /* return error */
+        return 5;                                                                 /* return error */
     }
-    reg = offset & 0x3F;                                                          /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (back_porch_idle > 0xF)                                                    /* check back_porch_idle */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: back_porch_idle > 0xF.\n");                  /* back_porch_idle > 0xF */
 
-        return 1;                                                                 /* return error */
+        return 6;                                                                 /* return error */
     }
-
-    return 0;                                                                     /* success return 0 */
-}
-
-/**
- * @brief      convert the vcoms offset to the register raw data
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  v vcoms offset
- * @param[out] *reg pointer to a register raw buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t st7789_vcoms_offset_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
-{
-    if (handle == NULL)                           /* check handle */
+    if (front_porch_idle > 0xF)                                                   /* check front_porch_idle */
     {
-        return 2;                                 /* return error */
+        handle->debug_print("st7789: front_porch_idle > 0xF.\n");                 /* front_porch_idle > 0xF */
+
+        return 7;                                                                 /* return error */
     }
-    if (handle->inited != 1)                      /* check handle initialization */
+    if (back_porch_partial > 0xF)                                                 /* check back_porch_partial */
     {
-        return 3;                                 /* return error */
-    }
-
-    *reg = (uint8_t)((v + 0.8f) / 0.025f);        /* convert real data to register data */
-
-    return 0;                                     /* success return 0 */
-}
+        handle->debug_print("st7789: back_porch_partial > 0xF.\n");               /* back_porch_partial > 0xF */
 
-/**
- * @brief      convert the register raw data to the vcoms offset
- * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  reg register raw data
- * @param[out] *v pointer to a vcoms offset buffer
- * @return     status code
- *             - 0 success
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
- */
-uint8_t st7789_vcoms_offset_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
-{
-    if (handle == NULL)                                  /* check handle */
-    {
-        return 2;                                        /* return error */
+        return 8;                                                                 /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (front_porch_partial > 0xF)                                                /* check front_porch_partial */
     {
-        return 3;                                        /* return error */
+        handle->debug_print("st7789: front_porch_partial > 0xF.\n");              /* front_porch_partial > 0xF */
+
+        return 9;                                                                 /* return error */
     }
 
-    *v = (uint8_t)((float)(reg) * 0.025f - 0.8f);        /* convert raw data to real data */
+    buf[0] = back_porch_normal;                                                   /* set param1 */
+    buf[1] = front_porch_normal;                                                  /* set param2 */
+    buf[2] = separate_porch_enable;                                               /* set param3 */
+    buf[3] = (back_porch_idle & 0xF) << 4 | (front_porch_idle & 0xF);             /* set param4 */
+    buf[4] = (back_porch_partial & 0xF) << 4 | (front_porch_partial & 0xF);       /* set param5 */
+    if (a_st7789_write_register(handle, ST7789_CMD_PORCTRL, buf, 5) != 0)         /* write porch control */
+    {
+        return 1;                                                                 /* return error */
+    }
 
-    return 0;                                            /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set frame rate
+ * @brief     set frame rate control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] selection inversion selection
- * @param[in] rate frame rate
+ * @param[in] separate_fr_control bool value
+ * @param[in] div_control frame rate divided control
+ * @param[in] idle_mode inversion idle mode
+ * @param[in] idle_frame_rate idle frame rate
+ * @param[in] partial_mode inversion partial mode
+ * @param[in] partial_frame_rate partial frame rate
  * @return    status code
  *            - 0 success
- *            - 1 set frame rate failed
+ *            - 1 set frame rate control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 idle_frame_rate > 0x1F
+ *            - 5 partial_frame_rate > 0x1F
+ * @note      0 <= idle_frame_rate <= 0x1F
+ *            0 <= partial_frame_rate <= 0x1F
  */
-uint8_t st7789_set_frame_rate(st7789_handle_t *handle, st7789_inversion_selection_t selection, st7789_frame_rate_t rate)
+uint8_t st7789_set_frame_rate_control(st7789_handle_t *handle,
+                                      st7789_bool_t separate_fr_control,
+                                      st7789_frame_rate_divided_control_t div_control,
+                                      st7789_inversion_idle_mode_t idle_mode,
+                                      uint8_t idle_frame_rate,
+                                      st7789_inversion_partial_mode_t partial_mode,
+                                      uint8_t partial_frame_rate)
 {
-    uint8_t reg;
+    uint8_t buf[3];
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2362,18 +3115,24 @@ uint8_t st7789_set_frame_rate(st7789_handle_t *handle, st7789_inversion_selectio
     {
         return 3;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_FRCTR2, ST7789_CMD) != 0)          /* write fr control 2 command */
+    if (idle_frame_rate > 0x1F)                                                   /* check idle_frame_rate */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: idle_frame_rate > 0x1F.\n");                 /* idle_frame_rate > 0x1F */
 
-        return 1;                                                                 /* return error */
+        return 4;                                                                 /* return error */
     }
-    reg = (selection << 5) | (rate << 0);                                         /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (partial_frame_rate > 0x1F)                                                /* check partial_frame_rate */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: partial_frame_rate > 0x1F.\n");              /* partial_frame_rate > 0x1F */
 
+        return 5;                                                                 /* return error */
+    }
+
+    buf[0] = (separate_fr_control << 4) | (div_control << 0);                     /* set param1 */
+    buf[1] = (idle_mode << 5) | ((idle_frame_rate & 0x1F) << 0);                  /* set param2 */
+    buf[2] = (partial_mode << 5) | ((partial_frame_rate & 0x1F) << 0);            /* set param3 */
+    if (a_st7789_write_register(handle, ST7789_CMD_FRCTRL1, buf, 3) != 0)         /* write frame rate control 1 */
+    {
         return 1;                                                                 /* return error */
     }
 
@@ -2381,24 +3140,22 @@ uint8_t st7789_set_frame_rate(st7789_handle_t *handle, st7789_inversion_selectio
 }
 
 /**
- * @brief     set cabc control
+ * @brief     set partial mode control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] led_on bool value
- * @param[in] led_pwm_init bool value
- * @param[in] led_pwm_fix bool value
- * @param[in] led_pwm_polarity bool value
+ * @param[in] level non-display source output level
+ * @param[in] mode non-display area scan mode
+ * @param[in] frequency non-display frame frequency
  * @return    status code
  *            - 0 success
- *            - 1 set cabc control failed
+ *            - 1 set partial mode control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_cabc_control(st7789_handle_t *handle,
-                                st7789_bool_t led_on,
-                                st7789_bool_t led_pwm_init,
-                                st7789_bool_t led_pwm_fix,
-                                st7789_bool_t led_pwm_polarity)
+uint8_t st7789_set_partial_mode_control(st7789_handle_t *handle,
+                                        st7789_non_display_source_output_level_t level,
+                                        st7789_non_display_area_scan_mode_t mode,
+                                        st7789_non_display_frame_frequency_t frequency)
 {
     uint8_t reg;
 
@@ -2411,18 +3168,9 @@ uint8_t st7789_set_cabc_control(st7789_handle_t *handle,
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CABCCTRL, ST7789_CMD) != 0)        /* write cabc control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = (led_on << 3) | (led_pwm_init << 2) |
-          (led_pwm_fix << 1) | (led_pwm_polarity << 0);                           /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    reg = (level << 7) | (mode << 4) | (frequency << 0);                          /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_PARCTRL, reg) != 0)       /* write partial mode control */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2430,17 +3178,18 @@ uint8_t st7789_set_cabc_control(st7789_handle_t *handle,
 }
 
 /**
- * @brief     set pwm frequency
+ * @brief     set gate control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] frequency pwm frequency
+ * @param[in] vghs vghs level
+ * @param[in] vgls vgls level
  * @return    status code
  *            - 0 success
- *            - 1 set pwm frequency failed
+ *            - 1 set gate control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_pwm_frequency(st7789_handle_t *handle, st7789_pwm_frequency_t frequency)
+uint8_t st7789_set_gate_control(st7789_handle_t *handle, st7789_vghs_t vghs, st7789_vgls_t vgls)
 {
     uint8_t reg;
 
@@ -2453,17 +3202,9 @@ uint8_t st7789_set_pwm_frequency(st7789_handle_t *handle, st7789_pwm_frequency_t
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PWMFRSEL, ST7789_CMD) != 0)        /* write pwm frequency selection command */
+    reg = (vghs << 4) | (vgls << 0);                                              /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_GCTRL, reg) != 0)         /* write gate control */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = frequency;                                                              /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2471,21 +3212,26 @@ uint8_t st7789_set_pwm_frequency(st7789_handle_t *handle, st7789_pwm_frequency_t
 }
 
 /**
- * @brief     set power control 1
+ * @brief     set gate on timing adjustment
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] avdd avdd param
- * @param[in] avcl avcl param
- * @param[in] vds vds param
+ * @param[in] gate_on_timing_adjustment gate on timing adjustment
+ * @param[in] gate_off_timing_adjustment_rgb gate off timing adjustment in rgb interface
+ * @param[in] gate_off_timing_adjustment gate off timing adjustment
  * @return    status code
  *            - 0 success
- *            - 1 set power control 1 failed
+ *            - 1 set gate on timing adjustment failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      gate_on_timing_adjustment <= 0x3F
+ *            gate_off_timing_adjustment_rgb <= 0xF
+ *            gate_off_timing_adjustment <= 0xF
  */
-uint8_t st7789_set_power_control_1(st7789_handle_t *handle, st7789_avdd_t avdd, st7789_avcl_t avcl, st7789_vds_t vds)
+uint8_t st7789_set_gate_on_timing_adjustment(st7789_handle_t *handle,
+                                             uint8_t gate_on_timing_adjustment,
+                                             uint8_t gate_off_timing_adjustment_rgb,
+                                             uint8_t gate_off_timing_adjustment)
 {
-    uint8_t buf[2];
+    uint8_t buf[4];
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2495,19 +3241,32 @@ uint8_t st7789_set_power_control_1(st7789_handle_t *handle, st7789_avdd_t avdd,
     {
         return 3;                                                                 /* return error */
     }
+    if (gate_on_timing_adjustment > 0x3F)                                         /* check gate_on_timing_adjustment */
+    {
+        handle->debug_print("st7789: gate_on_timing_adjustment > 0x3F.\n");       /* gate_on_timing_adjustment > 0x3F */
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PWCTRL1, ST7789_CMD) != 0)         /* write power control 1 command */
+        return 4;                                                                 /* return error */
+    }
+    if (gate_off_timing_adjustment_rgb > 0xF)                                     /* check gate_off_timing_adjustment_rgb */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: gate_off_timing_adjustment_rgb > 0xF.\n");   /* gate_off_timing_adjustment_rgb > 0xF */
 
-        return 1;                                                                 /* return error */
+        return 5;                                                                 /* return error */
     }
-    buf[0] = 0xA4;                                                                /* set param 1 */
-    buf[1] = (avdd << 6) | (avcl << 4) | (vds << 0);                              /* set param 2 */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    if (gate_off_timing_adjustment > 0xF)                                         /* check gate_off_timing_adjustment */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+        handle->debug_print("st7789: gate_off_timing_adjustment > 0xF.\n");       /* gate_off_timing_adjustment > 0xF */
+
+        return 6;                                                                 /* return error */
+    }
 
+    buf[0] = 0x2A;                                                                /* set param1 */
+    buf[1] = 0x2B;                                                                /* set param2 */
+    buf[2] = gate_on_timing_adjustment & 0x3F;                                    /* set param3 */
+    buf[3] = ((gate_off_timing_adjustment_rgb & 0xF) << 4) |
+             ((gate_off_timing_adjustment & 0xF) << 0);                           /* set param4 */
+    if (a_st7789_write_register(handle, ST7789_CMD_GTADJ, buf, 4) != 0)           /* write gate on timing adjustment */
+    {
         return 1;                                                                 /* return error */
     }
 
@@ -2515,16 +3274,17 @@ uint8_t st7789_set_power_control_1(st7789_handle_t *handle, st7789_avdd_t avdd,
 }
 
 /**
- * @brief     enable vap van signal output
+ * @brief     enable or disable digital gamma
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 enable vap van signal output failed
+ *            - 1 set digital gamma failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_enable_vap_van_signal_output(st7789_handle_t *handle)
+uint8_t st7789_set_digital_gamma(st7789_handle_t *handle, st7789_bool_t enable)
 {
     uint8_t reg;
 
@@ -2537,17 +3297,9 @@ uint8_t st7789_enable_vap_van_signal_output(st7789_handle_t *handle)
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_VAPVANEN, ST7789_CMD) != 0)        /* write enable vap/van signal output command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = 0x4C;                                                                   /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    reg = enable << 2;                                                            /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_DGMEN, reg) != 0)         /* write digital gamma enable */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2555,19 +3307,20 @@ uint8_t st7789_enable_vap_van_signal_output(st7789_handle_t *handle)
 }
 
 /**
- * @brief     enable or disable command 2
+ * @brief     set vcoms
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] enable bool value
+ * @param[in] vcoms set vcoms
  * @return    status code
  *            - 0 success
- *            - 1 set command 2 enable failed
+ *            - 1 set vcoms failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 vcoms > 0x3F
+ * @note      0 <= vcoms <= 0x3F
  */
-uint8_t st7789_set_command_2_enable(st7789_handle_t *handle, st7789_bool_t enable)
+uint8_t st7789_set_vcoms(st7789_handle_t *handle, uint8_t vcoms)
 {
-    uint8_t buf[4];
+    uint8_t reg;
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2577,21 +3330,16 @@ uint8_t st7789_set_command_2_enable(st7789_handle_t *handle, st7789_bool_t enabl
     {
         return 3;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_CMD2EN, ST7789_CMD) != 0)          /* write command 2 enable command */
+    if (vcoms > 0x3F)                                                             /* check vcoms */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: vcoms > 0x3F.\n");                           /* vcoms > 0x3F */
 
-        return 1;                                                                 /* return error */
+        return 4;                                                                 /* return error */
     }
-    buf[0] = 0x5A;                                                                /* set param 1 */
-    buf[1] = 0x69;                                                                /* set param 2 */
-    buf[2] = 0x02;                                                                /* set param 3 */
-    buf[3] = enable;                                                              /* set param 4 */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                   /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
 
+    reg = vcoms & 0x3F;                                                           /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_VCOMS, reg) != 0)         /* write vcoms setting */
+    {
         return 1;                                                                 /* return error */
     }
 
@@ -2599,56 +3347,87 @@ uint8_t st7789_set_command_2_enable(st7789_handle_t *handle, st7789_bool_t enabl
 }
 
 /**
- * @brief     set positive voltage gamma control
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *param pointer to a param buffer
- * @return    status code
- *            - 0 success
- *            - 1 set positive voltage gamma control failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the vcom to the register raw data
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  v vcom
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t st7789_set_positive_voltage_gamma_control(st7789_handle_t *handle, uint8_t param[14])
+uint8_t st7789_vcom_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
 {
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                           /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                 /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PVGAMCTRL, ST7789_CMD) != 0)       /* write positive voltage gamma control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+    *reg = (uint8_t)((v - 0.1f) / 0.025f);        /* convert real data to register data */
 
-        return 1;                                                                 /* return error */
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the vcom
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *v pointer to a vcom buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_vcom_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
     }
-    if (a_st7789_write_bytes(handle, param, 14, ST7789_DATA) != 0)                /* write data */
+    if (handle->inited != 1)                             /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 3;                                        /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    *v = (uint8_t)((float)(reg) * 0.025f + 0.1f);        /* convert raw data to real data */
+
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief     set negative voltage gamma control
+ * @brief     set lcm control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *param pointer to a param buffer
+ * @param[in] xmy bool value
+ * @param[in] xbgr bool value
+ * @param[in] xinv bool value
+ * @param[in] xmx bool value
+ * @param[in] xmh bool value
+ * @param[in] xmv bool value
+ * @param[in] xgs bool value
  * @return    status code
  *            - 0 success
- *            - 1 set negative voltage gamma control failed
+ *            - 1 set lcm control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_negative_voltage_gamma_control(st7789_handle_t *handle, uint8_t param[14])
+uint8_t st7789_set_lcm_control(st7789_handle_t *handle,
+                               st7789_bool_t xmy,
+                               st7789_bool_t xbgr,
+                               st7789_bool_t xinv,
+                               st7789_bool_t xmx,
+                               st7789_bool_t xmh,
+                               st7789_bool_t xmv,
+                               st7789_bool_t xgs)
 {
+    uint8_t reg;
+
     if (handle == NULL)                                                           /* check handle */
     {
         return 2;                                                                 /* return error */
@@ -2658,16 +3437,10 @@ uint8_t st7789_set_negative_voltage_gamma_control(st7789_handle_t *handle, uint8
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_NVGAMCTRL, ST7789_CMD) != 0)       /* write negative voltage gamma control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    if (a_st7789_write_bytes(handle, param, 14, ST7789_DATA) != 0)                /* write data */
+    reg = (xmy << 6) | (xbgr << 5) | (xinv << 4) | (xmx << 3) |
+          (xmh << 2) | (xmv << 1) | (xgs << 0);                                   /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_LCMCTRL, reg) != 0)       /* write lcm control */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2675,17 +3448,17 @@ uint8_t st7789_set_negative_voltage_gamma_control(st7789_handle_t *handle, uint8
 }
 
 /**
- * @brief     set red digital gamma look up table
+ * @brief     set id code setting
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *param pointer to a param buffer
+ * @param[in] *id pointer to an id buffer
  * @return    status code
  *            - 0 success
- *            - 1 set digital gamma look up table red failed
+ *            - 1 set id code setting failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_digital_gamma_look_up_table_red(st7789_handle_t *handle, uint8_t param[64])
+uint8_t st7789_set_id_code_setting(st7789_handle_t *handle, uint8_t id[3])
 {
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2696,16 +3469,8 @@ uint8_t st7789_set_digital_gamma_look_up_table_red(st7789_handle_t *handle, uint
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_DGMLUTR, ST7789_CMD) != 0)         /* write digital gamma look-up table for red command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    if (a_st7789_write_bytes(handle, param, 64, ST7789_DATA) != 0)                /* write data */
+    if (a_st7789_write_register(handle, ST7789_CMD_IDSET, id, 3) != 0)            /* write id setting */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2713,18 +3478,20 @@ uint8_t st7789_set_digital_gamma_look_up_table_red(st7789_handle_t *handle, uint
 }
 
 /**
- * @brief     set blue digital gamma look up table
+ * @brief     set vdv vrh from
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] *param pointer to a param buffer
+ * @param[in] from vdv and vrh from
  * @return    status code
  *            - 0 success
- *            - 1 set digital gamma look up table blue failed
+ *            - 1 set vdv vrh from failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_digital_gamma_look_up_table_blue(st7789_handle_t *handle, uint8_t param[64])
+uint8_t st7789_set_vdv_vrh_from(st7789_handle_t *handle, st7789_vdv_vrh_from_t from)
 {
+    uint8_t buf[2];
+
     if (handle == NULL)                                                           /* check handle */
     {
         return 2;                                                                 /* return error */
@@ -2734,16 +3501,10 @@ uint8_t st7789_set_digital_gamma_look_up_table_blue(st7789_handle_t *handle, uin
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_DGMLUTB, ST7789_CMD) != 0)         /* write digital gamma look-up table for blue command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    if (a_st7789_write_bytes(handle, param, 64, ST7789_DATA) != 0)                /* write data */
+    buf[0] = from;                                                                /* set param1 */
+    buf[1] = 0xFF;                                                                /* set param2 */
+    if (a_st7789_write_register(handle, ST7789_CMD_VDVVRHEN, buf, 2) != 0)        /* write vdv and vrh command enable */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -2751,29 +3512,20 @@ uint8_t st7789_set_digital_gamma_look_up_table_blue(st7789_handle_t *handle, uin
 }
 
 /**
- * @brief     set gate
+ * @brief     set vrhs
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] gate_line_number gate line number
- * @param[in] first_scan_line_number first scan line number
- * @param[in] mode gate scan mode
- * @param[in] direction gate scan direction
+ * @param[in] vrhs set vrhs
  * @return    status code
  *            - 0 success
- *            - 1 set gate failed
+ *            - 1 set vrhs failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 gate_line_number > 0x3F
- *            - 5 first_scan_line_number > 0x3F
- * @note      0 <= gate_line_number <= 0x3F
- *            0 <= first_scan_line_number 0x3F
+ *            - 4 vrhs > 0x27
+ * @note      0 <= vrhs <= 0x27
  */
-uint8_t st7789_set_gate(st7789_handle_t *handle,
-                        uint8_t gate_line_number,
-                        uint8_t first_scan_line_number,
-                        st7789_gate_scan_mode_t mode,
-                        st7789_gate_scan_direction_t direction)
+uint8_t st7789_set_vrhs(st7789_handle_t *handle, uint8_t vrhs)
 {
-    uint8_t buf[3];
+    uint8_t reg;
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2783,42 +3535,26 @@ uint8_t st7789_set_gate(st7789_handle_t *handle,
     {
         return 3;                                                                 /* return error */
     }
-    if (gate_line_number > 0x3F)                                                  /* check gate_line_number */
+    if (vrhs > 0x27)                                                              /* check vrhs */
     {
-        handle->debug_print("st7789: gate_line_number > 0x3F.\n");                /* gate_line_number > 0x3F */
+        handle->debug_print("st7789: vrhs > 0x27.\n");                            /* vrhs > 0x27 */
 
         return 4;                                                                 /* return error */
     }
-    if (first_scan_line_number > 0x3F)                                            /* check first_scan_line_number */
+
+    reg = vrhs & 0x3F;                                                            /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_VRHS, reg) != 0)          /* write vrh set */
     {
-        handle->debug_print("st7789: first_scan_line_number > 0x3F.\n");          /* first_scan_line_number > 0x3F */
-
-        return 5;                                                                 /* return error */
-    }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_GATECTRL, ST7789_CMD) != 0)        /* write gate control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = gate_line_number;                                                    /* set param 1 */
-    buf[1] = first_scan_line_number;                                              /* set param 2 */
-    buf[2] = 0x10 | (mode << 2) | (direction << 0);                               /* set param 3 */
-    if (a_st7789_write_bytes(handle, buf, 3, ST7789_DATA) != 0)                   /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
-    }
+        return 1;                                                                 /* return error */
+    }
 
     return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief      convert the gate line to the register raw data
+ * @brief      convert the vrhs to the register raw data
  * @param[in]  *handle pointer to an st7789 handle structure
- * @param[in]  l gate line
+ * @param[in]  v vcom
  * @param[out] *reg pointer to a register raw buffer
  * @return     status code
  *             - 0 success
@@ -2826,62 +3562,62 @@ uint8_t st7789_set_gate(st7789_handle_t *handle,
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t st7789_gate_line_convert_to_register(st7789_handle_t *handle, uint16_t l, uint8_t *reg)
+uint8_t st7789_vrhs_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
 {
-    if (handle == NULL)                       /* check handle */
+    if (handle == NULL)                           /* check handle */
     {
-        return 2;                             /* return error */
+        return 2;                                 /* return error */
     }
-    if (handle->inited != 1)                  /* check handle initialization */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        return 3;                             /* return error */
+        return 3;                                 /* return error */
     }
 
-    *reg = (uint8_t)((l / 8) - 1);            /* convert real data to register data */
+    *reg = (uint8_t)((v - 3.55f) / 0.05f);        /* convert real data to register data */
 
-    return 0;                                 /* success return 0 */
+    return 0;                                     /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the gate line
+ * @brief      convert the register raw data to the vrhs
  * @param[in]  *handle pointer to an st7789 handle structure
  * @param[in]  reg register raw data
- * @param[out] *l pointer to a gate line buffer
+ * @param[out] *v pointer to a vcom buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t st7789_gate_line_convert_to_data(st7789_handle_t *handle, uint8_t reg, uint16_t *l)
+uint8_t st7789_vrhs_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
 {
-    if (handle == NULL)                    /* check handle */
+    if (handle == NULL)                                  /* check handle */
     {
-        return 2;                          /* return error */
+        return 2;                                        /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if (handle->inited != 1)                             /* check handle initialization */
     {
-        return 3;                          /* return error */
+        return 3;                                        /* return error */
     }
 
-    *l = (uint8_t)(reg * 8 + 8);           /* convert raw data to real data */
+    *v = (uint8_t)((float)(reg) * 0.05f + 3.55f);        /* convert raw data to real data */
 
-    return 0;                              /* success return 0 */
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief     set spi2 enable
+ * @brief     set vdv
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] date_lane bool value
- * @param[in] command_table_2 bool value
+ * @param[in] vdv set vdv
  * @return    status code
  *            - 0 success
- *            - 1 set spi2 enable failed
+ *            - 1 set vdv failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 vdv > 0x3F
+ * @note      0 <= vdv <= 0x3F
  */
-uint8_t st7789_set_spi2_enable(st7789_handle_t *handle, st7789_bool_t date_lane, st7789_bool_t command_table_2)
+uint8_t st7789_set_vdv(st7789_handle_t *handle, uint8_t vdv)
 {
     uint8_t reg;
 
@@ -2893,18 +3629,16 @@ uint8_t st7789_set_spi2_enable(st7789_handle_t *handle, st7789_bool_t date_lane,
     {
         return 3;                                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_SPI2EN, ST7789_CMD) != 0)          /* write spi2 command */
+    if (vdv > 0x3F)                                                               /* check vdv */
     {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+        handle->debug_print("st7789: vdv > 0x3F.\n");                             /* vdv > 0x3F */
 
-        return 1;                                                                 /* return error */
+        return 4;                                                                 /* return error */
     }
-    reg = (date_lane << 4) | (command_table_2 << 0);                              /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
 
+    reg = vdv & 0x3F;                                                             /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_VDVSET, reg) != 0)        /* write vdv setting */
+    {
         return 1;                                                                 /* return error */
     }
 
@@ -2912,69 +3646,74 @@ uint8_t st7789_set_spi2_enable(st7789_handle_t *handle, st7789_bool_t date_lane,
 }
 
 /**
- * @brief     set power control 2
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] sbclk sbclk div
- * @param[in] stp14ck stp14ck div
- * @return    status code
- *            - 0 success
- *            - 1 set power control 2 failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the vdv to the register raw data
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  v vcom
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t st7789_set_power_control_2(st7789_handle_t *handle, st7789_sbclk_div_t sbclk, st7789_stp14ck_div_t stp14ck)
+uint8_t st7789_vdv_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
 {
-    uint8_t reg;
-
-    if (handle == NULL)                                                           /* check handle */
+    if (handle == NULL)                           /* check handle */
     {
-        return 2;                                                                 /* return error */
+        return 2;                                 /* return error */
     }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        return 3;                                                                 /* return error */
+        return 3;                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PWCTRL2, ST7789_CMD) != 0)         /* write power control 2 command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+    *reg = (uint8_t)((v + 0.8f) / 0.025f);        /* convert real data to register data */
 
-        return 1;                                                                 /* return error */
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the vdv
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *v pointer to a vcom buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_vdv_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
     }
-    reg = (sbclk << 4) | (stp14ck << 0);                                          /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    if (handle->inited != 1)                             /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 3;                                        /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    *v = (uint8_t)((float)(reg) * 0.025f - 0.8f);        /* convert raw data to real data */
+
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief     set equalize time control
+ * @brief     set vcoms offset
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] source_equalize_time source equalize time
- * @param[in] source_pre_drive_time source pre drive time
- * @param[in] gate_equalize_time gate equalize time
+ * @param[in] offset vcoms offset
  * @return    status code
  *            - 0 success
- *            - 1 set equalize time control failed
+ *            - 1 set vcoms offset failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 source_equalize_time > 0x1F
- *            - 5 source_pre_drive_time > 0x1F
- *            - 6 gate_equalize_time > 0xF
- * @note      0 <= source_equalize_time <= 0x1F
+ *            - 4 offset > 0x3F
+ * @note      0 <= offset <= 0x3F
  */
-uint8_t st7789_set_equalize_time_control(st7789_handle_t *handle,
-                                         uint8_t source_equalize_time,
-                                         uint8_t source_pre_drive_time,
-                                         uint8_t gate_equalize_time)
+uint8_t st7789_set_vcoms_offset(st7789_handle_t *handle, uint8_t offset)
 {
-    uint8_t buf[3];
+    uint8_t reg;
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -2984,55 +3723,89 @@ uint8_t st7789_set_equalize_time_control(st7789_handle_t *handle,
     {
         return 3;                                                                 /* return error */
     }
-    if (source_equalize_time > 0x1F)                                              /* check source_equalize_time */
+    if (offset > 0x3F)                                                            /* check offset */
     {
-        handle->debug_print("st7789: source_equalize_time > 0x1F.\n");            /* source_equalize_time > 0x1F */
+        handle->debug_print("st7789: offset > 0x3F.\n");                          /* offset > 0x3F */
 
         return 4;                                                                 /* return error */
     }
-    if (source_pre_drive_time > 0x1F)                                             /* check source_pre_drive_time */
+
+    reg = offset & 0x3F;                                                          /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_VCMOFSET, reg) != 0)      /* write vcoms offset set */
     {
-        handle->debug_print("st7789: source_pre_drive_time > 0x1F.\n");           /* source_pre_drive_time > 0x1F */
+        return 1;                                                                 /* return error */
+    }
 
-        return 5;                                                                 /* return error */
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the vcoms offset to the register raw data
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  v vcoms offset
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_vcoms_offset_convert_to_register(st7789_handle_t *handle, float v, uint8_t *reg)
+{
+    if (handle == NULL)                           /* check handle */
+    {
+        return 2;                                 /* return error */
     }
-    if (gate_equalize_time > 0xF)                                                 /* check gate_equalize_time */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        handle->debug_print("st7789: gate_equalize_time > 0xF.\n");               /* gate_equalize_time > 0xF */
-
-        return 6;                                                                 /* return error */
+        return 3;                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_EQCTRL, ST7789_CMD) != 0)          /* write equalize time control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+    *reg = (uint8_t)((v + 0.8f) / 0.025f);        /* convert real data to register data */
 
-        return 1;                                                                 /* return error */
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the vcoms offset
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *v pointer to a vcoms offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_vcoms_offset_convert_to_data(st7789_handle_t *handle, uint8_t reg, float *v)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
     }
-    buf[0] = source_equalize_time;                                                /* set param 1 */
-    buf[1] = source_pre_drive_time;                                               /* set param 2 */
-    buf[2] = gate_equalize_time;                                                  /* set param 3 */
-    if (a_st7789_write_bytes(handle, buf, 3, ST7789_DATA) != 0)                   /* write data */
+    if (handle->inited != 1)                             /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
-        return 1;                                                                 /* return error */
+        return 3;                                        /* return error */
     }
 
-    return 0;                                                                     /* success return 0 */
+    *v = (uint8_t)((float)(reg) * 0.025f - 0.8f);        /* convert raw data to real data */
+
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief     set program mode control
+ * @brief     set frame rate
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] selection inversion selection
+ * @param[in] rate frame rate
  * @return    status code
  *            - 0 success
- *            - 1 set program mode control failed
+ *            - 1 set frame rate failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_program_mode_control(st7789_handle_t *handle)
+uint8_t st7789_set_frame_rate(st7789_handle_t *handle, st7789_inversion_selection_t selection, st7789_frame_rate_t rate)
 {
     uint8_t reg;
 
@@ -3045,17 +3818,9 @@ uint8_t st7789_set_program_mode_control(st7789_handle_t *handle)
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PROMCTRL, ST7789_CMD) != 0)        /* write program control command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    reg = 0x01;                                                                   /* set param */
-    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    reg = (selection << 5) | (rate << 0);                                         /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_FRCTR2, reg) != 0)        /* write fr control 2 */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -3063,19 +3828,26 @@ uint8_t st7789_set_program_mode_control(st7789_handle_t *handle)
 }
 
 /**
- * @brief     enable or disable program mode
+ * @brief     set cabc control
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] enable bool value
+ * @param[in] led_on bool value
+ * @param[in] led_pwm_init bool value
+ * @param[in] led_pwm_fix bool value
+ * @param[in] led_pwm_polarity bool value
  * @return    status code
  *            - 0 success
- *            - 1 set program mode enable failed
+ *            - 1 set cabc control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_program_mode_enable(st7789_handle_t *handle, st7789_bool_t enable)
+uint8_t st7789_set_cabc_control(st7789_handle_t *handle,
+                                st7789_bool_t led_on,
+                                st7789_bool_t led_pwm_init,
+                                st7789_bool_t led_pwm_fix,
+                                st7789_bool_t led_pwm_polarity)
 {
-    uint8_t buf[4];
+    uint8_t reg;
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -3086,20 +3858,10 @@ uint8_t st7789_set_program_mode_enable(st7789_handle_t *handle, st7789_bool_t en
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PROMEN, ST7789_CMD) != 0)          /* write program mode enable command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = 0x5A;                                                                /* set param 1 */
-    buf[1] = 0x69;                                                                /* set param 2 */
-    buf[2] = 0xEE;                                                                /* set param 3 */
-    buf[3] = enable << 2;                                                         /* set param 4 */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                   /* write data */
+    reg = (led_on << 3) | (led_pwm_init << 2) |
+          (led_pwm_fix << 1) | (led_pwm_polarity << 0);                           /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_CABCCTRL, reg) != 0)      /* write cabc control */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -3107,20 +3869,19 @@ uint8_t st7789_set_program_mode_enable(st7789_handle_t *handle, st7789_bool_t en
 }
 
 /**
- * @brief     set nvm setting
+ * @brief     set pwm frequency
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] addr nvm address
- * @param[in] data nvm set data
+ * @param[in] frequency pwm frequency
  * @return    status code
  *            - 0 success
- *            - 1 set nvm setting failed
+ *            - 1 set pwm frequency failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_nvm_setting(st7789_handle_t *handle, uint8_t addr, uint8_t data)
+uint8_t st7789_set_pwm_frequency(st7789_handle_t *handle, st7789_pwm_frequency_t frequency)
 {
-    uint8_t buf[2];
+    uint8_t reg;
 
     if (handle == NULL)                                                           /* check handle */
     {
@@ -3131,18 +3892,9 @@ uint8_t st7789_set_nvm_setting(st7789_handle_t *handle, uint8_t addr, uint8_t da
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_NVMSET, ST7789_CMD) != 0)          /* write nvm setting command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = addr;                                                                /* set param 1 */
-    buf[1] = data;                                                                /* set param 2 */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    reg = frequency;                                                              /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_PWMFRSEL, reg) != 0)      /* write pwm frequency selection */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -3150,16 +3902,19 @@ uint8_t st7789_set_nvm_setting(st7789_handle_t *handle, uint8_t addr, uint8_t da
 }
 
 /**
- * @brief     set program action
+ * @brief     set power control 1
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] avdd avdd param
+ * @param[in] avcl avcl param
+ * @param[in] vds vds param
  * @return    status code
  *            - 0 success
- *            - 1 set program action failed
+ *            - 1 set power control 1 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_set_program_action(st7789_handle_t *handle)
+uint8_t st7789_set_power_control_1(st7789_handle_t *handle, st7789_avdd_t avdd, st7789_avcl_t avcl, st7789_vds_t vds)
 {
     uint8_t buf[2];
 
@@ -3172,18 +3927,10 @@ uint8_t st7789_set_program_action(st7789_handle_t *handle)
         return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_PROMACT, ST7789_CMD) != 0)         /* write program action command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
-
-        return 1;                                                                 /* return error */
-    }
-    buf[0] = 0x29;                                                                /* set param 1 */
-    buf[1] = 0xA5;                                                                /* set param 2 */
-    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    buf[0] = 0xA4;                                                                /* set param 1 */
+    buf[1] = (avdd << 6) | (avcl << 4) | (vds << 0);                              /* set param 2 */
+    if (a_st7789_write_register(handle, ST7789_CMD_PWCTRL1, buf, 2) != 0)         /* write power control 1 */
     {
-        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
-
         return 1;                                                                 /* return error */
     }
 
@@ -3191,268 +3938,5707 @@ uint8_t st7789_set_program_action(st7789_handle_t *handle)
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     enable vap van signal output
  * @param[in] *handle pointer to an st7789 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 spi initialization failed
+ *            - 1 enable vap van signal output failed
  *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 reset failed
- *            - 5 command && data init failed
+ *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_init(st7789_handle_t *handle)
+uint8_t st7789_enable_vap_van_signal_output(st7789_handle_t *handle)
 {
-    if (handle == NULL)                                                         /* check handle */
+    uint8_t reg;
+
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                                               /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->debug_print == NULL)                                            /* check debug_print */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                                               /* return error */
+        return 3;                                                                 /* return error */
     }
-    if (handle->spi_init == NULL)                                               /* check spi_init */
-    {
-        handle->debug_print("st7789: spi_init is null.\n");                     /* spi_init is null */
 
-        return 3;                                                               /* return error */
-    }
-    if (handle->spi_deinit == NULL)                                             /* check spi_deinit */
+    reg = 0x4C;                                                                   /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_VAPVANEN, reg) != 0)      /* write enable vap/van signal output */
     {
-        handle->debug_print("st7789: spi_deinit is null.\n");                   /* spi_deinit is null */
-
-        return 3;                                                               /* return error */
+        return 1;                                                                 /* return error */
     }
-    if (handle->spi_write_cmd == NULL)                                          /* check spi_write_cmd */
-    {
-        handle->debug_print("st7789: spi_write_cmd is null.\n");                /* spi_init is null */
 
-        return 3;                                                               /* return error */
-    }
-    if (handle->cmd_data_gpio_init == NULL)                                     /* check cmd_data_gpio_init */
-    {
-        handle->debug_print("st7789: cmd_data_gpio_init is null.\n");           /* cmd_data_gpio_init is null */
+    return 0;                                                                     /* success return 0 */
+}
 
-        return 3;                                                               /* return error */
-    }
-    if (handle->cmd_data_gpio_deinit == NULL)                                   /* check cmd_data_gpio_deinit */
-    {
-        handle->debug_print("st7789: cmd_data_gpio_deinit is null.\n");         /* cmd_data_gpio_deinit is null */
+/**
+ * @brief     enable or disable command 2
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set command 2 enable failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_command_2_enable(st7789_handle_t *handle, st7789_bool_t enable)
+{
+    uint8_t buf[4];
 
-        return 3;                                                               /* return error */
-    }
-    if (handle->cmd_data_gpio_write == NULL)                                    /* check cmd_data_gpio_write */
+    if (handle == NULL)                                                           /* check handle */
     {
-        handle->debug_print("st7789: cmd_data_gpio_write is null.\n");          /* cmd_data_gpio_write is null */
-
-        return 3;                                                               /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->reset_gpio_init == NULL)                                        /* check reset_gpio_init */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        handle->debug_print("st7789: reset_gpio_init is null.\n");              /* reset_gpio_init is null */
-
-        return 3;                                                               /* return error */
+        return 3;                                                                 /* return error */
     }
-    if (handle->reset_gpio_deinit == NULL)                                      /* check reset_gpio_deinit */
-    {
-        handle->debug_print("st7789: reset_gpio_deinit is null.\n");            /* reset_gpio_deinit is null */
 
-        return 3;                                                               /* return error */
-    }
-    if (handle->reset_gpio_write == NULL)                                       /* check reset_gpio_write */
+    if (a_st7789_write_byte(handle, ST7789_CMD_CMD2EN, ST7789_CMD) != 0)          /* write command 2 enable command */
     {
-        handle->debug_print("st7789: reset_gpio_write is null.\n");             /* reset_gpio_write is null */
+        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
 
-        return 3;                                                               /* return error */
+        return 1;                                                                 /* return error */
     }
-    if (handle->delay_ms == NULL)                                               /* check delay_ms */
+    buf[0] = 0x5A;                                                                /* set param 1 */
+    buf[1] = 0x69;                                                                /* set param 2 */
+    buf[2] = 0x02;                                                                /* set param 3 */
+    buf[3] = enable;                                                              /* set param 4 */
+    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                   /* write data */
     {
-        handle->debug_print("st7789: delay_ms is null.\n");                     /* delay_ms is null */
+        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
 
-        return 3;                                                               /* return error */
+        return 1;                                                                 /* return error */
     }
 
-    if (handle->cmd_data_gpio_init() != 0)                                      /* check cmd_data_gpio_init */
-    {
-        handle->debug_print("st7789: cmd data gpio init failed.\n");            /* cmd data gpio init failed */
+    return 0;                                                                     /* success return 0 */
+}
 
-        return 5;                                                               /* return error */
-    }
-    if (handle->reset_gpio_init() != 0)                                         /* reset gpio init */
+/**
+ * @brief     set positive voltage gamma control
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *param pointer to a param buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 set positive voltage gamma control failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_positive_voltage_gamma_control(st7789_handle_t *handle, uint8_t param[14])
+{
+    if (handle == NULL)                                                           /* check handle */
     {
-        handle->debug_print("st7789: reset gpio init failed.\n");               /* reset gpio init failed */
-        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
-
-        return 4;                                                               /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->reset_gpio_write(0) != 0)                                       /* write 0 */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        handle->debug_print("st7789: reset gpio write failed.\n");              /* reset gpio write failed */
-        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
-        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
-
-        return 4;                                                               /* return error */
+        return 3;                                                                 /* return error */
     }
-    handle->delay_ms(25);                                                       /* over 10 us */
-    if (handle->reset_gpio_write(1) != 0)                                       /* write 1 */
-    {
-        handle->debug_print("st7789: reset gpio write failed.\n");              /* reset gpio write failed */
-        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
-        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
 
-        return 4;                                                               /* return error */
-    }
-    handle->delay_ms(125);                                                      /* over 120 ms */
-    if (handle->spi_init() != 0)                                                /* spi init */
+    if (a_st7789_write_register(handle, ST7789_CMD_PVGAMCTRL, param, 14) != 0)    /* write positive voltage gamma control */
     {
-        handle->debug_print("st7789: spi init failed.\n");                      /* spi init failed */
-        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
-        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
-
-        return 1;                                                               /* return error */
+        return 1;                                                                 /* return error */
     }
-    handle->inited = 1;                                                         /* flag inited */
 
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     set negative voltage gamma control
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *param pointer to a param buffer
  * @return    status code
  *            - 0 success
- *            - 1 spi deinit failed
+ *            - 1 set negative voltage gamma control failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 power down failed
- *            - 5 reset gpio deinit failed
- *            - 6 command && data deinit failed
  * @note      none
  */
-uint8_t st7789_deinit(st7789_handle_t *handle)
+uint8_t st7789_set_negative_voltage_gamma_control(st7789_handle_t *handle, uint8_t param[14])
 {
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                                                                 /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_SLPIN, ST7789_CMD) != 0)        /* write sleep in command */
+    if (a_st7789_write_register(handle, ST7789_CMD_NVGAMCTRL, param, 14) != 0)    /* write negative voltage gamma control */
     {
-        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
-
-        return 1;                                                              /* return error */
+        return 1;                                                                 /* return error */
     }
-    if (handle->reset_gpio_deinit() != 0)                                      /* reset gpio deinit */
-    {
-        handle->debug_print("st7789: reset gpio deinit failed.\n");            /* reset gpio deinit failed */
 
-        return 5;                                                              /* return error */
-    }
-    if (handle->cmd_data_gpio_deinit() != 0)                                   /* cmd data gpio deinit */
-    {
-        handle->debug_print("st7789: cmd data gpio deinit failed.\n");         /* cmd data gpio deinit failed */
+    return 0;                                                                     /* success return 0 */
+}
 
-        return 6;                                                              /* return error */
-    }
-    if (handle->spi_deinit() != 0)                                             /* spi deinit */
+/**
+ * @brief     set red digital gamma look up table
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *param pointer to a param buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 set digital gamma look up table red failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_digital_gamma_look_up_table_red(st7789_handle_t *handle, uint8_t param[64])
+{
+    if (handle == NULL)                                                           /* check handle */
     {
-        handle->debug_print("st7789: spi deinit failed.\n");                   /* spi deinit failed */
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
 
-        return 1;                                                              /* return error */
+    if (a_st7789_write_register(handle, ST7789_CMD_DGMLUTR, param, 64) != 0)      /* write digital gamma look-up table for red */
+    {
+        return 1;                                                                 /* return error */
     }
-    handle->inited = 0;                                                        /* flag close */
 
-    return 0;                                                                  /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set column
+ * @brief     set blue digital gamma look up table
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] column screen column
+ * @param[in] *param pointer to a param buffer
  * @return    status code
  *            - 0 success
+ *            - 1 set digital gamma look up table blue failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 column > 240
  * @note      none
  */
-uint8_t st7789_set_column(st7789_handle_t *handle, uint16_t column)
+uint8_t st7789_set_digital_gamma_look_up_table_blue(st7789_handle_t *handle, uint8_t param[64])
 {
-    if (handle == NULL)                                        /* check handle */
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                              /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                   /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                              /* return error */
+        return 3;                                                                 /* return error */
     }
-    if (column > 240)                                          /* check column */
+
+    if (a_st7789_write_register(handle, ST7789_CMD_DGMLUTB, param, 64) != 0)      /* write digital gamma look-up table for blue */
     {
-        handle->debug_print("st7789: column > 240.\n");        /* column > 240 */
+        return 1;                                                                 /* return error */
+    }
 
-        return 4;                                              /* return error */
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set gate
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] gate_line_number gate line number
+ * @param[in] first_scan_line_number first scan line number
+ * @param[in] mode gate scan mode
+ * @param[in] direction gate scan direction
+ * @return    status code
+ *            - 0 success
+ *            - 1 set gate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 gate_line_number > 0x3F
+ *            - 5 first_scan_line_number > 0x3F
+ * @note      0 <= gate_line_number <= 0x3F
+ *            0 <= first_scan_line_number 0x3F
+ */
+uint8_t st7789_set_gate(st7789_handle_t *handle,
+                        uint8_t gate_line_number,
+                        uint8_t first_scan_line_number,
+                        st7789_gate_scan_mode_t mode,
+                        st7789_gate_scan_direction_t direction)
+{
+    uint8_t buf[3];
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
     }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (gate_line_number > 0x3F)                                                  /* check gate_line_number */
+    {
+        handle->debug_print("st7789: gate_line_number > 0x3F.\n");                /* gate_line_number > 0x3F */
 
-    handle->column = column;                                   /* set column */
+        return 4;                                                                 /* return error */
+    }
+    if (first_scan_line_number > 0x3F)                                            /* check first_scan_line_number */
+    {
+        handle->debug_print("st7789: first_scan_line_number > 0x3F.\n");          /* first_scan_line_number > 0x3F */
 
-    return 0;                                                  /* success return 0 */
+        return 5;                                                                 /* return error */
+    }
+
+    buf[0] = gate_line_number;                                                    /* set param 1 */
+    buf[1] = first_scan_line_number;                                              /* set param 2 */
+    buf[2] = 0x10 | (mode << 2) | (direction << 0);                               /* set param 3 */
+    if (a_st7789_write_register(handle, ST7789_CMD_GATECTRL, buf, 3) != 0)        /* write gate control */
+    {
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set row
+ * @brief      convert the gate line to the register raw data
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  l gate line
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_gate_line_convert_to_register(st7789_handle_t *handle, uint16_t l, uint8_t *reg)
+{
+    if (handle == NULL)                       /* check handle */
+    {
+        return 2;                             /* return error */
+    }
+    if (handle->inited != 1)                  /* check handle initialization */
+    {
+        return 3;                             /* return error */
+    }
+
+    *reg = (uint8_t)((l / 8) - 1);            /* convert real data to register data */
+
+    return 0;                                 /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the gate line
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *l pointer to a gate line buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_gate_line_convert_to_data(st7789_handle_t *handle, uint8_t reg, uint16_t *l)
+{
+    if (handle == NULL)                    /* check handle */
+    {
+        return 2;                          /* return error */
+    }
+    if (handle->inited != 1)               /* check handle initialization */
+    {
+        return 3;                          /* return error */
+    }
+
+    *l = (uint8_t)(reg * 8 + 8);           /* convert raw data to real data */
+
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief     set spi2 enable
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] row screen row
+ * @param[in] date_lane bool value
+ * @param[in] command_table_2 bool value
  * @return    status code
  *            - 0 success
+ *            - 1 set spi2 enable failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 row > 320
  * @note      none
  */
-uint8_t st7789_set_row(st7789_handle_t *handle, uint16_t row)
+uint8_t st7789_set_spi2_enable(st7789_handle_t *handle, st7789_bool_t date_lane, st7789_bool_t command_table_2)
 {
-    if (handle == NULL)                                        /* check handle */
+    uint8_t reg;
+
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                              /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                   /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                              /* return error */
+        return 3;                                                                 /* return error */
+    }
+
+    reg = (date_lane << 4) | (command_table_2 << 0);                              /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_SPI2EN, reg) != 0)        /* write spi2 */
+    {
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set power control 2
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] sbclk sbclk div
+ * @param[in] stp14ck stp14ck div
+ * @return    status code
+ *            - 0 success
+ *            - 1 set power control 2 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_power_control_2(st7789_handle_t *handle, st7789_sbclk_div_t sbclk, st7789_stp14ck_div_t stp14ck)
+{
+    uint8_t reg;
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+
+    reg = (sbclk << 4) | (stp14ck << 0);                                          /* set param */
+    if (a_st7789_write_register_byte(handle, ST7789_CMD_PWCTRL2, reg) != 0)       /* write power control 2 */
+    {
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set equalize time control
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] source_equalize_time source equalize time
+ * @param[in] source_pre_drive_time source pre drive time
+ * @param[in] gate_equalize_time gate equalize time
+ * @return    status code
+ *            - 0 success
+ *            - 1 set equalize time control failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 source_equalize_time > 0x1F
+ *            - 5 source_pre_drive_time > 0x1F
+ *            - 6 gate_equalize_time > 0xF
+ * @note      0 <= source_equalize_time <= 0x1F
+ */
+uint8_t st7789_set_equalize_time_control(st7789_handle_t *handle,
+                                         uint8_t source_equalize_time,
+                                         uint8_t source_pre_drive_time,
+                                         uint8_t gate_equalize_time)
+{
+    uint8_t buf[3];
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (source_equalize_time > 0x1F)                                              /* check source_equalize_time */
+    {
+        handle->debug_print("st7789: source_equalize_time > 0x1F.\n");            /* source_equalize_time > 0x1F */
+
+        return 4;                                                                 /* return error */
+    }
+    if (source_pre_drive_time > 0x1F)                                             /* check source_pre_drive_time */
+    {
+        handle->debug_print("st7789: source_pre_drive_time > 0x1F.\n");           /* source_pre_drive_time > 0x1F */
+
+        return 5;                                                                 /* return error */
+    }
+    if (gate_equalize_time > 0xF)                                                 /* check gate_equalize_time */
+    {
+        handle->debug_print("st7789: gate_equalize_time > 0xF.\n");               /* gate_equalize_time > 0xF */
+
+        return 6;                                                                 /* return error */
+    }
+
+    buf[0] = source_equalize_time;                                                /* set param 1 */
+    buf[1] = source_pre_drive_time;                                               /* set param 2 */
+    buf[2] = gate_equalize_time;                                                  /* set param 3 */
+    if (a_st7789_write_register(handle, ST7789_CMD_EQCTRL, buf, 3) != 0)          /* write equalize time control */
+    {
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set program mode control
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set program mode control failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_program_mode_control(st7789_handle_t *handle)
+{
+    uint8_t reg;
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_PROMCTRL, ST7789_CMD) != 0)        /* write program control command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+
+        return 1;                                                                 /* return error */
+    }
+    reg = 0x01;                                                                   /* set param */
+    if (a_st7789_write_byte(handle, reg, ST7789_DATA) != 0)                       /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable program mode
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set program mode enable failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_program_mode_enable(st7789_handle_t *handle, st7789_bool_t enable)
+{
+    uint8_t buf[4];
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_PROMEN, ST7789_CMD) != 0)          /* write program mode enable command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+
+        return 1;                                                                 /* return error */
+    }
+    buf[0] = 0x5A;                                                                /* set param 1 */
+    buf[1] = 0x69;                                                                /* set param 2 */
+    buf[2] = 0xEE;                                                                /* set param 3 */
+    buf[3] = enable << 2;                                                         /* set param 4 */
+    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                   /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set nvm setting
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] addr nvm address
+ * @param[in] data nvm set data
+ * @return    status code
+ *            - 0 success
+ *            - 1 set nvm setting failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_nvm_setting(st7789_handle_t *handle, uint8_t addr, uint8_t data)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_NVMSET, ST7789_CMD) != 0)          /* write nvm setting command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+
+        return 1;                                                                 /* return error */
+    }
+    buf[0] = addr;                                                                /* set param 1 */
+    buf[1] = data;                                                                /* set param 2 */
+    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set program action
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set program action failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_program_action(st7789_handle_t *handle)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_PROMACT, ST7789_CMD) != 0)         /* write program action command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                   /* write command failed */
+
+        return 1;                                                                 /* return error */
+    }
+    buf[0] = 0x29;                                                                /* set param 1 */
+    buf[1] = 0xA5;                                                                /* set param 2 */
+    if (a_st7789_write_bytes(handle, buf, 2, ST7789_DATA) != 0)                   /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                      /* write data failed */
+
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     initialize the handle and start the hardware reset
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ *            - 5 command && data init failed
+ * @note      the reset pin is left low and the panel waits are run by the caller
+ */
+static uint8_t a_st7789_init(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->debug_print == NULL)                                            /* check debug_print */
+    {
+        return 3;                                                               /* return error */
+    }
+    if (handle->spi_init == NULL)                                               /* check spi_init */
+    {
+        handle->debug_print("st7789: spi_init is null.\n");                     /* spi_init is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->spi_deinit == NULL)                                             /* check spi_deinit */
+    {
+        handle->debug_print("st7789: spi_deinit is null.\n");                   /* spi_deinit is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->spi_write_cmd == NULL)                                          /* check spi_write_cmd */
+    {
+        handle->debug_print("st7789: spi_write_cmd is null.\n");                /* spi_init is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->cmd_data_gpio_init == NULL)                                     /* check cmd_data_gpio_init */
+    {
+        handle->debug_print("st7789: cmd_data_gpio_init is null.\n");           /* cmd_data_gpio_init is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->cmd_data_gpio_deinit == NULL)                                   /* check cmd_data_gpio_deinit */
+    {
+        handle->debug_print("st7789: cmd_data_gpio_deinit is null.\n");         /* cmd_data_gpio_deinit is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->cmd_data_gpio_write == NULL)                                    /* check cmd_data_gpio_write */
+    {
+        handle->debug_print("st7789: cmd_data_gpio_write is null.\n");          /* cmd_data_gpio_write is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->reset_gpio_init == NULL)                                        /* check reset_gpio_init */
+    {
+        handle->debug_print("st7789: reset_gpio_init is null.\n");              /* reset_gpio_init is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->reset_gpio_deinit == NULL)                                      /* check reset_gpio_deinit */
+    {
+        handle->debug_print("st7789: reset_gpio_deinit is null.\n");            /* reset_gpio_deinit is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->reset_gpio_write == NULL)                                       /* check reset_gpio_write */
+    {
+        handle->debug_print("st7789: reset_gpio_write is null.\n");             /* reset_gpio_write is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->delay_ms == NULL)                                               /* check delay_ms */
+    {
+        handle->debug_print("st7789: delay_ms is null.\n");                     /* delay_ms is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->buf == NULL)                                                    /* check buffer */
+    {
+#if (ST7789_BUFFER_SIZE != 0)
+        handle->buf = handle->inner_buf;                                        /* use the inner buffer */
+        handle->buf_size = ST7789_BUFFER_SIZE;                                  /* set size */
+#else
+        handle->debug_print("st7789: buf is null.\n");                          /* buf is null */
+
+        return 3;                                                               /* return error */
+#endif
+    }
+
+    if (handle->cmd_data_gpio_init() != 0)                                      /* check cmd_data_gpio_init */
+    {
+        handle->debug_print("st7789: cmd data gpio init failed.\n");            /* cmd data gpio init failed */
+
+        return 5;                                                               /* return error */
+    }
+    if (handle->reset_gpio_init() != 0)                                         /* reset gpio init */
+    {
+        handle->debug_print("st7789: reset gpio init failed.\n");               /* reset gpio init failed */
+        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
+
+        return 4;                                                               /* return error */
+    }
+    if (handle->reset_gpio_write(0) != 0)                                       /* write 0 */
+    {
+        handle->debug_print("st7789: reset gpio write failed.\n");              /* reset gpio write failed */
+        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
+        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
+
+        return 4;                                                               /* return error */
+    }
+    if (handle->spi_init() != 0)                                                /* spi init */
+    {
+        handle->debug_print("st7789: spi init failed.\n");                      /* spi init failed */
+        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
+        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
+
+        return 1;                                                               /* return error */
+    }
+    a_st7789_panel_start(handle, ST7789_WAIT_RESET_LOW, ST7789_RESET_LOW_MS);   /* hold the reset */
+    handle->framebuffer = NULL;                                                 /* no framebuffer */
+    handle->framebuffer_size = 0;                                               /* clear size */
+    handle->dirty_num = 0;                                                      /* clear dirty areas */
+    handle->async_busy = 0;                                                     /* no async write */
+    handle->async_res = 0;                                                      /* no async result */
+    handle->buf_half = 0;                                                       /* the first half */
+    a_st7789_kernel_resolve(handle);                                            /* resolve the kernel */
+    handle->scroll_top = 0;                                                     /* no top fixed area */
+    handle->scroll_area = ST7789_MEMORY_ROW;                                    /* whole memory */
+    handle->scroll_start = 0;                                                   /* no scrolling */
+    a_st7789_invalidate(handle);                                                /* the caches are unknown */
+    handle->inited = 1;                                                         /* flag inited */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ *            - 5 command && data init failed
+ * @note      none
+ */
+uint8_t st7789_init(st7789_handle_t *handle)
+{
+    uint8_t res;
+
+    res = a_st7789_init(handle);                                                /* init and start the reset */
+    if (res != 0)                                                               /* check result */
+    {
+        return res;                                                             /* return error */
+    }
+    if (a_st7789_panel_wait(handle) != 0)                                       /* wait for the reset */
+    {
+        (void)handle->spi_deinit();                                             /* spi_deinit */
+        (void)handle->cmd_data_gpio_deinit();                                   /* cmd_data_gpio_deinit */
+        (void)handle->reset_gpio_deinit();                                      /* reset_gpio_deinit */
+        handle->inited = 0;                                                     /* flag close */
+
+        return 4;                                                               /* return error */
+    }
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip without blocking
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ *            - 5 command && data init failed
+ * @note      it returns with the reset pin low, st7789_poll finishes the reset,
+ *            the drawing, console and script functions return ST7789_STATUS_BUSY and the other
+ *            commands block for the remaining time until the panel is ready
+ */
+uint8_t st7789_init_start(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->debug_print == NULL)                                            /* check debug_print */
+    {
+        return 3;                                                               /* return error */
+    }
+    if (handle->get_time_ms == NULL)                                            /* check get_time_ms */
+    {
+        handle->debug_print("st7789: get_time_ms is null.\n");                  /* get_time_ms is null */
+
+        return 3;                                                               /* return error */
+    }
+
+    return a_st7789_init(handle);                                               /* init and start the reset */
+}
+
+/**
+ * @brief      poll the panel
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       it finishes the reset and sleep waits whose time is over and never blocks
+ */
+uint8_t st7789_poll(st7789_handle_t *handle, st7789_bool_t *ready)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+
+    if (a_st7789_panel_poll(handle) != 0)                                       /* poll the panel */
+    {
+        return 1;                                                               /* return error */
+    }
+    *ready = (handle->wait_state == ST7789_WAIT_NONE) ? ST7789_BOOL_TRUE : ST7789_BOOL_FALSE;  /* set ready */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 power down failed
+ *            - 5 reset gpio deinit failed
+ *            - 6 command && data deinit failed
+ * @note      none
+ */
+uint8_t st7789_deinit(st7789_handle_t *handle)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+
+    if (a_st7789_write_byte(handle, ST7789_CMD_SLPIN, ST7789_CMD) != 0)        /* write sleep in command */
+    {
+        handle->debug_print("st7789: write command failed.\n");                /* write command failed */
+
+        return 1;                                                              /* return error */
+    }
+    if (handle->reset_gpio_deinit() != 0)                                      /* reset gpio deinit */
+    {
+        handle->debug_print("st7789: reset gpio deinit failed.\n");            /* reset gpio deinit failed */
+
+        return 5;                                                              /* return error */
+    }
+    if (handle->cmd_data_gpio_deinit() != 0)                                   /* cmd data gpio deinit */
+    {
+        handle->debug_print("st7789: cmd data gpio deinit failed.\n");         /* cmd data gpio deinit failed */
+
+        return 6;                                                              /* return error */
+    }
+    if (handle->spi_deinit() != 0)                                             /* spi deinit */
+    {
+        handle->debug_print("st7789: spi deinit failed.\n");                   /* spi deinit failed */
+
+        return 1;                                                              /* return error */
+    }
+    handle->inited = 0;                                                        /* flag close */
+
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set column
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] column screen column
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 column > 240
+ * @note      none
+ */
+uint8_t st7789_set_column(st7789_handle_t *handle, uint16_t column)
+{
+    if (handle == NULL)                                        /* check handle */
+    {
+        return 2;                                              /* return error */
+    }
+    if (handle->inited != 1)                                   /* check handle initialization */
+    {
+        return 3;                                              /* return error */
+    }
+    if (column > 240)                                          /* check column */
+    {
+        handle->debug_print("st7789: column > 240.\n");        /* column > 240 */
+
+        return 4;                                              /* return error */
+    }
+
+    handle->column = column;                                   /* set column */
+    a_st7789_framebuffer_check(handle);                        /* check framebuffer */
+    handle->window_valid = 0;                                  /* the address window is unknown */
+
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set row
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] row screen row
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 row > 320
+ * @note      none
+ */
+uint8_t st7789_set_row(st7789_handle_t *handle, uint16_t row)
+{
+    if (handle == NULL)                                        /* check handle */
+    {
+        return 2;                                              /* return error */
+    }
+    if (handle->inited != 1)                                   /* check handle initialization */
+    {
+        return 3;                                              /* return error */
+    }
+    if (row > 320)                                             /* check column */
+    {
+        handle->debug_print("st7789: row > 320.\n");           /* row > 320 */
+
+        return 4;                                              /* return error */
+    }
+
+    handle->row = row;                                         /* set row */
+    a_st7789_framebuffer_check(handle);                        /* check framebuffer */
+    handle->window_valid = 0;                                  /* the address window is unknown */
+
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     clear the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 10 panel is busy
+ * @note      none
+ */
+uint8_t st7789_clear(st7789_handle_t *handle)
+{
+    uint32_t i;
+    uint32_t m;
+    uint32_t n;
+    uint32_t total;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        memset(handle->framebuffer, 0x00,
+               (uint32_t)(handle->row) * handle->column *
+               handle->kernel->point_size);                                        /* clear framebuffer */
+        handle->dirty[0].left = 0;                                                 /* set left */
+        handle->dirty[0].top = 0;                                                  /* set top */
+        handle->dirty[0].right = handle->column - 1;                               /* set right */
+        handle->dirty[0].bottom = handle->row - 1;                                 /* set bottom */
+        handle->dirty_num = 1;                                                     /* the whole screen is dirty */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    if (a_st7789_set_window(handle, 0, 0, handle->column - 1, handle->row - 1) != 0) /* set window */
+    {
+        return 1;                                                                  /* return error */
+    }
+
+    memset(handle->buf, 0x00, handle->buf_size);                                   /* clear buffer */
+    total = a_st7789_points_length(handle->kernel,
+                                   (uint32_t)(handle->row) * handle->column);      /* total length */
+    m = total / handle->buf_size;                                                  /* total times */
+    n = total % handle->buf_size;                                                  /* the last */
+    for (i = 0; i < m; i++)
+    {
+        if (a_st7789_write_bytes(handle, handle->buf,
+            handle->buf_size, ST7789_DATA) != 0)                                   /* write data */
+        {
+            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+            return 1;                                                              /* return error */
+        }
+    }
+    if (n != 0)                                                                    /* not end */
+    {
+        if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)        /* write data */
+        {
+            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+            return 1;                                                              /* return error */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill a rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill rect failed
+ * @note      left <= right && top <= bottom, so a span of one point width is one window
+ */
+static uint8_t a_st7789_fill_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t color)
+{
+    uint32_t i;
+    uint32_t m;
+    uint32_t n;
+    uint32_t points;
+    uint32_t block;
+    uint32_t total;
+
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        a_st7789_framebuffer_fill(handle, left, top, right, bottom, color);        /* fill framebuffer */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    if (a_st7789_set_window(handle, left, top, right, bottom) != 0)                /* set window */
+    {
+        return 1;                                                                  /* return error */
+    }
+
+    points = (uint32_t)(right - left + 1) * (bottom - top + 1);                    /* total points */
+    block = handle->buf_size / handle->kernel->unit_size *
+            handle->kernel->unit_points;                                           /* whole units */
+    block = handle->kernel->fill(handle->buf, (points < block) ? points : block,
+                                 color);                                           /* only fill the used part */
+    total = a_st7789_points_length(handle->kernel, points);                        /* total length */
+    m = total / block;                                                             /* total times */
+    n = total % block;                                                             /* the last */
+    for (i = 0; i < m; i++)
+    {
+        if (a_st7789_write_bytes(handle, handle->buf, block, ST7789_DATA) != 0)    /* write whole points */
+        {
+            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+            return 1;                                                              /* return error */
+        }
+    }
+    if (n != 0)                                                                    /* not end */
+    {
+        if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)        /* write data */
+        {
+            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+            return 1;                                                              /* return error */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill the rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left >= right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top >= bottom
+ *            - 10 panel is busy
+ * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ */
+uint8_t st7789_fill_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left >= right)                                                             /* check left and right */
+    {
+        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top >= bottom)                                                             /* check top and bottom */
+    {
+        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+
+    return a_st7789_fill_rect(handle, left, top, right, bottom, color);            /* fill rect */
+}
+
+/**
+ * @brief      build a blend palette
+ * @param[in]  *kernel pointer to a pixel format kernel
+ * @param[in]  color foreground color
+ * @param[in]  background background color
+ * @param[out] *palette pointer to a 16 colors buffer
+ * @note       palette[a] is the color of a point covered a / 15 by the foreground
+ */
+static void a_st7789_blend_palette(const st7789_kernel_t *kernel, uint32_t color, uint32_t background, uint32_t *palette)
+{
+    uint8_t a;
+    uint8_t i;
+    uint32_t f;
+    uint32_t b;
+    uint32_t c;
+
+    for (a = 0; a < 16; a++)                                                       /* all coverages */
+    {
+        c = 0;                                                                     /* init 0 */
+        for (i = 0; i < 3; i++)                                                    /* red, green and blue */
+        {
+            f = (color >> kernel->shift[i]) & kernel->mask[i];                     /* foreground channel */
+            b = (background >> kernel->shift[i]) & kernel->mask[i];                /* background channel */
+            c |= ((f * a + b * (15 - a) + 7) / 15) << kernel->shift[i];            /* blend the channel */
+        }
+        palette[a] = c;                                                            /* set the color */
+    }
+}
+
+/**
+ * @brief     begin a blit
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @return    status code
+ *            - 0 success
+ *            - 1 blit begin failed
+ * @note      the points must follow in the row major order of the window
+ */
+static uint8_t a_st7789_blit_begin(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return a_st7789_set_window(handle, left, top, right, bottom);                  /* set window */
+}
+
+/**
+ * @brief         blit a point
+ * @param[in]     *handle pointer to an st7789 handle structure
+ * @param[in]     x coordinate x
+ * @param[in]     y coordinate y
+ * @param[in]     color point color
+ * @param[in,out] *index pointer to a buffer index
+ * @param[in,out] *odd pointer to an odd flag
+ * @return        status code
+ *                - 0 success
+ *                - 1 blit point failed
+ * @note          none
+ */
+static uint8_t a_st7789_blit_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color, uint32_t *index, uint8_t *odd)
+{
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        a_st7789_framebuffer_put(handle, x, y, color);                             /* put the point */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return handle->kernel->push(handle, color, index, odd);                        /* push color */
+}
+
+/**
+ * @brief     end a blit
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] index buffer index
+ * @param[in] odd odd flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 blit end failed
+ * @note      none
+ */
+static uint8_t a_st7789_blit_end(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                                 uint32_t index, uint8_t odd)
+{
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, left, top, right, bottom);               /* mark dirty */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return a_st7789_push_end(handle, index, odd);                                  /* push end */
+}
+
+/**
+ * @brief     draw a line with the bresenham algorithm
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 start coordinate x
+ * @param[in] y0 start coordinate y
+ * @param[in] x1 end coordinate x
+ * @param[in] y1 end coordinate y
+ * @param[in] color line color
+ * @param[in] skip skip the start point
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line failed
+ * @note      the points are merged into horizontal runs when the line is x major and into
+ *            vertical runs when it is y major, every run is sent with one window
+ */
+static uint8_t a_st7789_draw_line(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                                  uint32_t color, uint8_t skip)
+{
+    int32_t dx;
+    int32_t dy;
+    int32_t sx;
+    int32_t sy;
+    int32_t err;
+    int32_t x;
+    int32_t y;
+    int32_t start;
+
+    dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);                                                /* x distance */
+    dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);                                                /* y distance */
+    sx = (x1 >= x0) ? 1 : -1;                                                              /* x step */
+    sy = (y1 >= y0) ? 1 : -1;                                                              /* y step */
+    x = x0;                                                                                /* set x */
+    y = y0;                                                                                /* set y */
+    if (dx >= dy)                                                                          /* x major */
+    {
+        start = (skip != 0) ? (x + sx) : x;                                                /* run start */
+        err = dx / 2;                                                                      /* init error */
+        while (1)
+        {
+            if ((x == x1) || ((err - dy) < 0))                                             /* the run ends */
+            {
+                if (((x - start) * sx) >= 0)                                               /* not empty */
+                {
+                    if (a_st7789_fill_rect(handle, (uint16_t)((sx > 0) ? start : x), (uint16_t)y,
+                                           (uint16_t)((sx > 0) ? x : start), (uint16_t)y,
+                                           color) != 0)                                    /* draw the run */
+                    {
+                        return 1;                                                          /* return error */
+                    }
+                }
+                if (x == x1)                                                               /* the last point */
+                {
+                    break;                                                                 /* break */
+                }
+                y += sy;                                                                   /* next line */
+                err += dx;                                                                 /* error + dx */
+                start = x + sx;                                                            /* next run */
+            }
+            err -= dy;                                                                     /* error - dy */
+            x += sx;                                                                       /* next point */
+        }
+    }
+    else                                                                                   /* y major */
+    {
+        start = (skip != 0) ? (y + sy) : y;                                                /* run start */
+        err = dy / 2;                                                                      /* init error */
+        while (1)
+        {
+            if ((y == y1) || ((err - dx) < 0))                                             /* the run ends */
+            {
+                if (((y - start) * sy) >= 0)                                               /* not empty */
+                {
+                    if (a_st7789_fill_rect(handle, (uint16_t)x, (uint16_t)((sy > 0) ? start : y),
+                                           (uint16_t)x, (uint16_t)((sy > 0) ? y : start),
+                                           color) != 0)                                    /* draw the run */
+                    {
+                        return 1;                                                          /* return error */
+                    }
+                }
+                if (y == y1)                                                               /* the last point */
+                {
+                    break;                                                                 /* break */
+                }
+                x += sx;                                                                   /* next column */
+                err += dy;                                                                 /* error + dy */
+                start = y + sy;                                                            /* next run */
+            }
+            err -= dx;                                                                     /* error - dx */
+            y += sy;                                                                       /* next point */
+        }
+    }
+
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     draw a horizontal line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] right right coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw hline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 y is over row
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && y < row
+ */
+uint8_t st7789_draw_hline(st7789_handle_t *handle, uint16_t left, uint16_t right, uint16_t y, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left > right)                                                              /* check left and right */
+    {
+        handle->debug_print("st7789: left > right.\n");                            /* left > right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (y > (handle->row - 1))                                                     /* check y */
+    {
+        handle->debug_print("st7789: y is over row.\n");                           /* y is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return a_st7789_fill_rect(handle, left, y, right, y, color);                   /* draw the span */
+}
+
+/**
+ * @brief     draw a vertical line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw vline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 top is over row
+ *            - 6 bottom is over row
+ *            - 7 top > bottom
+ *            - 10 panel is busy
+ * @note      x < column && top < row && bottom < row && top <= bottom
+ */
+uint8_t st7789_draw_vline(st7789_handle_t *handle, uint16_t x, uint16_t top, uint16_t bottom, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x > (handle->column - 1))                                                  /* check x */
+    {
+        handle->debug_print("st7789: x is over column.\n");                        /* x is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > bottom)                                                              /* check top and bottom */
+    {
+        handle->debug_print("st7789: top > bottom.\n");                            /* top > bottom */
+
+        return 7;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return a_st7789_fill_rect(handle, x, top, x, bottom, color);                   /* draw the span */
+}
+
+/**
+ * @brief     draw a line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 start coordinate x
+ * @param[in] y0 start coordinate y
+ * @param[in] x1 end coordinate x
+ * @param[in] y1 end coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row
+ *            the line is split into horizontal or vertical runs and every run is sent with one window
+ */
+uint8_t st7789_draw_line(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x0 > (handle->column - 1))                                                 /* check x0 */
+    {
+        handle->debug_print("st7789: x0 is over column.\n");                       /* x0 is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y0 > (handle->row - 1))                                                    /* check y0 */
+    {
+        handle->debug_print("st7789: y0 is over row.\n");                          /* y0 is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (x1 > (handle->column - 1))                                                 /* check x1 */
+    {
+        handle->debug_print("st7789: x1 is over column.\n");                       /* x1 is over column */
+
+        return 6;                                                                  /* return error */
+    }
+    if (y1 > (handle->row - 1))                                                    /* check y1 */
+    {
+        handle->debug_print("st7789: y1 is over row.\n");                          /* y1 is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return a_st7789_draw_line(handle, x0, y0, x1, y1, color, 0);                   /* draw line */
+}
+
+/**
+ * @brief     draw an anti-aliased line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 start coordinate x
+ * @param[in] y0 start coordinate y
+ * @param[in] x1 end coordinate x
+ * @param[in] y1 end coordinate y
+ * @param[in] color line color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line aa failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row
+ *            every major step covers two points with the wu algorithm, the coverage is blended
+ *            against the background by a palette built once, the points of one minor position
+ *            are merged into a run two points thick and every run is sent with one window
+ */
+uint8_t st7789_draw_line_aa(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                            uint32_t color, uint32_t background)
+{
+    uint32_t palette[16];
+    uint32_t j;
+    uint16_t t;
+    uint16_t major;
+    uint16_t minor;
+    uint16_t minor_end;
+    uint16_t start;
+    uint16_t i;
+    uint16_t k;
+    uint8_t steep;
+    uint8_t odd;
+    uint8_t a;
+    int32_t dx;
+    int32_t dy;
+    int32_t grad;
+    int32_t inter;
+    int32_t run;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x0 > (handle->column - 1))                                                 /* check x0 */
+    {
+        handle->debug_print("st7789: x0 is over column.\n");                       /* x0 is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y0 > (handle->row - 1))                                                    /* check y0 */
+    {
+        handle->debug_print("st7789: y0 is over row.\n");                          /* y0 is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (x1 > (handle->column - 1))                                                 /* check x1 */
+    {
+        handle->debug_print("st7789: x1 is over column.\n");                       /* x1 is over column */
+
+        return 6;                                                                  /* return error */
+    }
+    if (y1 > (handle->row - 1))                                                    /* check y1 */
+    {
+        handle->debug_print("st7789: y1 is over row.\n");                          /* y1 is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    a_st7789_blend_palette(handle->kernel, color, background, palette);            /* build the palette */
+    dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);                                        /* x distance */
+    dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);                                        /* y distance */
+    steep = (dy > dx) ? 1 : 0;                                                     /* y major */
+    if (steep != 0)                                                                /* swap x and y */
+    {
+        t = x0;                                                                    /* save x0 */
+        x0 = y0;                                                                   /* set x0 */
+        y0 = t;                                                                    /* set y0 */
+        t = x1;                                                                    /* save x1 */
+        x1 = y1;                                                                   /* set x1 */
+        y1 = t;                                                                    /* set y1 */
+    }
+    if (x0 > x1)                                                                   /* go forward */
+    {
+        t = x0;                                                                    /* save x0 */
+        x0 = x1;                                                                   /* set x0 */
+        x1 = t;                                                                    /* set x1 */
+        t = y0;                                                                    /* save y0 */
+        y0 = y1;                                                                   /* set y0 */
+        y1 = t;                                                                    /* set y1 */
+    }
+    grad = (x1 == x0) ? 0 : ((((int32_t)y1 - y0) * 65536) / (x1 - x0));            /* minor step in 1/65536, rounded to zero */
+    minor_end = (steep != 0) ? (handle->column - 1) : (handle->row - 1);           /* the last minor position */
+    inter = (int32_t)y0 * 65536;                                                   /* minor position in 1/65536 */
+    major = x0;                                                                    /* init major */
+    while (major <= x1)                                                            /* all runs */
+    {
+        start = major;                                                             /* run start */
+        run = inter;                                                               /* run position */
+        minor = (uint16_t)(inter >> 16);                                           /* run minor position */
+        while ((major <= x1) && ((uint16_t)(inter >> 16) == minor))                /* the same minor position */
+        {
+            major++;                                                               /* next point */
+            inter += grad;                                                         /* next position */
+        }
+        k = (minor < minor_end) ? 1 : 0;                                           /* the second point is on the screen */
+        if (steep != 0)                                                            /* the run is vertical */
+        {
+            if (a_st7789_blit_begin(handle, minor, start, minor + k, major - 1) != 0) /* begin blit */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+        else
+        {
+            if (a_st7789_blit_begin(handle, start, minor, major - 1, minor + k) != 0) /* begin blit */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+        j = 0;                                                                     /* init 0 */
+        odd = 0;                                                                   /* init 0 */
+        if (steep != 0)                                                            /* a row has both points */
+        {
+            for (i = start; i < major; i++)                                        /* all rows */
+            {
+                a = (uint8_t)((run >> 12) & 0x0F);                                 /* coverage of the second point */
+                if (a_st7789_blit_point(handle, minor, i, palette[15 - a], &j, &odd) != 0) /* blit the first point */
+                {
+                    return 1;                                                      /* return error */
+                }
+                if ((k != 0) && (a_st7789_blit_point(handle, minor + 1, i, palette[a], &j, &odd) != 0)) /* blit the second point */
+                {
+                    return 1;                                                      /* return error */
+                }
+                run += grad;                                                       /* next position */
+            }
+            if (a_st7789_blit_end(handle, minor, start, minor + k, major - 1, j, odd) != 0) /* end blit */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+        else                                                                       /* a row has one point */
+        {
+            for (t = 0; t <= k; t++)                                               /* both rows */
+            {
+                inter = run;                                                       /* back to the run start */
+                for (i = start; i < major; i++)                                    /* all columns */
+                {
+                    a = (uint8_t)((inter >> 12) & 0x0F);                           /* coverage of the second point */
+                    if (a_st7789_blit_point(handle, i, minor + t,
+                                            palette[(t != 0) ? a : (15 - a)], &j, &odd) != 0) /* blit point */
+                    {
+                        return 1;                                                  /* return error */
+                    }
+                    inter += grad;                                                 /* next position */
+                }
+            }
+            if (a_st7789_blit_end(handle, start, minor, major - 1, minor + k, j, odd) != 0) /* end blit */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw a polyline
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *points pointer to a points buffer
+ * @param[in] num number of points
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw polyline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 points is NULL
+ *            - 5 num < 2
+ *            - 6 point is invalid
+ *            - 10 panel is busy
+ * @note      every point x < column && y < row
+ *            the shared points of the segments are only drawn once
+ */
+uint8_t st7789_draw_polyline(st7789_handle_t *handle, const st7789_point_t *points, uint16_t num, uint32_t color)
+{
+    uint16_t i;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (points == NULL)                                                            /* check points */
+    {
+        handle->debug_print("st7789: points is null.\n");                          /* points is null */
+
+        return 4;                                                                  /* return error */
+    }
+    if (num < 2)                                                                   /* check num */
+    {
+        handle->debug_print("st7789: num < 2.\n");                                 /* num < 2 */
+
+        return 5;                                                                  /* return error */
+    }
+    for (i = 0; i < num; i++)                                                      /* check all points */
+    {
+        if ((points[i].x > (handle->column - 1)) ||
+            (points[i].y > (handle->row - 1)))                                     /* check point */
+        {
+            handle->debug_print("st7789: point %d is invalid.\n", i);              /* point is invalid */
+
+            return 6;                                                              /* return error */
+        }
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    for (i = 1; i < num; i++)                                                      /* all segments */
+    {
+        if (a_st7789_draw_line(handle, points[i - 1].x, points[i - 1].y,
+                               points[i].x, points[i].y, color, (i > 1) ? 1 : 0) != 0)  /* draw segment */
+        {
+            return 1;                                                              /* return error */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     get the sine of an angle
+ * @param[in] angle angle in degrees
+ * @return    sine in 1/16384 units
+ * @note      none
+ */
+static int32_t a_st7789_sin(int32_t angle)
+{
+    angle %= 360;                                                                  /* wrap the angle */
+    if (angle <= 90)                                                               /* first quadrant */
+    {
+        return gsc_st7789_sin[angle];                                              /* return the sine */
+    }
+    else if (angle <= 180)                                                         /* second quadrant */
+    {
+        return gsc_st7789_sin[180 - angle];                                        /* return the sine */
+    }
+    else if (angle <= 270)                                                         /* third quadrant */
+    {
+        return -gsc_st7789_sin[angle - 180];                                       /* return the sine */
+    }
+    else                                                                           /* fourth quadrant */
+    {
+        return -gsc_st7789_sin[360 - angle];                                       /* return the sine */
+    }
+}
+
+/**
+ * @brief      init an arc sector
+ * @param[out] *arc pointer to an arc sector structure
+ * @param[in]  start_angle start angle in degrees
+ * @param[in]  end_angle end angle in degrees
+ * @note       start_angle < end_angle <= start_angle + 360
+ */
+static void a_st7789_arc_init(st7789_arc_t *arc, uint16_t start_angle, uint16_t end_angle)
+{
+    uint16_t sweep;
+
+    arc->sx = a_st7789_sin(start_angle + 90);                                      /* start direction x */
+    arc->sy = a_st7789_sin(start_angle);                                           /* start direction y */
+    arc->ex = a_st7789_sin(end_angle + 90);                                        /* end direction x */
+    arc->ey = a_st7789_sin(end_angle);                                             /* end direction y */
+    sweep = end_angle - start_angle;                                               /* get the sweep */
+    if (sweep >= 360)                                                              /* full circle */
+    {
+        arc->type = 2;                                                             /* set full circle */
+    }
+    else if (sweep > 180)                                                          /* over half circle */
+    {
+        arc->type = 1;                                                             /* set over half circle */
+    }
+    else                                                                           /* up to half circle */
+    {
+        arc->type = 0;                                                             /* set up to half circle */
+    }
+}
+
+/**
+ * @brief     check whether a point is in the arc sector
+ * @param[in] *arc pointer to an arc sector structure
+ * @param[in] x coordinate x from the center
+ * @param[in] y coordinate y from the center
+ * @return    1 if the point is in the sector, 0 if not
+ * @note      the angle goes clockwise on the screen, so a positive cross product means the
+ *            second vector is after the first one
+ */
+static uint8_t a_st7789_arc_contains(const st7789_arc_t *arc, int32_t x, int32_t y)
+{
+    int32_t after_start;
+    int32_t before_end;
+
+    after_start = arc->sx * y - arc->sy * x;                                       /* cross start and point */
+    before_end = x * arc->ey - y * arc->ex;                                        /* cross point and end */
+    if (arc->type == 0)                                                            /* up to half circle */
+    {
+        return ((after_start >= 0) && (before_end >= 0)) ? 1 : 0;                  /* inside both edges */
+    }
+    else                                                                           /* over half circle */
+    {
+        return ((after_start >= 0) || (before_end >= 0)) ? 1 : 0;                  /* outside the gap */
+    }
+}
+
+/**
+ * @brief     fill a span clipped to the screen
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color span color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill span failed
+ * @note      an empty span is skipped
+ */
+static uint8_t a_st7789_span(st7789_handle_t *handle, int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t color)
+{
+    if (left < 0)                                                                  /* clip left */
+    {
+        left = 0;                                                                  /* set left */
+    }
+    if (top < 0)                                                                   /* clip top */
+    {
+        top = 0;                                                                   /* set top */
+    }
+    if (right > (handle->column - 1))                                              /* clip right */
+    {
+        right = handle->column - 1;                                                /* set right */
+    }
+    if (bottom > (handle->row - 1))                                                /* clip bottom */
+    {
+        bottom = handle->row - 1;                                                  /* set bottom */
+    }
+    if ((left > right) || (top > bottom))                                          /* empty span */
+    {
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return a_st7789_fill_rect(handle, (uint16_t)left, (uint16_t)top,
+                              (uint16_t)right, (uint16_t)bottom, color);           /* fill span */
+}
+
+/**
+ * @brief     fill the part of a span in the arc sector
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *arc pointer to an arc sector structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color span color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill span failed
+ * @note      the span is one point wide or one point high, a NULL arc keeps the whole span
+ */
+static uint8_t a_st7789_arc_span(st7789_handle_t *handle, const st7789_arc_t *arc, int32_t x, int32_t y,
+                                 int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t color)
+{
+    int32_t i;
+    int32_t n;
+    int32_t dx;
+    int32_t dy;
+    int32_t start;
+
+    if ((arc == NULL) || (arc->type == 2))                                         /* whole span */
+    {
+        return a_st7789_span(handle, left, top, right, bottom, color);             /* fill span */
+    }
+
+    dx = (top == bottom) ? 1 : 0;                                                  /* horizontal step */
+    dy = 1 - dx;                                                                   /* vertical step */
+    n = (right - left) + (bottom - top) + 1;                                       /* span points */
+    start = -1;                                                                    /* no run */
+    for (i = 0; i <= n; i++)
+    {
+        if ((i < n) && (a_st7789_arc_contains(arc, left + i * dx - x, top + i * dy - y) != 0)) /* in the sector */
+        {
+            if (start < 0)                                                         /* no run */
+            {
+                start = i;                                                         /* run start */
+            }
+        }
+        else if (start >= 0)                                                       /* the run ends */
+        {
+            if (a_st7789_span(handle, left + start * dx, top + start * dy,
+                              left + (i - 1) * dx, top + (i - 1) * dy, color) != 0) /* fill the run */
+            {
+                return 1;                                                          /* return error */
+            }
+            start = -1;                                                            /* no run */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw rounded corners with the midpoint circle algorithm
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *arc pointer to an arc sector structure
+ * @param[in] left left corner center x
+ * @param[in] top top corner center y
+ * @param[in] right right corner center x
+ * @param[in] bottom bottom corner center y
+ * @param[in] radius corner radius
+ * @param[in] color outline color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw corners failed
+ * @note      the points of one octant are merged into runs and every run is sent with one window,
+ *            the runs touching the axes also draw the straight edges between the corners,
+ *            a circle is the case of left == right && top == bottom
+ */
+static uint8_t a_st7789_draw_corners(st7789_handle_t *handle, const st7789_arc_t *arc, int32_t left, int32_t top,
+                                     int32_t right, int32_t bottom, int32_t radius, uint32_t color)
+{
+    uint8_t res;
+    int32_t a;
+    int32_t c;
+    int32_t d;
+    int32_t a0;
+    int32_t v;
+
+    a = 0;                                                                         /* minor offset */
+    c = radius;                                                                    /* major offset */
+    d = 1 - radius;                                                                /* init decision */
+    a0 = 0;                                                                        /* run start */
+    while (a <= c)
+    {
+        if ((d >= 0) || ((a + 1) > c))                                             /* the run ends */
+        {
+            res = 0;                                                               /* init 0 */
+            v = (a == c) ? (a - 1) : a;                                            /* the diagonal point is in the horizontal run */
+            if (a0 == 0)                                                           /* the runs touching the axes */
+            {
+                res |= a_st7789_arc_span(handle, arc, left, top, left - a, top - c, right + a, top - c, color); /* top edge */
+                if ((bottom + c) != (top - c))                                     /* not the same row */
+                {
+                    res |= a_st7789_arc_span(handle, arc, left, top, left - a, bottom + c, right + a, bottom + c, color); /* bottom edge */
+                }
+                res |= a_st7789_arc_span(handle, arc, left, top, left - c, top - v, left - c, bottom + v, color); /* left edge */
+                if ((right + c) != (left - c))                                     /* not the same column */
+                {
+                    res |= a_st7789_arc_span(handle, arc, left, top, right + c, top - v, right + c, bottom + v, color); /* right edge */
+                }
+            }
+            else
+            {
+                res |= a_st7789_arc_span(handle, arc, left, top, right + a0, top - c, right + a, top - c, color); /* top right */
+                res |= a_st7789_arc_span(handle, arc, left, top, left - a, top - c, left - a0, top - c, color); /* top left */
+                res |= a_st7789_arc_span(handle, arc, left, top, right + a0, bottom + c, right + a, bottom + c, color); /* bottom right */
+                res |= a_st7789_arc_span(handle, arc, left, top, left - a, bottom + c, left - a0, bottom + c, color); /* bottom left */
+                if (v >= a0)                                                       /* not empty */
+                {
+                    res |= a_st7789_arc_span(handle, arc, left, top, right + c, top - v, right + c, top - a0, color); /* right top */
+                    res |= a_st7789_arc_span(handle, arc, left, top, right + c, bottom + a0, right + c, bottom + v, color); /* right bottom */
+                    res |= a_st7789_arc_span(handle, arc, left, top, left - c, top - v, left - c, top - a0, color); /* left top */
+                    res |= a_st7789_arc_span(handle, arc, left, top, left - c, bottom + a0, left - c, bottom + v, color); /* left bottom */
+                }
+            }
+            if (res != 0)                                                          /* check the result */
+            {
+                return 1;                                                          /* return error */
+            }
+            a0 = a + 1;                                                            /* next run */
+        }
+        if (d >= 0)                                                                /* step inside */
+        {
+            d += 2 * (a - c) + 5;                                                  /* update decision */
+            c--;                                                                   /* major offset - 1 */
+        }
+        else
+        {
+            d += 2 * a + 3;                                                        /* update decision */
+        }
+        a++;                                                                       /* minor offset + 1 */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill rounded corners with the midpoint circle algorithm
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left corner center x
+ * @param[in] top top corner center y
+ * @param[in] right right corner center x
+ * @param[in] bottom bottom corner center y
+ * @param[in] radius corner radius
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill corners failed
+ * @note      every scanline is sent once as one span, the rows between the corners are one window,
+ *            a circle is the case of left == right && top == bottom
+ */
+static uint8_t a_st7789_fill_corners(st7789_handle_t *handle, int32_t left, int32_t top,
+                                     int32_t right, int32_t bottom, int32_t radius, uint32_t color)
+{
+    uint8_t res;
+    int32_t a;
+    int32_t c;
+    int32_t d;
+
+    a = 0;                                                                         /* minor offset */
+    c = radius;                                                                    /* major offset */
+    d = 1 - radius;                                                                /* init decision */
+    while (a <= c)
+    {
+        res = a_st7789_span(handle, left - c, top - a, right + c, top - a, color); /* wide top row */
+        if ((bottom + a) != (top - a))                                             /* not the same row */
+        {
+            res |= a_st7789_span(handle, left - c, bottom + a, right + c, bottom + a, color); /* wide bottom row */
+        }
+        if (d >= 0)                                                                /* step inside */
+        {
+            if (c > a)                                                             /* not drawn as a wide row */
+            {
+                res |= a_st7789_span(handle, left - a, top - c, right + a, top - c, color); /* narrow top row */
+                res |= a_st7789_span(handle, left - a, bottom + c, right + a, bottom + c, color); /* narrow bottom row */
+            }
+            d += 2 * (a - c) + 5;                                                  /* update decision */
+            c--;                                                                   /* major offset - 1 */
+        }
+        else
+        {
+            d += 2 * a + 3;                                                        /* update decision */
+        }
+        if (res != 0)                                                              /* check the result */
+        {
+            return 1;                                                              /* return error */
+        }
+        a++;                                                                       /* minor offset + 1 */
+    }
+    if (bottom > (top + 1))                                                        /* rows between the corners */
+    {
+        return a_st7789_span(handle, left - radius, top + 1, right + radius, bottom - 1, color); /* fill the middle */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw a circle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color circle color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            the circle is clipped to the screen and every octant run is sent with one window
+ */
+uint8_t st7789_draw_circle(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x > (handle->column - 1))                                                  /* check x */
+    {
+        handle->debug_print("st7789: x is over column.\n");                        /* x is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y > (handle->row - 1))                                                     /* check y */
+    {
+        handle->debug_print("st7789: y is over row.\n");                           /* y is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return a_st7789_draw_corners(handle, NULL, x, y, x, y, r, color);              /* draw circle */
+}
+
+/**
+ * @brief     fill a circle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color circle color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            the circle is clipped to the screen and every scanline is sent with one window
+ */
+uint8_t st7789_fill_circle(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r, uint32_t color)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x > (handle->column - 1))                                                  /* check x */
+    {
+        handle->debug_print("st7789: x is over column.\n");                        /* x is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y > (handle->row - 1))                                                     /* check y */
+    {
+        handle->debug_print("st7789: y is over row.\n");                           /* y is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return a_st7789_fill_corners(handle, x, y, x, y, r, color);                    /* fill circle */
+}
+
+/**
+ * @brief     draw an arc
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] start_angle start angle in degrees
+ * @param[in] end_angle end angle in degrees
+ * @param[in] color arc color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw arc failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 6 start angle is over 359
+ *            - 7 end angle is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && start_angle < 360 && start_angle < end_angle <= start_angle + 360
+ *            0 degree is at the right of the center and the arc goes clockwise on the screen,
+ *            the octant runs are cut at the arc ends and every part is sent with one window
+ */
+uint8_t st7789_draw_arc(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r,
+                        uint16_t start_angle, uint16_t end_angle, uint32_t color)
+{
+    st7789_arc_t arc;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x > (handle->column - 1))                                                  /* check x */
+    {
+        handle->debug_print("st7789: x is over column.\n");                        /* x is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y > (handle->row - 1))                                                     /* check y */
+    {
+        handle->debug_print("st7789: y is over row.\n");                           /* y is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (start_angle > 359)                                                         /* check start angle */
+    {
+        handle->debug_print("st7789: start angle is over 359.\n");                 /* start angle is over 359 */
+
+        return 6;                                                                  /* return error */
+    }
+    if ((end_angle <= start_angle) || (end_angle > (start_angle + 360)))           /* check end angle */
+    {
+        handle->debug_print("st7789: end angle is invalid.\n");                    /* end angle is invalid */
+
+        return 7;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    a_st7789_arc_init(&arc, start_angle, end_angle);                               /* init the sector */
+
+    return a_st7789_draw_corners(handle, &arc, x, y, x, y, r, color);              /* draw arc */
+}
+
+/**
+ * @brief     check a rounded rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @return    status code
+ *            - 0 success
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ * @note      none
+ */
+static uint8_t a_st7789_check_round_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left > right)                                                              /* check left and right */
+    {
+        handle->debug_print("st7789: left > right.\n");                            /* left > right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top > bottom)                                                              /* check top and bottom */
+    {
+        handle->debug_print("st7789: top > bottom.\n");                            /* top > bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw a rounded rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color rect color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && top < row && bottom < row && top <= bottom
+ *            r is limited to half of the shorter side, every edge and octant run is sent with one window
+ */
+uint8_t st7789_draw_round_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               uint16_t r, uint32_t color)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    res = a_st7789_check_round_rect(handle, left, top, right, bottom);             /* check the rect */
+    if (res != 0)                                                                  /* check the result */
+    {
+        return res;                                                                /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    if (r > ((right - left) / 2))                                                  /* limit by the width */
+    {
+        r = (right - left) / 2;                                                    /* set radius */
+    }
+    if (r > ((bottom - top) / 2))                                                  /* limit by the height */
+    {
+        r = (bottom - top) / 2;                                                    /* set radius */
+    }
+
+    return a_st7789_draw_corners(handle, NULL, left + r, top + r, right - r, bottom - r, r, color); /* draw round rect */
+}
+
+/**
+ * @brief     fill a rounded rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color rect color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && top < row && bottom < row && top <= bottom
+ *            r is limited to half of the shorter side, every corner scanline is sent with one window
+ */
+uint8_t st7789_fill_round_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               uint16_t r, uint32_t color)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    res = a_st7789_check_round_rect(handle, left, top, right, bottom);             /* check the rect */
+    if (res != 0)                                                                  /* check the result */
+    {
+        return res;                                                                /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    if (r > ((right - left) / 2))                                                  /* limit by the width */
+    {
+        r = (right - left) / 2;                                                    /* set radius */
+    }
+    if (r > ((bottom - top) / 2))                                                  /* limit by the height */
+    {
+        r = (bottom - top) / 2;                                                    /* set radius */
+    }
+
+    return a_st7789_fill_corners(handle, left + r, top + r, right - r, bottom - r, r, color); /* fill round rect */
+}
+
+/**
+ * @brief      init a polygon edge
+ * @param[out] *edge pointer to a polygon edge structure
+ * @param[in]  *p0 pointer to the first point
+ * @param[in]  *p1 pointer to the second point
+ * @note       p0->y != p1->y, x of every row is rounded to the nearest point
+ */
+static void a_st7789_edge_init(st7789_edge_t *edge, const st7789_point_t *p0, const st7789_point_t *p1)
+{
+    const st7789_point_t *p;
+    int16_t dx;
+    int16_t dy;
+
+    if (p0->y > p1->y)                                                             /* go down */
+    {
+        p = p0;                                                                    /* save p0 */
+        p0 = p1;                                                                   /* set p0 */
+        p1 = p;                                                                    /* set p1 */
+    }
+    dx = (int16_t)(p1->x - p0->x);                                                 /* x distance */
+    dy = (int16_t)(p1->y - p0->y);                                                 /* y distance */
+    edge->top = (int16_t)p0->y;                                                    /* set top */
+    edge->bottom = (int16_t)p1->y;                                                 /* set bottom */
+    edge->x = (int16_t)p0->x;                                                      /* set x */
+    edge->den = (int16_t)(2 * dy);                                                 /* set the remainder range */
+    edge->rem = dy;                                                                /* half point to round */
+    edge->step = (int16_t)((2 * dx) / edge->den);                                  /* set step */
+    edge->rem_step = (int16_t)(2 * dx - edge->step * edge->den);                   /* set remainder step */
+    if (edge->rem_step < 0)                                                        /* round down */
+    {
+        edge->step--;                                                              /* step - 1 */
+        edge->rem_step += edge->den;                                               /* remainder step + range */
+    }
+}
+
+/**
+ * @brief         step a polygon edge to the next row
+ * @param[in,out] *edge pointer to a polygon edge structure
+ * @note          none
+ */
+static void a_st7789_edge_step(st7789_edge_t *edge)
+{
+    edge->x += edge->step;                                                         /* x + step */
+    edge->rem += edge->rem_step;                                                   /* remainder + step */
+    if (edge->rem >= edge->den)                                                    /* carry */
+    {
+        edge->rem -= edge->den;                                                    /* remainder - range */
+        edge->x++;                                                                 /* x + 1 */
+    }
+}
+
+/**
+ * @brief     fill a polygon with its edge table
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *edge pointer to a polygon edge table
+ * @param[in] num edge number
+ * @param[in] top first row
+ * @param[in] bottom last row
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill edges failed
+ * @note      an edge crosses the rows from its top to the row above its bottom, only the last row
+ *            takes the edges ending on it, the crossings are paired with the even-odd rule and
+ *            every pair is sent as one span
+ */
+static uint8_t a_st7789_fill_edges(st7789_handle_t *handle, st7789_edge_t *edge, uint16_t num,
+                                   int16_t top, int16_t bottom, uint32_t color)
+{
+    int16_t cross[ST7789_POLYGON_POINTS_MAX];
+    int16_t x;
+    int16_t y;
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+
+    for (y = top; y <= bottom; y++)
+    {
+        n = 0;                                                                     /* no crossing */
+        for (i = 0; i < num; i++)
+        {
+            if (((edge[i].top <= y) && (y < edge[i].bottom)) ||
+                ((y == bottom) && (edge[i].bottom == bottom)))                     /* the edge crosses the row */
+            {
+                x = edge[i].x;                                                     /* get x */
+                for (j = n; (j > 0) && (cross[j - 1] > x); j--)                    /* insert in order */
+                {
+                    cross[j] = cross[j - 1];                                       /* move up */
+                }
+                cross[j] = x;                                                      /* set crossing */
+                n++;                                                               /* crossing + 1 */
+            }
+        }
+        for (i = 0; (i + 1) < n; i += 2)                                           /* all pairs */
+        {
+            if (a_st7789_fill_rect(handle, (uint16_t)cross[i], (uint16_t)y,
+                                   (uint16_t)cross[i + 1], (uint16_t)y, color) != 0) /* fill span */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+        for (i = 0; i < num; i++)
+        {
+            if ((edge[i].top <= y) && (y < edge[i].bottom))                        /* the edge goes on */
+            {
+                a_st7789_edge_step(&edge[i]);                                      /* step the edge */
+            }
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill a triangle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 first coordinate x
+ * @param[in] y0 first coordinate y
+ * @param[in] x1 second coordinate x
+ * @param[in] y1 second coordinate y
+ * @param[in] x2 third coordinate x
+ * @param[in] y2 third coordinate y
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill triangle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 8 x2 is over column
+ *            - 9 y2 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row && x2 < column && y2 < row
+ *            the rows are the same as st7789_fill_polygon with three points,
+ *            but the two edges of every row are known without an edge table
+ */
+uint8_t st7789_fill_triangle(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                             uint16_t x2, uint16_t y2, uint32_t color)
+{
+    st7789_point_t p[3];
+    st7789_point_t t;
+    st7789_edge_t e_long;
+    st7789_edge_t e_top;
+    st7789_edge_t e_bottom;
+    st7789_edge_t *e_short;
+    uint16_t left;
+    uint16_t right;
+    int16_t y;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (x0 > (handle->column - 1))                                                 /* check x0 */
+    {
+        handle->debug_print("st7789: x0 is over column.\n");                       /* x0 is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (y0 > (handle->row - 1))                                                    /* check y0 */
+    {
+        handle->debug_print("st7789: y0 is over row.\n");                          /* y0 is over row */
+
+        return 5;                                                                  /* return error */
+    }
+    if (x1 > (handle->column - 1))                                                 /* check x1 */
+    {
+        handle->debug_print("st7789: x1 is over column.\n");                       /* x1 is over column */
+
+        return 6;                                                                  /* return error */
+    }
+    if (y1 > (handle->row - 1))                                                    /* check y1 */
+    {
+        handle->debug_print("st7789: y1 is over row.\n");                          /* y1 is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (x2 > (handle->column - 1))                                                 /* check x2 */
+    {
+        handle->debug_print("st7789: x2 is over column.\n");                       /* x2 is over column */
+
+        return 8;                                                                  /* return error */
+    }
+    if (y2 > (handle->row - 1))                                                    /* check y2 */
+    {
+        handle->debug_print("st7789: y2 is over row.\n");                          /* y2 is over row */
+
+        return 9;                                                                  /* return error */
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    p[0].x = x0;                                                                   /* set point 0 x */
+    p[0].y = y0;                                                                   /* set point 0 y */
+    p[1].x = x1;                                                                   /* set point 1 x */
+    p[1].y = y1;                                                                   /* set point 1 y */
+    p[2].x = x2;                                                                   /* set point 2 x */
+    p[2].y = y2;                                                                   /* set point 2 y */
+    if (p[0].y > p[1].y)                                                           /* sort 0 and 1 */
+    {
+        t = p[0];                                                                  /* save point 0 */
+        p[0] = p[1];                                                               /* set point 0 */
+        p[1] = t;                                                                  /* set point 1 */
+    }
+    if (p[1].y > p[2].y)                                                           /* sort 1 and 2 */
+    {
+        t = p[1];                                                                  /* save point 1 */
+        p[1] = p[2];                                                               /* set point 1 */
+        p[2] = t;                                                                  /* set point 2 */
+    }
+    if (p[0].y > p[1].y)                                                           /* sort 0 and 1 */
+    {
+        t = p[0];                                                                  /* save point 0 */
+        p[0] = p[1];                                                               /* set point 0 */
+        p[1] = t;                                                                  /* set point 1 */
+    }
+    if (p[0].y == p[2].y)                                                          /* one row */
+    {
+        left = (x0 < x1) ? x0 : x1;                                                /* min of x0 and x1 */
+        left = (left < x2) ? left : x2;                                            /* min of x2 */
+        right = (x0 > x1) ? x0 : x1;                                               /* max of x0 and x1 */
+        right = (right > x2) ? right : x2;                                         /* max of x2 */
+
+        return a_st7789_fill_rect(handle, left, y0, right, y0, color);             /* fill span */
+    }
+
+    a_st7789_edge_init(&e_long, &p[0], &p[2]);                                     /* the edge of all rows */
+    if (p[0].y != p[1].y)                                                          /* not a flat top */
+    {
+        a_st7789_edge_init(&e_top, &p[0], &p[1]);                                  /* the upper edge */
+    }
+    if (p[1].y != p[2].y)                                                          /* not a flat bottom */
+    {
+        a_st7789_edge_init(&e_bottom, &p[1], &p[2]);                               /* the lower edge */
+    }
+    for (y = (int16_t)p[0].y; y <= (int16_t)p[2].y; y++)
+    {
+        if ((y < (int16_t)p[1].y) || (p[1].y == p[2].y))                           /* the upper part or a flat bottom */
+        {
+            e_short = &e_top;                                                      /* use the upper edge */
+        }
+        else
+        {
+            e_short = &e_bottom;                                                   /* use the lower edge */
+        }
+        left = (uint16_t)((e_long.x < e_short->x) ? e_long.x : e_short->x);        /* span left */
+        right = (uint16_t)((e_long.x > e_short->x) ? e_long.x : e_short->x);       /* span right */
+        if (a_st7789_fill_rect(handle, left, (uint16_t)y, right, (uint16_t)y, color) != 0) /* fill span */
+        {
+            return 1;                                                              /* return error */
+        }
+        a_st7789_edge_step(&e_long);                                               /* step the edge of all rows */
+        a_st7789_edge_step(e_short);                                               /* step the short edge */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill a polygon
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *points pointer to a points buffer
+ * @param[in] num number of points
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill polygon failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 points is NULL
+ *            - 5 num < 3
+ *            - 6 point is invalid
+ *            - 7 num is over max
+ *            - 10 panel is busy
+ * @note      every point x < column && y < row && 3 <= num <= ST7789_POLYGON_POINTS_MAX
+ *            the last point is joined to the first one, concave and self-crossing polygons use
+ *            the even-odd rule and every inner span of a row is sent with one window
+ */
+uint8_t st7789_fill_polygon(st7789_handle_t *handle, const st7789_point_t *points, uint16_t num, uint32_t color)
+{
+    st7789_edge_t edge[ST7789_POLYGON_POINTS_MAX];
+    uint16_t i;
+    uint16_t n;
+    uint16_t left;
+    uint16_t right;
+    uint16_t top;
+    uint16_t bottom;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (points == NULL)                                                            /* check points */
+    {
+        handle->debug_print("st7789: points is null.\n");                          /* points is null */
+
+        return 4;                                                                  /* return error */
+    }
+    if (num < 3)                                                                   /* check num */
+    {
+        handle->debug_print("st7789: num < 3.\n");                                 /* num < 3 */
+
+        return 5;                                                                  /* return error */
+    }
+    if (num > ST7789_POLYGON_POINTS_MAX)                                           /* check num */
+    {
+        handle->debug_print("st7789: num is over max.\n");                         /* num is over max */
+
+        return 7;                                                                  /* return error */
+    }
+    for (i = 0; i < num; i++)                                                      /* check all points */
+    {
+        if ((points[i].x > (handle->column - 1)) ||
+            (points[i].y > (handle->row - 1)))                                     /* check point */
+        {
+            handle->debug_print("st7789: point %d is invalid.\n", i);              /* point is invalid */
+
+            return 6;                                                              /* return error */
+        }
+    }
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    n = 0;                                                                         /* no edge */
+    left = points[0].x;                                                            /* init left */
+    right = points[0].x;                                                           /* init right */
+    top = points[0].y;                                                             /* init top */
+    bottom = points[0].y;                                                          /* init bottom */
+    for (i = 0; i < num; i++)                                                      /* build the edge table */
+    {
+        left = (points[i].x < left) ? points[i].x : left;                          /* update left */
+        right = (points[i].x > right) ? points[i].x : right;                       /* update right */
+        top = (points[i].y < top) ? points[i].y : top;                             /* update top */
+        bottom = (points[i].y > bottom) ? points[i].y : bottom;                    /* update bottom */
+        if (points[i].y != points[(i + 1) % num].y)                                /* skip the horizontal edges */
+        {
+            a_st7789_edge_init(&edge[n], &points[i], &points[(i + 1) % num]);      /* add an edge */
+            n++;                                                                   /* edge + 1 */
+        }
+    }
+    if (n == 0)                                                                    /* one row */
+    {
+        return a_st7789_fill_rect(handle, left, top, right, top, color);           /* fill span */
+    }
+
+    return a_st7789_fill_edges(handle, edge, n, (int16_t)top, (int16_t)bottom, color); /* fill edges */
+}
+
+/**
+ * @brief     draw a picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image16 pointer to a 12bits or 16bits image buffer
+ * @param[in] *image32 pointer to an 18bits image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ * @note      only one of image16 and image32 is used
+ */
+static uint8_t a_st7789_draw_picture(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                                     uint16_t *image16, uint32_t *image32)
+{
+    const st7789_kernel_t *kernel;
+    uint16_t x;
+    uint16_t y;
+    uint16_t c;
+    uint16_t r;
+    uint8_t odd;
+    uint32_t i;
+    uint32_t j;
+    uint32_t len;
+    uint32_t total;
+    uint32_t index;
+    uint32_t color;
+    uint32_t size;
+    uint8_t *buf;
+
+    kernel = handle->kernel;                                                               /* get kernel */
+    c = right - left + 1;                                                                  /* column */
+    r = bottom - top + 1;                                                                  /* row */
+    if (handle->framebuffer == NULL)                                                       /* direct mode */
+    {
+        if (a_st7789_set_window(handle, left, top, right, bottom) != 0)                    /* set window */
+        {
+            return 1;                                                                      /* return error */
+        }
+        if (handle->image_layout == ST7789_IMAGE_LAYOUT_ROW_MAJOR)                         /* row major */
+        {
+            total = (uint32_t)c * r;                                                       /* total points */
+            while (total != 0)                                                             /* stream the rows */
+            {
+                buf = a_st7789_get_buffer(handle, &size);                                  /* get the buffer */
+                len = size / kernel->unit_size * kernel->unit_points;                      /* whole units */
+                len = (total > len) ? len : total;                                         /* get length */
+                if (image16 != NULL)                                                       /* 12bits or 16bits image */
+                {
+                    kernel->convert16(image16, buf, len);                                  /* convert the points */
+                    image16 += len;                                                        /* next part */
+                }
+                else                                                                       /* 18bits image */
+                {
+                    kernel->convert32(image32, buf, len);                                  /* convert the points */
+                    image32 += len;                                                        /* next part */
+                }
+                i = a_st7789_points_length(kernel, len);                                   /* get the length */
+                if (a_st7789_send_buffer(handle, buf, i) != 0)                             /* send the buffer */
+                {
+                    return 1;                                                              /* return error */
+                }
+                total -= len;                                                              /* total - len */
+            }
+
+            return a_st7789_wait(handle);                                                  /* wait for the last half */
+        }
+    }
+    else if ((handle->image_layout == ST7789_IMAGE_LAYOUT_ROW_MAJOR) &&
+             (kernel->get == NULL))                                                        /* row major and not packed */
+    {
+        for (y = 0; y < r; y++)                                                            /* all lines */
+        {
+            buf = &handle->framebuffer[((uint32_t)(top + y) * handle->column + left) *
+                                       kernel->point_size];                                /* get address */
+            if (image16 != NULL)                                                           /* 12bits or 16bits image */
+            {
+                kernel->convert16(&image16[(uint32_t)y * c], buf, c);                      /* convert the line */
+            }
+            else                                                                           /* 18bits image */
+            {
+                kernel->convert32(&image32[(uint32_t)y * c], buf, c);                      /* convert the line */
+            }
+        }
+        a_st7789_framebuffer_mark(handle, left, top, right, bottom);                       /* mark dirty */
+
+        return 0;                                                                          /* success return 0 */
+    }
+
+    j = 0;                                                                                 /* init 0 */
+    odd = 0;                                                                               /* init 0 */
+    for (y = 0; y < r; y++)                                                                /* all lines */
+    {
+        for (x = 0; x < c; x++)                                                            /* all points */
+        {
+            if (handle->image_layout == ST7789_IMAGE_LAYOUT_ROW_MAJOR)                     /* row major */
+            {
+                index = (uint32_t)y * c + x;                                               /* get index */
+            }
+            else                                                                           /* column major */
+            {
+                index = (uint32_t)x * r + y;                                               /* get index */
+            }
+            color = (image16 != NULL) ? image16[index] : image32[index];                   /* get color */
+            if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+            {
+                a_st7789_framebuffer_put(handle, left + x, top + y, color);                /* put the point */
+            }
+            else
+            {
+                if (kernel->push(handle, color, &j, &odd) != 0)                            /* push color */
+                {
+                    return 1;                                                              /* return error */
+                }
+            }
+        }
+    }
+    if (handle->framebuffer != NULL)                                                       /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, left, top, right, bottom);                       /* mark dirty */
+
+        return 0;                                                                          /* success return 0 */
+    }
+
+    return a_st7789_push_end(handle, j, odd);                                              /* push end */
+}
+
+/**
+ * @brief     draw a picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to an image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture 12bits failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left >= right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top >= bottom
+ *            - 10 panel is busy
+ * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ */
+uint8_t st7789_draw_picture_12bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left >= right)                                                             /* check left and right */
+    {
+        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top >= bottom)                                                             /* check top and bottom */
+    {
+        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    if (handle->kernel != &gsc_st7789_kernel_444)                                  /* rgb444 */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+
+    return a_st7789_draw_picture(handle, left, top, right, bottom, image, NULL);   /* draw picture */
+}
+
+/**
+ * @brief     draw a picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to an image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture 16bits failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left >= right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top >= bottom
+ *            - 10 panel is busy
+ * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ */
+uint8_t st7789_draw_picture_16bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left >= right)                                                             /* check left and right */
+    {
+        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top >= bottom)                                                             /* check top and bottom */
+    {
+        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    if (handle->kernel != &gsc_st7789_kernel_565)                                  /* rgb565 */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+
+    return a_st7789_draw_picture(handle, left, top, right, bottom, image, NULL);   /* draw picture */
+}
+
+/**
+ * @brief     draw a picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to an image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture 18bits failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left >= right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top >= bottom
+ *            - 10 panel is busy
+ * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ */
+uint8_t st7789_draw_picture_18bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t *image)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left >= right)                                                             /* check left and right */
+    {
+        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top >= bottom)                                                             /* check top and bottom */
+    {
+        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    if (handle->kernel != &gsc_st7789_kernel_666)                                  /* rgb666 */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+
+    return a_st7789_draw_picture(handle, left, top, right, bottom, NULL, image);   /* draw picture */
+}
+
+/**
+ * @brief     set the image layout
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] layout image layout
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t st7789_set_image_layout(st7789_handle_t *handle, st7789_image_layout_t layout)
+{
+    if (handle == NULL)                               /* check handle */
+    {
+        return 2;                                     /* return error */
+    }
+    if (handle->inited != 1)                          /* check handle initialization */
+    {
+        return 3;                                     /* return error */
+    }
+
+    handle->image_layout = (uint8_t)layout;           /* set layout */
+
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the image layout
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[out] *layout pointer to an image layout buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_get_image_layout(st7789_handle_t *handle, st7789_image_layout_t *layout)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+
+    *layout = (st7789_image_layout_t)(handle->image_layout);        /* get layout */
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     draw the raw data
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a raw data buffer
+ * @param[in] len raw data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw raw failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ *            - 11 len is invalid
+ *            - 12 format is invalid
+ * @note      left <= column && right <= column && left <= right && top <= row && bottom <= row && top <= bottom
+ */
+uint8_t st7789_draw_raw(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                        uint8_t *data, uint32_t len)
+{
+    uint32_t points;
+    uint32_t size;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left > right)                                                              /* check left and right */
+    {
+        handle->debug_print("st7789: left > right.\n");                            /* left > right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top > bottom)                                                              /* check top and bottom */
+    {
+        handle->debug_print("st7789: top > bottom.\n");                            /* top > bottom */
+
+        return 9;                                                                  /* return error */
+    }
+
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 12;                                                                 /* return error */
+    }
+    points = (uint32_t)(right - left + 1) * (bottom - top + 1);                    /* total points */
+    size = a_st7789_points_length(handle->kernel, points);                         /* get the length */
+    if (len != size)                                                               /* check length */
+    {
+        handle->debug_print("st7789: len is invalid.\n");                          /* len is invalid */
+
+        return 11;                                                                 /* return error */
+    }
+
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        uint16_t x;
+        uint16_t y;
+        uint32_t i;
+        uint32_t line;
+
+        if (handle->kernel->unpack != NULL)                                        /* packed format */
+        {
+            i = 0;                                                                 /* init 0 */
+            for (y = top; y <= bottom; y++)                                        /* all lines */
+            {
+                for (x = left; x <= right; x++)                                    /* all points */
+                {
+                    a_st7789_framebuffer_put(handle, x, y,
+                                             handle->kernel->unpack(data, i));     /* put the point */
+                    i++;                                                           /* next point */
+                }
+            }
+        }
+        else
+        {
+            size = handle->kernel->point_size;                                     /* get point size */
+            line = (uint32_t)(right - left + 1) * size;                            /* line size */
+            for (y = top; y <= bottom; y++)                                        /* all lines */
+            {
+                memcpy(&handle->framebuffer[((uint32_t)(y) * handle->column + left) * size],
+                       data, line);                                                /* copy line */
+                data += line;                                                      /* next line */
+            }
+        }
+        a_st7789_framebuffer_mark(handle, left, top, right, bottom);               /* mark dirty */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    if (a_st7789_set_window(handle, left, top, right, bottom) != 0)                /* set window */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (a_st7789_write_bytes(handle, data, len, ST7789_DATA) != 0)                 /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      decode an rle block
+ * @param[in]  *src pointer to the encoded bytes
+ * @param[in]  src_len encoded length
+ * @param[out] *dst pointer to the decoded bytes buffer
+ * @param[in]  dst_len decoded length
+ * @param[in]  unit transfer unit size
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       a control byte c < 128 is followed by c + 1 literal units,
+ *             a control byte c >= 128 is followed by one unit repeated c - 126 times
+ */
+static uint8_t a_st7789_rle_decode(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len, uint8_t unit)
+{
+    uint32_t i;
+    uint32_t o;
+    uint32_t n;
+    uint8_t c;
+
+    i = 0;                                                                         /* init 0 */
+    o = 0;                                                                         /* init 0 */
+    while (i < src_len)                                                            /* all control bytes */
+    {
+        c = src[i];                                                                /* get control byte */
+        i++;                                                                       /* next byte */
+        if (c < 128)                                                               /* literal units */
+        {
+            n = (uint32_t)(c + 1) * unit;                                          /* literal length */
+            if ((n > (src_len - i)) || (n > (dst_len - o)))                        /* check length */
+            {
+                return 1;                                                          /* return error */
+            }
+            memcpy(&dst[o], &src[i], n);                                           /* copy the units */
+            i += n;                                                                /* source + n */
+            o += n;                                                                /* destination + n */
+        }
+        else                                                                       /* repeated unit */
+        {
+            n = (uint32_t)(c - 126) * unit;                                        /* run length */
+            if ((unit > (src_len - i)) || (n > (dst_len - o)))                     /* check length */
+            {
+                return 1;                                                          /* return error */
+            }
+            for (n = c - 126; n != 0; n--)                                         /* all repeats */
+            {
+                memcpy(&dst[o], &src[i], unit);                                    /* copy the unit */
+                o += unit;                                                         /* destination + unit */
+            }
+            i += unit;                                                             /* source + unit */
+        }
+    }
+
+    return (o == dst_len) ? 0 : 1;                                                 /* check the decoded length */
+}
+
+/**
+ * @brief      read an lz4 length
+ * @param[in]  *src pointer to the encoded bytes
+ * @param[in]  src_len encoded length
+ * @param[in]  *i pointer to the read index
+ * @param[out] *n pointer to the length to extend
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       every 255 byte adds 255 and the first other byte ends the length
+ */
+static uint8_t a_st7789_lz4_length(const uint8_t *src, uint32_t src_len, uint32_t *i, uint32_t *n)
+{
+    uint8_t b;
+
+    do
+    {
+        if (*i >= src_len)                                                         /* check length */
+        {
+            return 1;                                                              /* return error */
+        }
+        b = src[*i];                                                               /* get byte */
+        (*i)++;                                                                    /* next byte */
+        *n += b;                                                                   /* add the byte */
+    } while (b == 255);                                                            /* more bytes */
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      decode an lz4 block
+ * @param[in]  *src pointer to the encoded bytes
+ * @param[in]  src_len encoded length
+ * @param[out] *dst pointer to the decoded bytes buffer
+ * @param[in]  dst_len decoded length
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       the lz4 block format, every match must point inside the decoded block
+ */
+static uint8_t a_st7789_lz4_decode(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len)
+{
+    uint32_t i;
+    uint32_t o;
+    uint32_t n;
+    uint32_t offset;
+    uint8_t token;
+
+    i = 0;                                                                         /* init 0 */
+    o = 0;                                                                         /* init 0 */
+    while (i < src_len)                                                            /* all sequences */
+    {
+        token = src[i];                                                            /* get token */
+        i++;                                                                       /* next byte */
+        n = token >> 4;                                                            /* literal length */
+        if ((n == 15) && (a_st7789_lz4_length(src, src_len, &i, &n) != 0))         /* long literal length */
+        {
+            return 1;                                                              /* return error */
+        }
+        if ((n > (src_len - i)) || (n > (dst_len - o)))                            /* check length */
+        {
+            return 1;                                                              /* return error */
+        }
+        memcpy(&dst[o], &src[i], n);                                               /* copy the literals */
+        i += n;                                                                    /* source + n */
+        o += n;                                                                    /* destination + n */
+        if (i == src_len)                                                          /* the last sequence has no match */
+        {
+            break;                                                                 /* break */
+        }
+        if ((src_len - i) < 2)                                                     /* check the offset */
+        {
+            return 1;                                                              /* return error */
+        }
+        offset = (uint32_t)src[i] | ((uint32_t)src[i + 1] << 8);                   /* get offset */
+        i += 2;                                                                    /* source + 2 */
+        if ((offset == 0) || (offset > o))                                         /* the match is out of the block */
+        {
+            return 1;                                                              /* return error */
+        }
+        n = token & 0x0F;                                                          /* match length */
+        if ((n == 15) && (a_st7789_lz4_length(src, src_len, &i, &n) != 0))         /* long match length */
+        {
+            return 1;                                                              /* return error */
+        }
+        n += 4;                                                                    /* min match 4 */
+        if (n > (dst_len - o))                                                     /* check length */
+        {
+            return 1;                                                              /* return error */
+        }
+        for (; n != 0; n--)                                                        /* copy the match, it may overlap */
+        {
+            dst[o] = dst[o - offset];                                              /* copy a byte */
+            o++;                                                                   /* next byte */
+        }
+    }
+
+    return (o == dst_len) ? 0 : 1;                                                 /* check the decoded length */
+}
+
+/**
+ * @brief     draw a compressed picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a compressed data buffer
+ * @param[in] len compressed data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw compressed failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ *            - 11 data is invalid
+ *            - 12 format is invalid
+ * @note      left <= column && right <= column && left <= right && top <= row && bottom <= row && top <= bottom
+ *            data is the row major picture in the panel byte format of st7789_draw_raw split into blocks,
+ *            it starts with 'Z' and the point bits (12, 16 or 18) of the format, every block has a method byte
+ *            (0 stored, 1 rle, 2 lz4), the decoded and the encoded length in 2 little endian bytes each and the
+ *            encoded bytes, the rle unit is the transfer unit (3 bytes in rgb444 and rgb666, 2 bytes in rgb565),
+ *            lz4 is the lz4 block format with the matches inside the block
+ *            every block is decoded into the transfer buffer and sent, so a block must not be longer than the
+ *            buffer (its half with the async write) and all blocks but the last must hold whole transfer units,
+ *            a corrupt block stops the drawing
+ */
+uint8_t st7789_draw_compressed(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               const uint8_t *data, uint32_t len)
+{
+    const st7789_kernel_t *kernel;
+    uint8_t *buf;
+    uint8_t bits;
+    uint8_t method;
+    uint8_t res;
+    uint16_t width;
+    uint32_t points;
+    uint32_t total;
+    uint32_t done;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t dec_len;
+    uint32_t enc_len;
+    uint32_t start;
+    uint32_t n;
+    uint32_t k;
+    uint32_t p;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if (left > (handle->column - 1))                                               /* check left */
+    {
+        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+
+        return 4;                                                                  /* return error */
+    }
+    if (right > (handle->column - 1))                                              /* check right */
+    {
+        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+
+        return 5;                                                                  /* return error */
+    }
+    if (left > right)                                                              /* check left and right */
+    {
+        handle->debug_print("st7789: left > right.\n");                            /* left > right */
+
+        return 6;                                                                  /* return error */
+    }
+    if (top > (handle->row - 1))                                                   /* check top */
+    {
+        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+
+        return 7;                                                                  /* return error */
+    }
+    if (bottom > (handle->row - 1))                                                /* check bottom */
+    {
+        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+
+        return 8;                                                                  /* return error */
+    }
+    if (top > bottom)                                                              /* check top and bottom */
+    {
+        handle->debug_print("st7789: top > bottom.\n");                            /* top > bottom */
+
+        return 9;                                                                  /* return error */
+    }
+    kernel = handle->kernel;                                                       /* get kernel */
+    if (kernel == &gsc_st7789_kernel_444)                                          /* rgb444 */
+    {
+        bits = 12;                                                                 /* 12 bits */
+    }
+    else if (kernel == &gsc_st7789_kernel_565)                                     /* rgb565 */
+    {
+        bits = 16;                                                                 /* 16 bits */
+    }
+    else if (kernel == &gsc_st7789_kernel_666)                                     /* rgb666 */
+    {
+        bits = 18;                                                                 /* 18 bits */
+    }
+    else
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 12;                                                                 /* return error */
+    }
+    if ((data == NULL) || (len < 2) || (data[0] != 'Z'))                           /* check the header */
+    {
+        handle->debug_print("st7789: data is invalid.\n");                         /* data is invalid */
+
+        return 11;                                                                 /* return error */
+    }
+    if (data[1] != bits)                                                           /* check the point bits */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 12;                                                                 /* return error */
+    }
+
+    width = right - left + 1;                                                      /* width */
+    points = (uint32_t)width * (bottom - top + 1);                                 /* total points */
+    total = a_st7789_points_length(kernel, points);                                /* total length */
+    if (handle->framebuffer == NULL)                                               /* direct mode */
+    {
+        if (a_st7789_set_window(handle, left, top, right, bottom) != 0)            /* set window */
+        {
+            return 1;                                                              /* return error */
+        }
+    }
+    res = 0;                                                                       /* no error */
+    done = 0;                                                                      /* init 0 */
+    pos = 2;                                                                       /* the first block */
+    while (pos < len)                                                              /* all blocks */
+    {
+        if ((len - pos) < 5)                                                       /* check the block header */
+        {
+            handle->debug_print("st7789: data is invalid.\n");                     /* data is invalid */
+            res = 11;                                                              /* data is invalid */
+
+            break;                                                                 /* stop drawing */
+        }
+        method = data[pos];                                                        /* get method */
+        dec_len = (uint32_t)data[pos + 1] | ((uint32_t)data[pos + 2] << 8);        /* get decoded length */
+        enc_len = (uint32_t)data[pos + 3] | ((uint32_t)data[pos + 4] << 8);        /* get encoded length */
+        pos += 5;                                                                  /* the encoded bytes */
+        buf = a_st7789_get_buffer(handle, &size);                                  /* get the buffer */
+        if ((enc_len > (len - pos)) || (dec_len == 0) || (dec_len > (total - done)) ||
+            (((done + dec_len) != total) && ((dec_len % kernel->unit_size) != 0))) /* check the block */
+        {
+            handle->debug_print("st7789: data is invalid.\n");                     /* data is invalid */
+            res = 11;                                                              /* data is invalid */
+
+            break;                                                                 /* stop drawing */
+        }
+        if (dec_len > size)                                                        /* check the buffer */
+        {
+            handle->debug_print("st7789: block is over buffer size.\n");           /* block is over buffer size */
+            res = 11;                                                              /* data is invalid */
+
+            break;                                                                 /* stop drawing */
+        }
+        if ((method == 0) && (enc_len == dec_len))                                 /* stored */
+        {
+            memcpy(buf, &data[pos], dec_len);                                      /* copy the block */
+            res = 0;                                                               /* ok */
+        }
+        else if (method == 1)                                                      /* rle */
+        {
+            res = a_st7789_rle_decode(&data[pos], enc_len, buf, dec_len, kernel->unit_size); /* decode rle */
+        }
+        else if (method == 2)                                                      /* lz4 */
+        {
+            res = a_st7789_lz4_decode(&data[pos], enc_len, buf, dec_len);          /* decode lz4 */
+        }
+        else
+        {
+            res = 1;                                                               /* unknown method */
+        }
+        if (res != 0)                                                              /* check result */
+        {
+            handle->debug_print("st7789: data is invalid.\n");                     /* data is invalid */
+            res = 11;                                                              /* data is invalid */
+
+            break;                                                                 /* stop drawing */
+        }
+        if (handle->framebuffer != NULL)                                           /* framebuffer mode */
+        {
+            start = done / kernel->unit_size * kernel->unit_points;                /* first point of the block */
+            n = ((done + dec_len) == total) ? (points - start) :
+                (dec_len / kernel->unit_size * kernel->unit_points);               /* points of the block */
+            for (k = 0; k < n; k++)                                                /* all points */
+            {
+                p = start + k;                                                     /* point index */
+                if (kernel->unpack != NULL)                                        /* packed format */
+                {
+                    a_st7789_framebuffer_put(handle, left + p % width, top + p / width,
+                                             kernel->unpack(buf, k));              /* put the point */
+                }
+                else
+                {
+                    memcpy(&handle->framebuffer[((uint32_t)(top + p / width) * handle->column + left + p % width) *
+                           kernel->point_size], &buf[k * kernel->point_size], kernel->point_size); /* copy the point */
+                }
+            }
+        }
+        else
+        {
+            if (a_st7789_send_buffer(handle, buf, dec_len) != 0)                   /* send the buffer */
+            {
+                res = 1;                                                           /* write failed */
+
+                break;                                                             /* stop drawing */
+            }
+        }
+        done += dec_len;                                                           /* done + length */
+        pos += enc_len;                                                            /* next block */
+    }
+    if ((res == 0) && (done != total))                                             /* check the total length */
+    {
+        handle->debug_print("st7789: data is invalid.\n");                         /* data is invalid */
+        res = 11;                                                                  /* data is invalid */
+    }
+    if (res != 0)                                                                  /* the drawing stopped */
+    {
+        if (handle->framebuffer != NULL)                                           /* framebuffer mode */
+        {
+            n = done / kernel->unit_size * kernel->unit_points;                    /* points already written */
+            if (n != 0)                                                            /* check the points */
+            {
+                a_st7789_framebuffer_mark(handle, left, top, right, (uint16_t)(top + (n - 1) / width)); /* mark the written rows dirty */
+            }
+        }
+        else
+        {
+            handle->window_valid &= ~ST7789_WINDOW_POINTER;                        /* the window is not filled */
+            (void)a_st7789_wait(handle);                                           /* wait for the last half */
+        }
+
+        return res;                                                                /* return error */
+    }
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, left, top, right, bottom);               /* mark dirty */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return a_st7789_wait(handle);                                                  /* wait for the last half */
+}
+
+/**
+ * @brief      build a jpeg huffman table
+ * @param[out] *table pointer to a huffman table structure
+ * @param[in]  *count pointer to the code numbers of the lengths 1 - 16
+ * @param[in]  *value pointer to the values
+ * @return     status code
+ *             - 0 success
+ *             - 1 table is invalid
+ * @note       the codes are canonical, the codes up to 8 bits are also put in the lookup table
+ */
+static uint8_t a_st7789_jpeg_huffman_build(st7789_jpeg_huffman_t *table, const uint8_t *count, const uint8_t *value)
+{
+    uint32_t code;
+    uint32_t k;
+    uint32_t i;
+    uint32_t j;
+    uint8_t l;
+
+    memset(table, 0, sizeof(st7789_jpeg_huffman_t));                               /* clear the table */
+    code = 0;                                                                      /* init 0 */
+    k = 0;                                                                         /* init 0 */
+    table->maxcode[0] = -1;                                                        /* no code */
+    for (l = 1; l <= 16; l++)                                                      /* all lengths */
+    {
+        table->delta[l] = (int32_t)k - (int32_t)code;                              /* value index of the first code */
+        for (i = 0; i < count[l - 1]; i++)                                         /* all codes of the length */
+        {
+            if ((k >= 256) || (code >= (1U << l)))                                 /* check the values and codes */
+            {
+                return 1;                                                          /* return error */
+            }
+            table->value[k] = value[k];                                            /* set value */
+            if (l <= 8)                                                            /* short code */
+            {
+                for (j = 0; j < (1U << (8 - l)); j++)                              /* all lookup entries */
+                {
+                    table->fast[(code << (8 - l)) | j] = (uint16_t)((l << 8) | value[k]); /* set lookup */
+                }
+            }
+            code++;                                                                /* next code */
+            k++;                                                                   /* next value */
+        }
+        table->maxcode[l] = (count[l - 1] != 0) ? (int32_t)code - 1 : -1;          /* set max code */
+        code <<= 1;                                                                /* next length */
+    }
+    table->valid = 1;                                                              /* set valid */
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     fill the jpeg bit buffer
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @note      the stuffed 0x00 after 0xFF is dropped, zero bytes are fed after a marker or the data end
+ */
+static void a_st7789_jpeg_fill(st7789_jpeg_t *jpeg)
+{
+    uint32_t b;
+
+    while (jpeg->bit_num <= 24)                                                    /* room for a byte */
+    {
+        b = 0;                                                                     /* init 0 */
+        if ((jpeg->marker == 0) && (jpeg->pos >= jpeg->len))                       /* data end */
+        {
+            jpeg->marker = 0xD9;                                                   /* as end of image */
+        }
+        if (jpeg->marker == 0)                                                     /* entropy coded data */
+        {
+            b = jpeg->data[jpeg->pos];                                             /* get a byte */
+            jpeg->pos++;                                                           /* next byte */
+            if (b == 0xFF)                                                         /* stuffed byte or marker */
+            {
+                if ((jpeg->pos < jpeg->len) && (jpeg->data[jpeg->pos] == 0x00))    /* stuffed byte */
+                {
+                    jpeg->pos++;                                                   /* skip 0x00 */
+                }
+                else
+                {
+                    jpeg->marker = (jpeg->pos < jpeg->len) ? jpeg->data[jpeg->pos] : 0xD9; /* save the marker */
+                    jpeg->pos++;                                                   /* skip the marker */
+                    b = 0;                                                         /* no data */
+                }
+            }
+        }
+        if (jpeg->marker != 0)                                                     /* no more data */
+        {
+            jpeg->pad++;                                                           /* one more zero byte */
+        }
+        jpeg->bits |= b << (24 - jpeg->bit_num);                                   /* put the byte */
+        jpeg->bit_num += 8;                                                        /* 8 more bits */
+    }
+}
+
+/**
+ * @brief     drop bits from the jpeg bit buffer
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] n number of bits
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is over
+ * @note      the zero bytes fed after a marker or the data end can't be used
+ */
+static uint8_t a_st7789_jpeg_drop(st7789_jpeg_t *jpeg, uint8_t n)
+{
+    if (((uint32_t)n + (uint32_t)jpeg->pad * 8) > jpeg->bit_num)                   /* check the bits */
+    {
+        return 1;                                                                  /* return error */
+    }
+    jpeg->bits <<= n;                                                              /* drop the bits */
+    jpeg->bit_num -= n;                                                            /* n less bits */
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      decode a jpeg huffman value
+ * @param[in]  *jpeg pointer to a jpeg structure
+ * @param[in]  *table pointer to a huffman table structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       the codes up to 8 bits need one lookup
+ */
+static uint8_t a_st7789_jpeg_decode(st7789_jpeg_t *jpeg, const st7789_jpeg_huffman_t *table, uint8_t *value)
+{
+    uint16_t e;
+    uint8_t l;
+    int32_t code;
+
+    a_st7789_jpeg_fill(jpeg);                                                      /* fill the bits */
+    e = table->fast[jpeg->bits >> 24];                                             /* look up 8 bits */
+    if (e != 0)                                                                    /* short code */
+    {
+        *value = (uint8_t)(e & 0xFF);                                              /* set value */
+
+        return a_st7789_jpeg_drop(jpeg, (uint8_t)(e >> 8));                        /* drop the code */
+    }
+    for (l = 9; l <= 16; l++)                                                      /* long codes */
+    {
+        code = (int32_t)(jpeg->bits >> (32 - l));                                  /* get l bits */
+        if (code <= table->maxcode[l])                                             /* code found */
+        {
+            *value = table->value[code + table->delta[l]];                         /* set value */
+
+            return a_st7789_jpeg_drop(jpeg, l);                                    /* drop the code */
+        }
+    }
+
+    return 1;                                                                      /* return error */
+}
+
+/**
+ * @brief      receive a jpeg coefficient
+ * @param[in]  *jpeg pointer to a jpeg structure
+ * @param[in]  s coefficient bits
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       s is 1 - 16, the bits are sign extended as in the jpeg standard
+ */
+static uint8_t a_st7789_jpeg_receive(st7789_jpeg_t *jpeg, uint8_t s, int32_t *value)
+{
+    int32_t v;
+
+    a_st7789_jpeg_fill(jpeg);                                                      /* fill the bits */
+    v = (int32_t)(jpeg->bits >> (32 - s));                                         /* get s bits */
+    if (v < (1 << (s - 1)))                                                        /* negative */
+    {
+        v -= (1 << s) - 1;                                                         /* extend */
+    }
+    *value = v;                                                                    /* set value */
+
+    return a_st7789_jpeg_drop(jpeg, s);                                            /* drop the bits */
+}
+
+/**
+ * @brief      run the 1d jpeg idct
+ * @param[in]  *in pointer to the 8 inputs
+ * @param[in]  stride input stride
+ * @param[out] *out pointer to the 8 outputs
+ * @note       the integer loeffler idct with 13 bits constants, the outputs are scaled by 8192
+ */
+static void a_st7789_jpeg_idct_1d(const int32_t *in, uint8_t stride, int32_t *out)
+{
+    int32_t t0;
+    int32_t t1;
+    int32_t t2;
+    int32_t t3;
+    int32_t t10;
+    int32_t t11;
+    int32_t t12;
+    int32_t t13;
+    int32_t z1;
+    int32_t z2;
+    int32_t z3;
+    int32_t z4;
+    int32_t z5;
+
+    z2 = in[2 * stride];                                                           /* even part */
+    z3 = in[6 * stride];                                                           /* even part */
+    z1 = (z2 + z3) * 4433;                                                         /* 0.541196100 */
+    t2 = z1 - z3 * 15137;                                                          /* 1.847759065 */
+    t3 = z1 + z2 * 6270;                                                           /* 0.765366865 */
+    t0 = (in[0] + in[4 * stride]) * 8192;                                          /* scale */
+    t1 = (in[0] - in[4 * stride]) * 8192;                                          /* scale */
+    t10 = t0 + t3;                                                                 /* butterfly */
+    t13 = t0 - t3;                                                                 /* butterfly */
+    t11 = t1 + t2;                                                                 /* butterfly */
+    t12 = t1 - t2;                                                                 /* butterfly */
+    t0 = in[7 * stride];                                                           /* odd part */
+    t1 = in[5 * stride];                                                           /* odd part */
+    t2 = in[3 * stride];                                                           /* odd part */
+    t3 = in[1 * stride];                                                           /* odd part */
+    z1 = (t0 + t3) * -7373;                                                        /* -0.899976223 */
+    z2 = (t1 + t2) * -20995;                                                       /* -2.562915447 */
+    z5 = (t0 + t1 + t2 + t3) * 9633;                                               /* 1.175875602 */
+    z3 = (t0 + t2) * -16069 + z5;                                                  /* -1.961570560 */
+    z4 = (t1 + t3) * -3196 + z5;                                                   /* -0.390180644 */
+    t0 = t0 * 2446 + z1 + z3;                                                      /* 0.298631336 */
+    t1 = t1 * 16819 + z2 + z4;                                                     /* 2.053119869 */
+    t2 = t2 * 25172 + z2 + z3;                                                     /* 3.072711026 */
+    t3 = t3 * 12299 + z1 + z4;                                                     /* 1.501321110 */
+    out[0] = t10 + t3;                                                             /* output 0 */
+    out[7] = t10 - t3;                                                             /* output 7 */
+    out[1] = t11 + t2;                                                             /* output 1 */
+    out[6] = t11 - t2;                                                             /* output 6 */
+    out[2] = t12 + t1;                                                             /* output 2 */
+    out[5] = t12 - t1;                                                             /* output 5 */
+    out[3] = t13 + t0;                                                             /* output 3 */
+    out[4] = t13 - t0;                                                             /* output 4 */
+}
+
+/**
+ * @brief     clamp a jpeg sample
+ * @param[in] v sample
+ * @return    sample in 0 - 255
+ * @note      none
+ */
+static uint8_t a_st7789_jpeg_clamp(int32_t v)
+{
+    if (v < 0)                                                                     /* under 0 */
+    {
+        return 0;                                                                  /* return 0 */
+    }
+    if (v > 255)                                                                   /* over 255 */
+    {
+        return 255;                                                                /* return 255 */
+    }
+
+    return (uint8_t)v;                                                             /* return the sample */
+}
+
+/**
+ * @brief      run the 2d jpeg idct
+ * @param[in]  *coef pointer to the natural order coefficients
+ * @param[out] *out pointer to the 64 samples
+ * @note       columns first with 2 more bits, then rows, the column outputs are range limited so that
+ *             the row pass can not overflow on corrupt coefficients
+ */
+static void a_st7789_jpeg_idct(const int16_t *coef, uint8_t *out)
+{
+    int32_t in[64];
+    int32_t tmp[64];
+    int32_t v[8];
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < 64; i++)                                                       /* all coefficients */
+    {
+        in[i] = coef[i];                                                           /* copy */
+    }
+    for (i = 0; i < 8; i++)                                                        /* all columns */
+    {
+        a_st7789_jpeg_idct_1d(&in[i], 8, v);                                       /* column idct */
+        for (j = 0; j < 8; j++)                                                    /* all rows */
+        {
+            v[j] = (v[j] + 1024) >> 11;                                            /* keep 2 more bits */
+            tmp[j * 8 + i] = (v[j] < -8191) ? -8191 : ((v[j] > 8191) ? 8191 : v[j]); /* 13 bits as legal data */
+        }
+    }
+    for (i = 0; i < 8; i++)                                                        /* all rows */
+    {
+        a_st7789_jpeg_idct_1d(&tmp[i * 8], 1, v);                                  /* row idct */
+        for (j = 0; j < 8; j++)                                                    /* all columns */
+        {
+            out[i * 8 + j] = a_st7789_jpeg_clamp(((v[j] + (1 << 17)) >> 18) + 128); /* descale and level shift */
+        }
+    }
+}
+
+/**
+ * @brief      decode a jpeg block
+ * @param[in]  *jpeg pointer to a jpeg structure
+ * @param[in]  *comp pointer to a component structure
+ * @param[out] *out pointer to the block samples
+ * @param[in]  sh horizontal scale shift
+ * @param[in]  sv vertical scale shift
+ * @return     status code
+ *             - 0 success
+ *             - 1 data is invalid
+ * @note       the block has (8 >> sh) x (8 >> sv) samples, a block without ac coefficients skips the idct
+ */
+static uint8_t a_st7789_jpeg_block(st7789_jpeg_t *jpeg, st7789_jpeg_component_t *comp, uint8_t *out,
+                                   uint8_t sh, uint8_t sv)
+{
+    const uint16_t *quant;
+    uint8_t rs;
+    uint8_t k;
+    uint8_t ac;
+    uint8_t n;
+    uint8_t i;
+    uint8_t j;
+    uint8_t full[64];
+    uint32_t sum;
+    uint32_t r;
+    uint32_t c;
+    int32_t v;
+
+    quant = jpeg->quant[comp->tq];                                                 /* get the table */
+    memset(jpeg->coef, 0, sizeof(jpeg->coef));                                     /* clear the coefficients */
+    if (a_st7789_jpeg_decode(jpeg, &jpeg->huffman[comp->td], &rs) != 0)            /* decode the dc bits */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (rs > 11)                                                                   /* check the dc bits */
+    {
+        return 1;                                                                  /* return error */
+    }
+    v = 0;                                                                         /* init 0 */
+    if ((rs != 0) && (a_st7789_jpeg_receive(jpeg, rs, &v) != 0))                   /* receive the difference */
+    {
+        return 1;                                                                  /* return error */
+    }
+    v += comp->dc;                                                                 /* predict dc */
+    comp->dc = (v < -2047) ? -2047 : ((v > 2047) ? 2047 : v);                      /* keep the baseline range */
+    v = comp->dc * quant[0];                                                       /* dequantize */
+    jpeg->coef[0] = (int16_t)((v < -2047) ? -2047 : ((v > 2047) ? 2047 : v));      /* set dc */
+    ac = 0;                                                                        /* no ac */
+    k = 1;                                                                         /* the first ac */
+    while (k < 64)                                                                 /* all ac */
+    {
+        if (a_st7789_jpeg_decode(jpeg, &jpeg->huffman[2 + comp->ta], &rs) != 0)    /* decode run and bits */
+        {
+            return 1;                                                              /* return error */
+        }
+        if ((rs & 0x0F) == 0)                                                      /* no bits */
+        {
+            if (rs != 0xF0)                                                        /* end of block */
+            {
+                break;                                                             /* break */
+            }
+            k += 16;                                                               /* 16 zeros */
+
+            continue;                                                              /* next */
+        }
+        k += rs >> 4;                                                              /* skip the zeros */
+        if (k > 63)                                                                /* check the index */
+        {
+            return 1;                                                              /* return error */
+        }
+        if (a_st7789_jpeg_receive(jpeg, rs & 0x0F, &v) != 0)                       /* receive the coefficient */
+        {
+            return 1;                                                              /* return error */
+        }
+        v *= quant[gsc_st7789_jpeg_zigzag[k]];                                     /* dequantize */
+        jpeg->coef[gsc_st7789_jpeg_zigzag[k]] = (int16_t)((v < -2047) ? -2047 :
+                                                          ((v > 2047) ? 2047 : v)); /* set ac */
+        ac = 1;                                                                    /* has ac */
+        k++;                                                                       /* next */
+    }
+
+    n = 8 >> sh;                                                                   /* block width */
+    if (((sh == 3) && (sv == 3)) || (ac == 0))                                     /* flat block */
+    {
+        memset(out, a_st7789_jpeg_clamp(((jpeg->coef[0] + 4) >> 3) + 128), n * (8 >> sv)); /* dc only */
+
+        return 0;                                                                  /* success return 0 */
+    }
+    if ((sh == 0) && (sv == 0))                                                    /* full size */
+    {
+        a_st7789_jpeg_idct(jpeg->coef, out);                                       /* idct */
+
+        return 0;                                                                  /* success return 0 */
+    }
+    a_st7789_jpeg_idct(jpeg->coef, full);                                          /* idct */
+    for (i = 0; i < (8 >> sv); i++)                                                /* all output rows */
+    {
+        for (j = 0; j < n; j++)                                                    /* all output columns */
+        {
+            sum = 0;                                                               /* init 0 */
+            for (r = (uint32_t)i << sv; r < ((uint32_t)(i + 1) << sv); r++)        /* covered rows */
+            {
+                for (c = (uint32_t)j << sh; c < ((uint32_t)(j + 1) << sh); c++)    /* covered columns */
+                {
+                    sum += full[r * 8 + c];                                        /* sum */
+                }
+            }
+            out[i * n + j] = (uint8_t)((sum + (1U << (sh + sv - 1))) >> (sh + sv)); /* average */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     decode a jpeg mcu
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] shift luma scale shift
+ * @param[in] csh chroma horizontal scale shift
+ * @param[in] csv chroma vertical scale shift
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is invalid
+ * @note      the luma blocks go to sample[0] - sample[3] in the row major order, cb to sample[4] and cr to sample[5]
+ */
+static uint8_t a_st7789_jpeg_mcu(st7789_jpeg_t *jpeg, uint8_t shift, uint8_t csh, uint8_t csv)
+{
+    uint8_t i;
+    uint8_t b;
+    uint8_t n;
+
+    for (i = 0; i < jpeg->comp_num; i++)                                           /* all components */
+    {
+        n = (i == 0) ? (jpeg->h_max * jpeg->v_max) : 1;                            /* blocks of the component */
+        for (b = 0; b < n; b++)                                                    /* all blocks */
+        {
+            if (a_st7789_jpeg_block(jpeg, &jpeg->comp[i], jpeg->sample[(i == 0) ? b : (3 + i)],
+                                    (i == 0) ? shift : csh, (i == 0) ? shift : csv) != 0) /* decode a block */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     restart the jpeg entropy decoder
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is invalid
+ * @note      the bits left before the marker are dropped and the dc predictions are reset
+ */
+static uint8_t a_st7789_jpeg_restart(st7789_jpeg_t *jpeg)
+{
+    uint8_t i;
+
+    if (jpeg->marker == 0)                                                         /* marker not read yet */
+    {
+        while ((jpeg->pos < jpeg->len) && (jpeg->data[jpeg->pos] == 0xFF))         /* skip the fill bytes */
+        {
+            jpeg->pos++;                                                           /* next byte */
+        }
+        if (jpeg->pos < jpeg->len)                                                 /* check the data */
+        {
+            jpeg->marker = jpeg->data[jpeg->pos];                                  /* save the marker */
+            jpeg->pos++;                                                           /* skip the marker */
+        }
+    }
+    if ((jpeg->marker < 0xD0) || (jpeg->marker > 0xD7))                            /* check rst marker */
+    {
+        return 1;                                                                  /* return error */
+    }
+    jpeg->marker = 0;                                                              /* clear marker */
+    jpeg->bits = 0;                                                                /* clear bits */
+    jpeg->bit_num = 0;                                                             /* no bits */
+    jpeg->pad = 0;                                                                 /* no zero bytes */
+    for (i = 0; i < 3; i++)                                                        /* all components */
+    {
+        jpeg->comp[i].dc = 0;                                                      /* reset prediction */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     get a decoded jpeg point
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] c column in the mcu
+ * @param[in] r row in the mcu
+ * @param[in] lb log2 of the luma block size
+ * @param[in] lbh log2 of the chroma block width
+ * @param[in] lbv log2 of the chroma block height
+ * @param[in] *loss pointer to the dropped bits of red, green and blue
+ * @param[in] *kernel pointer to a pixel format kernel
+ * @return    point color
+ * @note      the chroma samples are repeated over the subsampled points
+ */
+static uint32_t a_st7789_jpeg_color(const st7789_jpeg_t *jpeg, uint32_t c, uint32_t r, uint8_t lb, uint8_t lbh,
+                                    uint8_t lbv, const uint8_t *loss, const st7789_kernel_t *kernel)
+{
+    uint32_t m;
+    int32_t y;
+    int32_t cb;
+    int32_t cr;
+    uint8_t rgb[3];
+    uint8_t i;
+    uint32_t color;
+
+    m = (1U << lb) - 1;                                                            /* block mask */
+    y = jpeg->sample[(r >> lb) * jpeg->h_max + (c >> lb)][((r & m) << lb) | (c & m)]; /* get luma */
+    if (jpeg->comp_num == 1)                                                       /* gray */
+    {
+        rgb[0] = (uint8_t)y;                                                       /* set red */
+        rgb[1] = (uint8_t)y;                                                       /* set green */
+        rgb[2] = (uint8_t)y;                                                       /* set blue */
+    }
+    else
+    {
+        m = (((r << (lbv - lb)) >> (jpeg->v_max - 1)) << lbh) |
+            ((c << (lbh - lb)) >> (jpeg->h_max - 1));                              /* chroma index */
+        cb = (int32_t)jpeg->sample[4][m] - 128;                                    /* get cb */
+        cr = (int32_t)jpeg->sample[5][m] - 128;                                    /* get cr */
+        rgb[0] = a_st7789_jpeg_clamp(y + ((91881 * cr + 32768) >> 16));            /* 1.402 */
+        rgb[1] = a_st7789_jpeg_clamp(y - ((22554 * cb + 46802 * cr - 32768) >> 16)); /* 0.344136 and 0.714136 */
+        rgb[2] = a_st7789_jpeg_clamp(y + ((116130 * cb + 32768) >> 16));           /* 1.772 */
+    }
+    color = 0;                                                                     /* init 0 */
+    for (i = 0; i < 3; i++)                                                        /* red, green and blue */
+    {
+        color |= (uint32_t)(rgb[i] >> loss[i]) << kernel->shift[i];                /* set the channel */
+    }
+
+    return color;                                                                  /* return the color */
+}
+
+/**
+ * @brief      put a point in the transfer bytes
+ * @param[in]  *kernel pointer to a pixel format kernel
+ * @param[out] *buf pointer to the transfer bytes
+ * @param[in]  i point index
+ * @param[in]  color point color
+ * @note       rgb444 packs two points in 3 bytes, the other formats send the framebuffer point bytes
+ */
+static void a_st7789_jpeg_put(const st7789_kernel_t *kernel, uint8_t *buf, uint32_t i, uint32_t color)
+{
+    uint8_t *p;
+
+    if (kernel->unpack != NULL)                                                    /* packed format */
+    {
+        p = &buf[i / 2 * 3];                                                       /* the point pair */
+        if ((i % 2) == 0)                                                          /* the first point */
+        {
+            p[0] = (uint8_t)((color >> 4) & 0xFF);                                 /* set the color */
+            p[1] = (uint8_t)((p[1] & 0x0F) | ((color & 0x0F) << 4));               /* set the color */
+        }
+        else
+        {
+            p[1] = (uint8_t)((p[1] & 0xF0) | ((color >> 8) & 0x0F));               /* set the color */
+            p[2] = (uint8_t)(color & 0xFF);                                        /* set the color */
+        }
+
+        return;                                                                    /* return */
+    }
+    kernel->put(&buf[i * kernel->unit_size], color);                               /* put the point */
+}
+
+/**
+ * @brief     init a jpeg picture
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] *data pointer to a mapped jpeg file
+ * @param[in] len jpeg file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is not a jpeg picture
+ *            - 2 jpeg is NULL
+ *            - 4 data is NULL
+ *            - 5 jpeg is not supported
+ * @note      the file must live as long as the jpeg structure, it is never copied,
+ *            the headers are parsed once and jpeg->width and jpeg->height are set
+ */
+uint8_t st7789_jpeg_init(st7789_jpeg_t *jpeg, const uint8_t *data, uint32_t len)
+{
+    const uint8_t *p;
+    uint32_t pos;
+    uint32_t seg;
+    uint32_t n;
+    uint32_t i;
+    uint32_t k;
+    uint32_t total;
+    uint8_t m;
+    uint8_t t;
+    uint8_t c;
+    uint8_t frame;
+
+    if (jpeg == NULL)                                                              /* check jpeg */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (data == NULL)                                                              /* check data */
+    {
+        return 4;                                                                  /* return error */
+    }
+
+    memset(jpeg, 0, sizeof(st7789_jpeg_t));                                        /* clear the jpeg */
+    if ((len < 4) || (data[0] != 0xFF) || (data[1] != 0xD8))                       /* check soi */
+    {
+        return 1;                                                                  /* return error */
+    }
+    jpeg->data = data;                                                             /* set data */
+    jpeg->len = len;                                                               /* set length */
+    frame = 0;                                                                     /* no frame */
+    pos = 2;                                                                       /* after soi */
+    while (1)                                                                      /* all markers */
+    {
+        if ((pos >= len) || (data[pos] != 0xFF))                                   /* check the marker */
+        {
+            return 1;                                                              /* return error */
+        }
+        while ((pos < len) && (data[pos] == 0xFF))                                 /* skip the fill bytes */
+        {
+            pos++;                                                                 /* next byte */
+        }
+        if (pos >= len)                                                            /* check the data */
+        {
+            return 1;                                                              /* return error */
+        }
+        m = data[pos];                                                             /* get the marker */
+        pos++;                                                                     /* skip the marker */
+        if (m == 0xD9)                                                             /* eoi before the scan */
+        {
+            return 1;                                                              /* return error */
+        }
+        if ((m == 0x01) || ((m >= 0xD0) && (m <= 0xD7)))                           /* marker without segment */
+        {
+            continue;                                                              /* next marker */
+        }
+        if ((len - pos) < 2)                                                       /* check the length */
+        {
+            return 1;                                                              /* return error */
+        }
+        seg = ((uint32_t)data[pos] << 8) | data[pos + 1];                          /* segment length */
+        if ((seg < 2) || (seg > (len - pos)))                                      /* check the segment */
+        {
+            return 1;                                                              /* return error */
+        }
+        p = &data[pos + 2];                                                        /* segment data */
+        n = seg - 2;                                                               /* segment data length */
+        pos += seg;                                                                /* next marker */
+        if (m == 0xDB)                                                             /* dqt */
+        {
+            i = 0;                                                                 /* init 0 */
+            while (i < n)                                                          /* all tables */
+            {
+                t = p[i] & 0x0F;                                                   /* table */
+                k = (p[i] >> 4) + 1;                                               /* 1 or 2 bytes a value */
+                i++;                                                               /* the values */
+                if ((t > 3) || (k > 2) || ((n - i) < (64 * k)))                    /* check the table */
+                {
+                    return 1;                                                      /* return error */
+                }
+                if (k != 1)                                                        /* 16 bits values need 12 bits samples */
+                {
+                    return 5;                                                      /* return error */
+                }
+                for (c = 0; c < 64; c++)                                           /* all values */
+                {
+                    jpeg->quant[t][gsc_st7789_jpeg_zigzag[c]] = (k == 1) ? p[i + c] :
+                        (uint16_t)(((uint16_t)p[i + c * 2] << 8) | p[i + c * 2 + 1]); /* set the value */
+                }
+                jpeg->quant_valid |= (uint8_t)(1 << t);                            /* set valid */
+                i += 64 * k;                                                       /* next table */
+            }
+        }
+        else if (m == 0xC4)                                                        /* dht */
+        {
+            i = 0;                                                                 /* init 0 */
+            while (i < n)                                                          /* all tables */
+            {
+                if ((n - i) < 17)                                                  /* check the counts */
+                {
+                    return 1;                                                      /* return error */
+                }
+                t = p[i];                                                          /* class and table */
+                total = 0;                                                         /* init 0 */
+                for (k = 0; k < 16; k++)                                           /* all lengths */
+                {
+                    total += p[i + 1 + k];                                         /* sum the codes */
+                }
+                if (((t & 0xEE) != 0) || (total > 256) || ((n - i - 17) < total))  /* check the table */
+                {
+                    return 1;                                                      /* return error */
+                }
+                if (a_st7789_jpeg_huffman_build(&jpeg->huffman[((t >> 4) * 2) + (t & 0x01)],
+                                                &p[i + 1], &p[i + 17]) != 0)       /* build the table */
+                {
+                    return 1;                                                      /* return error */
+                }
+                i += 17 + total;                                                   /* next table */
+            }
+        }
+        else if ((m == 0xC0) || (m == 0xC1))                                       /* baseline or extended sof */
+        {
+            if ((n < 6) || (frame != 0))                                           /* check the frame */
+            {
+                return 1;                                                          /* return error */
+            }
+            jpeg->height = (uint16_t)(((uint16_t)p[1] << 8) | p[2]);               /* set height */
+            jpeg->width = (uint16_t)(((uint16_t)p[3] << 8) | p[4]);                /* set width */
+            jpeg->comp_num = p[5];                                                 /* set component number */
+            if ((p[0] != 8) || (jpeg->width == 0) || (jpeg->height == 0) ||
+                ((jpeg->comp_num != 1) && (jpeg->comp_num != 3)))                  /* check the frame */
+            {
+                return 5;                                                          /* return error */
+            }
+            if (n < (6 + 3 * (uint32_t)jpeg->comp_num))                            /* check the components */
+            {
+                return 1;                                                          /* return error */
+            }
+            for (c = 0; c < jpeg->comp_num; c++)                                   /* all components */
+            {
+                jpeg->comp[c].id = p[6 + c * 3];                                   /* set id */
+                jpeg->comp[c].h = p[7 + c * 3] >> 4;                               /* set horizontal sampling */
+                jpeg->comp[c].v = p[7 + c * 3] & 0x0F;                             /* set vertical sampling */
+                jpeg->comp[c].tq = p[8 + c * 3];                                   /* set quantization table */
+                if (jpeg->comp[c].tq > 3)                                          /* check the table */
+                {
+                    return 1;                                                      /* return error */
+                }
+            }
+            frame = 1;                                                             /* set frame */
+        }
+        else if ((m >= 0xC2) && (m <= 0xCF) && (m != 0xC4) && (m != 0xC8) && (m != 0xCC)) /* other sof */
+        {
+            return 5;                                                              /* return error */
+        }
+        else if (m == 0xDD)                                                        /* dri */
+        {
+            if (n < 2)                                                             /* check the segment */
+            {
+                return 1;                                                          /* return error */
+            }
+            jpeg->restart = (uint16_t)(((uint16_t)p[0] << 8) | p[1]);              /* set restart interval */
+        }
+        else if (m == 0xDA)                                                        /* sos */
+        {
+            if ((frame == 0) || (n < 1) || (n < (1 + 2 * (uint32_t)p[0] + 3)))     /* check the scan */
+            {
+                return 1;                                                          /* return error */
+            }
+            if (p[0] != jpeg->comp_num)                                            /* one interleaved scan only */
+            {
+                return 5;                                                          /* return error */
+            }
+            for (i = 0; i < p[0]; i++)                                             /* all scan components */
+            {
+                for (c = 0; c < jpeg->comp_num; c++)                               /* find the component */
+                {
+                    if (jpeg->comp[c].id == p[1 + i * 2])                          /* found */
+                    {
+                        break;                                                     /* break */
+                    }
+                }
+                if ((c == jpeg->comp_num) || ((p[2 + i * 2] & 0xEE) != 0))         /* check the tables */
+                {
+                    return 1;                                                      /* return error */
+                }
+                jpeg->comp[c].td = p[2 + i * 2] >> 4;                              /* set dc table */
+                jpeg->comp[c].ta = p[2 + i * 2] & 0x0F;                            /* set ac table */
+            }
+            jpeg->scan = pos;                                                      /* entropy coded data */
+
+            break;                                                                 /* break */
+        }
+        else
+        {
+            continue;                                                              /* skip the segment */
+        }
+    }
+    if (jpeg->comp_num == 3)                                                       /* ycbcr */
+    {
+        if ((jpeg->comp[0].h < 1) || (jpeg->comp[0].h > 2) || (jpeg->comp[0].v < 1) || (jpeg->comp[0].v > 2) ||
+            (jpeg->comp[1].h != 1) || (jpeg->comp[1].v != 1) ||
+            (jpeg->comp[2].h != 1) || (jpeg->comp[2].v != 1))                      /* check the sampling */
+        {
+            return 5;                                                              /* return error */
+        }
+        jpeg->h_max = jpeg->comp[0].h;                                             /* set mcu width */
+        jpeg->v_max = jpeg->comp[0].v;                                             /* set mcu height */
+    }
+    else
+    {
+        jpeg->h_max = 1;                                                           /* one block */
+        jpeg->v_max = 1;                                                           /* one block */
+    }
+    for (c = 0; c < jpeg->comp_num; c++)                                           /* all components */
+    {
+        if (((jpeg->quant_valid & (1 << jpeg->comp[c].tq)) == 0) ||
+            (jpeg->huffman[jpeg->comp[c].td].valid == 0) ||
+            (jpeg->huffman[2 + jpeg->comp[c].ta].valid == 0))                      /* check the tables */
+        {
+            return 1;                                                              /* return error */
+        }
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw a jpeg picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] scale picture scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw jpeg failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 jpeg is invalid
+ *            - 6 scale is invalid
+ *            - 7 buffer is too small
+ *            - 8 data is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            one mcu row is decoded at a time straight into the transfer buffer and sent with one window,
+ *            a row wider than the buffer is sent in chunks of whole mcus
+ */
+uint8_t st7789_draw_jpeg(st7789_handle_t *handle, uint16_t x, uint16_t y, st7789_jpeg_t *jpeg, st7789_jpeg_scale_t scale)
+{
+    const st7789_kernel_t *kernel;
+    uint8_t *buf;
+    uint8_t shift;
+    uint8_t csh;
+    uint8_t csv;
+    uint8_t lb;
+    uint8_t lbh;
+    uint8_t lbv;
+    uint8_t i;
+    uint8_t loss[3];
+    uint8_t mask;
+    uint32_t mw;
+    uint32_t mh;
+    uint32_t vw;
+    uint32_t vh;
+    uint32_t mcux;
+    uint32_t mcuy;
+    uint32_t mx;
+    uint32_t my;
+    uint32_t mcu;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t c0;
+    uint32_t cw;
+    uint32_t kk;
+    uint32_t k;
+    uint32_t r;
+    uint32_t c;
+    uint32_t size;
+    uint32_t cap;
+
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if ((x >= handle->column) || (y >= handle->row))                               /* check x, y */
+    {
+        handle->debug_print("st7789: x or y is invalid.\n");                       /* x or y is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+    if ((jpeg == NULL) || (jpeg->scan == 0))                                       /* check jpeg */
+    {
+        handle->debug_print("st7789: jpeg is invalid.\n");                         /* jpeg is invalid */
+
+        return 5;                                                                  /* return error */
+    }
+    if (scale > ST7789_JPEG_SCALE_1_8)                                             /* check scale */
+    {
+        handle->debug_print("st7789: scale is invalid.\n");                        /* scale is invalid */
+
+        return 6;                                                                  /* return error */
+    }
+    kernel = handle->kernel;                                                       /* get kernel */
+    if (kernel == NULL)                                                            /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 1;                                                                  /* return error */
+    }
+
+    shift = (uint8_t)scale;                                                        /* scale shift */
+    csh = shift;                                                                   /* chroma horizontal scale shift */
+    csv = shift;                                                                   /* chroma vertical scale shift */
+    if ((shift != 0) && (jpeg->h_max > 1))                                         /* horizontally subsampled chroma */
+    {
+        csh = shift - 1;                                                           /* decode chroma twice as wide */
+    }
+    if ((shift != 0) && (jpeg->v_max > 1))                                         /* vertically subsampled chroma */
+    {
+        csv = shift - 1;                                                           /* decode chroma twice as high */
+    }
+    lb = 3 - shift;                                                                /* log2 of the luma block size */
+    lbh = 3 - csh;                                                                 /* log2 of the chroma block width */
+    lbv = 3 - csv;                                                                 /* log2 of the chroma block height */
+    mw = (uint32_t)jpeg->h_max << lb;                                              /* mcu width */
+    mh = (uint32_t)jpeg->v_max << lb;                                              /* mcu height */
+    vw = ((uint32_t)jpeg->width + (1U << shift) - 1) >> shift;                     /* picture width */
+    vh = ((uint32_t)jpeg->height + (1U << shift) - 1) >> shift;                    /* picture height */
+    vw = (vw > (uint32_t)(handle->column - x)) ? (uint32_t)(handle->column - x) : vw; /* clip at the panel edge */
+    vh = (vh > (uint32_t)(handle->row - y)) ? (uint32_t)(handle->row - y) : vh;    /* clip at the panel edge */
+    mcux = ((uint32_t)jpeg->width + jpeg->h_max * 8 - 1) / (jpeg->h_max * 8);      /* mcus in a row */
+    mcuy = ((uint32_t)jpeg->height + jpeg->v_max * 8 - 1) / (jpeg->v_max * 8);     /* mcu rows */
+    for (i = 0; i < 3; i++)                                                        /* red, green and blue */
+    {
+        loss[i] = 8;                                                               /* init 8 */
+        for (mask = kernel->mask[i]; mask != 0; mask >>= 1)                        /* count the channel bits */
+        {
+            loss[i]--;                                                             /* one bit less */
+        }
+    }
+    buf = a_st7789_get_buffer(handle, &size);                                      /* get the buffer */
+    cap = size / kernel->unit_size * kernel->unit_points;                          /* points in the buffer */
+    if ((handle->framebuffer == NULL) && (cap < (mw * ((mh > vh) ? vh : mh))))     /* check the buffer */
+    {
+        handle->debug_print("st7789: buffer is too small.\n");                     /* buffer is too small */
+
+        return 7;                                                                  /* return error */
+    }
+    jpeg->pos = jpeg->scan;                                                        /* rewind */
+    jpeg->bits = 0;                                                                /* clear bits */
+    jpeg->bit_num = 0;                                                             /* no bits */
+    jpeg->pad = 0;                                                                 /* no zero bytes */
+    jpeg->marker = 0;                                                              /* no marker */
+    for (i = 0; i < 3; i++)                                                        /* all components */
+    {
+        jpeg->comp[i].dc = 0;                                                      /* reset prediction */
+    }
+
+    mcu = 0;                                                                       /* init 0 */
+    for (my = 0; (my < mcuy) && ((my * mh) < vh); my++)                            /* all visible mcu rows */
+    {
+        rows = ((vh - my * mh) > mh) ? mh : (vh - my * mh);                        /* visible rows */
+        cols = (handle->framebuffer != NULL) ? mcux : (cap / (mw * rows));         /* mcus in a chunk */
+        mx = 0;                                                                    /* init 0 */
+        while (mx < mcux)                                                          /* all mcus of the row */
+        {
+            c0 = mx * mw;                                                          /* chunk column */
+            kk = (mcux - mx > cols) ? cols : (mcux - mx);                          /* mcus of the chunk */
+            cw = (c0 >= vw) ? 0 : (((vw - c0) > (kk * mw)) ? (kk * mw) : (vw - c0)); /* visible chunk width */
+            buf = a_st7789_get_buffer(handle, &size);                              /* get the buffer */
+            for (k = 0; k < kk; k++)                                               /* all mcus of the chunk */
+            {
+                if ((jpeg->restart != 0) && (mcu != 0) && ((mcu % jpeg->restart) == 0)) /* restart interval */
+                {
+                    if (a_st7789_jpeg_restart(jpeg) != 0)                          /* restart */
+                    {
+                        handle->debug_print("st7789: data is invalid.\n");         /* data is invalid */
+
+                        return 8;                                                  /* return error */
+                    }
+                }
+                if (a_st7789_jpeg_mcu(jpeg, shift, csh, csv) != 0)                 /* decode the mcu */
+                {
+                    handle->debug_print("st7789: data is invalid.\n");             /* data is invalid */
+
+                    return 8;                                                      /* return error */
+                }
+                mcu++;                                                             /* next mcu */
+                for (r = 0; r < rows; r++)                                         /* visible rows */
+                {
+                    for (c = 0; (c < mw) && ((k * mw + c) < cw); c++)              /* visible columns */
+                    {
+                        if (handle->framebuffer != NULL)                           /* framebuffer mode */
+                        {
+                            a_st7789_framebuffer_put(handle, (uint16_t)(x + c0 + k * mw + c), (uint16_t)(y + my * mh + r),
+                                                     a_st7789_jpeg_color(jpeg, c, r, lb, lbh, lbv, loss, kernel)); /* put the point */
+                        }
+                        else
+                        {
+                            a_st7789_jpeg_put(kernel, buf, r * cw + k * mw + c,
+                                              a_st7789_jpeg_color(jpeg, c, r, lb, lbh, lbv, loss, kernel)); /* put the point */
+                        }
+                    }
+                }
+            }
+            if ((cw != 0) && (handle->framebuffer == NULL))                        /* visible chunk */
+            {
+                if (a_st7789_set_window(handle, (uint16_t)(x + c0), (uint16_t)(y + my * mh),
+                                        (uint16_t)(x + c0 + cw - 1), (uint16_t)(y + my * mh + rows - 1)) != 0) /* set window */
+                {
+                    return 1;                                                      /* return error */
+                }
+                if (a_st7789_send_buffer(handle, buf, a_st7789_points_length(kernel, cw * rows)) != 0) /* send the buffer */
+                {
+                    return 1;                                                      /* return error */
+                }
+            }
+            mx += kk;                                                              /* next chunk */
+        }
+    }
+    if (handle->framebuffer != NULL)                                               /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, x, y, (uint16_t)(x + vw - 1), (uint16_t)(y + vh - 1)); /* mark dirty */
+
+        return 0;                                                                  /* success return 0 */
+    }
+
+    return a_st7789_wait(handle);                                                  /* wait for the last half */
+}
+
+/**
+ * @brief     draw a point in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color point color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw point failed
+ * @note      none
+ */
+static uint8_t a_st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color)
+{
+    uint32_t len;
+
+    if (handle->kernel == NULL)                                                    /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+    if (a_st7789_set_window(handle, x, y, x, y) != 0)                              /* set window */
+    {
+        return 1;                                                                  /* return error */
+    }
+
+    len = handle->kernel->fill(handle->buf, 1, color);                             /* set the color */
+    if (a_st7789_write_bytes(handle, handle->buf, len, ST7789_DATA) != 0)          /* write data */
+    {
+        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+
+        return 1;                                                                  /* return error */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     get the glyph of a char
+ * @param[in] chr display char
+ * @param[in] size display size
+ * @return    pointer to the glyph, NULL means the size is invalid
+ * @note      the glyph is column major and every column takes (size + 7) / 8 bytes with msb first
+ */
+static const uint8_t *a_st7789_get_glyph(uint8_t chr, uint8_t size)
+{
+    chr = chr - ' ';                                   /* get index */
+    if (size == 12)                                    /* if size 12 */
+    {
+        return gsc_st7789_ascii_1206[chr];             /* get ascii 1206 */
+    }
+    else if (size == 16)                               /* if size 16 */
+    {
+        return gsc_st7789_ascii_1608[chr];             /* get ascii 1608 */
+    }
+    else if (size == 24)                               /* if size 24 */
+    {
+        return gsc_st7789_ascii_2412[chr];             /* get ascii 2412 */
+    }
+    else
+    {
+        return NULL;                                   /* return NULL */
+    }
+}
+
+/**
+ * @brief     draw a char in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] chr display char
+ * @param[in] size display size
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 show char failed
+ * @note      every vertical run of the glyph is sent with one window
+ */
+static uint8_t a_st7789_show_char(st7789_handle_t *handle, uint16_t x, uint16_t y, uint8_t chr, uint8_t size, uint32_t color)
+{
+    const uint8_t *glyph;
+    uint8_t bytes;
+    uint8_t c;
+    uint8_t r;
+    uint8_t start;
+    uint8_t i;
+    uint8_t odd;
+    uint32_t j;
+
+    if (handle->kernel == NULL)                                                             /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                                /* format is invalid */
+
+        return 1;                                                                           /* return error */
+    }
+    glyph = a_st7789_get_glyph(chr, size);                                                  /* get glyph */
+    if (glyph == NULL)                                                                      /* check glyph */
+    {
+        return 1;                                                                           /* return error */
+    }
+    bytes = size / 8 + ((size % 8) ? 1 : 0);                                                /* bytes of one column */
+    for (c = 0; c < (size / 2); c++)                                                        /* all columns */
+    {
+        r = 0;                                                                              /* init 0 */
+        while (r < size)                                                                    /* find the runs */
+        {
+            if ((glyph[c * bytes + (r >> 3)] & (0x80 >> (r & 0x7))) == 0)                   /* if 0 */
+            {
+                r++;                                                                        /* next point */
+
+                continue;                                                                   /* continue */
+            }
+            start = r;                                                                      /* run start */
+            while ((r < size) && ((glyph[c * bytes + (r >> 3)] & (0x80 >> (r & 0x7))) != 0)) /* if 1 */
+            {
+                r++;                                                                        /* next point */
+            }
+            if (handle->framebuffer != NULL)                                                /* framebuffer mode */
+            {
+                for (i = start; i < r; i++)                                                 /* all points */
+                {
+                    if (((x + c) < handle->column) && ((y + i) < handle->row))              /* check point */
+                    {
+                        a_st7789_framebuffer_put(handle, x + c, y + i, color);              /* put the point */
+                    }
+                }
+            }
+            else
+            {
+                if (a_st7789_set_window(handle, x + c, y + start, x + c, y + r - 1) != 0)   /* set window */
+                {
+                    return 1;                                                               /* return error */
+                }
+                j = 0;                                                                      /* init 0 */
+                odd = 0;                                                                    /* init 0 */
+                for (i = start; i < r; i++)                                                 /* all points */
+                {
+                    if (handle->kernel->push(handle, color, &j, &odd) != 0)                 /* push color */
+                    {
+                        return 1;                                                           /* return error */
+                    }
+                }
+                if (a_st7789_push_end(handle, j, odd) != 0)                                 /* push end */
+                {
+                    return 1;                                                               /* return error */
+                }
+            }
+        }
+    }
+    if ((handle->framebuffer != NULL) && (x < handle->column) && (y < handle->row))         /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, x, y,
+                                  ((x + size / 2 - 1) < handle->column) ?
+                                  (x + size / 2 - 1) : (handle->column - 1),
+                                  ((y + size - 1) < handle->row) ?
+                                  (y + size - 1) : (handle->row - 1));                     /* mark dirty */
+    }
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     get the wire format glyph of a char from the glyph cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] chr display char
+ * @param[in] size display size
+ * @param[in] color display color
+ * @param[in] background background color
+ * @return    pointer to the glyph slot, NULL means the size is invalid
+ * @note      a missed glyph is expanded into the least recently used slot,
+ *            the caller must check that the glyph fits ST7789_GLYPH_SLOT_SIZE
+ */
+static st7789_glyph_slot_t *a_st7789_glyph_slot(st7789_handle_t *handle, uint8_t chr, uint8_t size,
+                                                uint32_t color, uint32_t background)
+{
+    st7789_glyph_slot_t *victim;
+    const uint8_t *glyph;
+    uint16_t row16[12];
+    uint32_t row32[12];
+    uint32_t point;
+    uint16_t i;
+    uint16_t row_len;
+    uint8_t bytes;
+    uint8_t c;
+    uint8_t r;
+
+    glyph = a_st7789_get_glyph(chr, size);                                         /* get glyph */
+    if (glyph == NULL)                                                             /* check glyph */
+    {
+        return NULL;                                                               /* return NULL */
+    }
+    handle->glyph_stamp++;                                                         /* use + 1 */
+    if (handle->glyph_stamp == 0)                                                  /* wrap */
+    {
+        for (i = 0; i < handle->glyph_slot_num; i++)                               /* all slots */
+        {
+            handle->glyph_slot[i].stamp = 0;                                       /* empty */
+        }
+        handle->glyph_stamp = 1;                                                   /* restart */
+    }
+    victim = &handle->glyph_slot[0];                                               /* init victim */
+    for (i = 0; i < handle->glyph_slot_num; i++)                                   /* all slots */
+    {
+        if ((handle->glyph_slot[i].stamp != 0) && (handle->glyph_slot[i].chr == chr) &&
+            (handle->glyph_slot[i].font == size) && (handle->glyph_slot[i].format == handle->format) &&
+            (handle->glyph_slot[i].color == color) && (handle->glyph_slot[i].background == background)) /* hit */
+        {
+            handle->glyph_slot[i].stamp = handle->glyph_stamp;                     /* set last use */
+            handle->glyph_hits++;                                                  /* hits + 1 */
+
+            return &handle->glyph_slot[i];                                         /* return the slot */
+        }
+        if (handle->glyph_slot[i].stamp < victim->stamp)                           /* less recently used */
+        {
+            victim = &handle->glyph_slot[i];                                       /* set victim */
+        }
+    }
+    handle->glyph_misses++;                                                        /* misses + 1 */
+    bytes = size / 8 + ((size % 8) ? 1 : 0);                                       /* bytes of one column */
+    row_len = (uint16_t)a_st7789_points_length(handle->kernel, size / 2);          /* bytes of one row */
+    for (r = 0; r < size; r++)                                                     /* all rows */
+    {
+        for (c = 0; c < (size / 2); c++)                                           /* all columns */
+        {
+            if ((glyph[c * bytes + (r >> 3)] & (0x80 >> (r & 0x7))) != 0)          /* if 1 */
+            {
+                point = color;                                                     /* set color */
+            }
+            else
+            {
+                point = background;                                                /* set background */
+            }
+            row16[c] = (uint16_t)point;                                            /* 12 and 16 bits point */
+            row32[c] = point;                                                      /* 18 bits point */
+        }
+        if (handle->kernel->convert16 != NULL)                                     /* 12 and 16 bits */
+        {
+            handle->kernel->convert16(row16, &victim->data[r * row_len], size / 2); /* convert the row */
+        }
+        else
+        {
+            handle->kernel->convert32(row32, &victim->data[r * row_len], size / 2); /* convert the row */
+        }
+    }
+    victim->color = color;                                                         /* set color */
+    victim->background = background;                                               /* set background */
+    victim->stamp = handle->glyph_stamp;                                           /* set last use */
+    victim->len = row_len * size;                                                  /* set length */
+    victim->chr = chr;                                                             /* set char */
+    victim->font = size;                                                           /* set font */
+    victim->format = handle->format;                                               /* set format */
+
+    return victim;                                                                 /* return the slot */
+}
+
+/**
+ * @brief     draw a line of chars with the background through the glyph cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a chars buffer
+ * @param[in] len chars length
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] size display size
+ * @return    status code
+ *            - 0 success
+ *            - 1 show line failed
+ * @note      every char is one window and one write of its cached wire format
+ */
+static uint8_t a_st7789_show_line_cached(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                         uint32_t color, uint32_t background, uint8_t size)
+{
+    st7789_glyph_slot_t *slot;
+    uint16_t i;
+
+    for (i = 0; i < len; i++)                                                      /* all chars */
+    {
+        slot = a_st7789_glyph_slot(handle, (uint8_t)str[i], size, color, background); /* get the glyph */
+        if (slot == NULL)                                                          /* check the glyph */
+        {
+            return 1;                                                              /* return error */
+        }
+        if (a_st7789_set_window(handle, x, y, x + size / 2 - 1, y + size - 1) != 0) /* set window */
+        {
+            return 1;                                                              /* return error */
+        }
+        if (a_st7789_write_bytes(handle, slot->data, slot->len, ST7789_DATA) != 0) /* write the glyph */
+        {
+            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+
+            return 1;                                                              /* return error */
+        }
+        x += size / 2;                                                             /* next char */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     draw a line of chars with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a chars buffer
+ * @param[in] len chars length
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] size display size
+ * @param[in] scale glyph scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 show line failed
+ * @note      the whole line is sent with one window, a scaled glyph repeats every point scale times in a row
+ *            and every row scale times, with the glyph cache every unscaled char is sent from its slot in direct mode
+ */
+static uint8_t a_st7789_show_line(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                  uint32_t color, uint32_t background, uint8_t size, uint8_t scale)
+{
+    const uint8_t *glyph;
+    uint8_t bytes;
+    uint8_t c;
+    uint8_t r;
+    uint8_t k;
+    uint8_t sr;
+    uint8_t odd;
+    uint16_t i;
+    uint32_t j;
+    uint32_t point;
+    uint16_t right;
+    uint16_t bottom;
+
+    if (handle->kernel == NULL)                                                             /* check format */
+    {
+        handle->debug_print("st7789: format is invalid.\n");                                /* format is invalid */
+
+        return 1;                                                                           /* return error */
+    }
+    if ((scale == 1) && (handle->glyph_slot != NULL) && (handle->framebuffer == NULL) &&
+        (a_st7789_points_length(handle->kernel, (uint32_t)(size / 2) * size) <= ST7789_GLYPH_SLOT_SIZE)) /* glyph cache */
+    {
+        return a_st7789_show_line_cached(handle, x, y, str, len, color, background, size);  /* show the cached line */
+    }
+    bytes = size / 8 + ((size % 8) ? 1 : 0);                                                /* bytes of one column */
+    right = x + len * (size / 2) * scale - 1;                                               /* right */
+    bottom = y + size * scale - 1;                                                          /* bottom */
+    if (handle->framebuffer == NULL)                                                        /* direct mode */
+    {
+        if (a_st7789_set_window(handle, x, y, right, bottom) != 0)                          /* set window */
+        {
+            return 1;                                                                       /* return error */
+        }
+    }
+    j = 0;                                                                                  /* init 0 */
+    odd = 0;                                                                                /* init 0 */
+    for (r = 0; r < (size * scale); r++)                                                    /* all rows */
+    {
+        sr = r / scale;                                                                     /* glyph row */
+        for (i = 0; i < len; i++)                                                           /* all chars */
+        {
+            glyph = a_st7789_get_glyph((uint8_t)str[i], size);                              /* get glyph */
+            if (glyph == NULL)                                                              /* check glyph */
+            {
+                return 1;                                                                   /* return error */
+            }
+            for (c = 0; c < (size / 2); c++)                                                /* all columns */
+            {
+                if ((glyph[c * bytes + (sr >> 3)] & (0x80 >> (sr & 0x7))) != 0)             /* if 1 */
+                {
+                    point = color;                                                          /* set color */
+                }
+                else
+                {
+                    point = background;                                                     /* set background */
+                }
+                for (k = 0; k < scale; k++)                                                 /* repeat the point */
+                {
+                    if (handle->framebuffer != NULL)                                        /* framebuffer mode */
+                    {
+                        a_st7789_framebuffer_put(handle, x + (i * (size / 2) + c) * scale + k,
+                                                 y + r, point);                             /* put the point */
+                    }
+                    else
+                    {
+                        if (handle->kernel->push(handle, point, &j, &odd) != 0)             /* push color */
+                        {
+                            return 1;                                                       /* return error */
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (handle->framebuffer != NULL)                                                        /* framebuffer mode */
+    {
+        a_st7789_framebuffer_mark(handle, x, y, right, bottom);                             /* mark dirty */
+
+        return 0;                                                                           /* success return 0 */
+    }
+
+    return a_st7789_push_end(handle, j, odd);                                               /* push end */
+}
+
+/**
+ * @brief     write a string in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw point failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ */
+uint8_t st7789_write_string(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len, uint32_t color, st7789_font_t font)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                    /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                           /* return error */
+    }
+    if((x >= handle->column) || (y >= handle->row))                          /* check x, y */
+    {
+        handle->debug_print("st7789: x or y is invalid.\n");                 /* x or y is invalid */
+
+        return 4;                                                            /* return error */
+    }
+
+    while ((len != 0) && (*str <= '~') && (*str >= ' '))                     /* write all string */
+    {
+        if (x >= (handle->column - (font / 2)))                              /* check x point */
+        {
+            x = 0;                                                           /* set x */
+            y += (uint8_t)font;                                              /* set next row */
+        }
+        if (y >= (handle->row - font))                                       /* check y pont */
+        {
+            y = x = 0;                                                       /* reset to 0 */
+        }
+        if (a_st7789_show_char(handle, x, y, *str, font, color) != 0)        /* show a char */
+        {
+            return 1;                                                        /* return error */
+        }
+        x += (uint8_t)(font / 2);                                            /* x + font/2 */
+        str++;                                                               /* str address++ */
+        len--;                                                               /* str length-- */
+    }
+
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     write the lines of a string with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @param[in] scale glyph scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ * @note      the chars of one display line are shown together
+ */
+static uint8_t a_st7789_write_lines(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                    uint32_t color, uint32_t background, st7789_font_t font, uint8_t scale)
+{
+    char *start;
+    uint16_t num;
+    uint16_t start_x;
+    uint16_t start_y;
+    uint16_t width;
+    uint16_t height;
+
+    width = (font / 2) * scale;                                                     /* char width */
+    height = font * scale;                                                          /* char height */
+    start = str;                                                                    /* init start */
+    num = 0;                                                                        /* init 0 */
+    start_x = x;                                                                    /* init start x */
+    start_y = y;                                                                    /* init start y */
+    while ((len != 0) && (*str <= '~') && (*str >= ' '))                            /* write all string */
+    {
+        if (x >= (handle->column - width))                                          /* check x point */
+        {
+            x = 0;                                                                  /* set x */
+            y += height;                                                            /* set next row */
+        }
+        if (y >= (handle->row - height))                                            /* check y pont */
+        {
+            y = x = 0;                                                              /* reset to 0 */
+        }
+        if ((num != 0) && ((y != start_y) || (x != (start_x + num * width))))       /* a new line */
+        {
+            if (a_st7789_show_line(handle, start_x, start_y, start, num,
+                                   color, background, font, scale) != 0)            /* show the line */
+            {
+                return 1;                                                           /* return error */
+            }
+            num = 0;                                                                /* clear number */
+        }
+        if (num == 0)                                                               /* line start */
+        {
+            start = str;                                                            /* set start */
+            start_x = x;                                                            /* set start x */
+            start_y = y;                                                            /* set start y */
+        }
+        num++;                                                                      /* number++ */
+        x += width;                                                                 /* x + char width */
+        str++;                                                                      /* str address++ */
+        len--;                                                                      /* str length-- */
+    }
+    if (num != 0)                                                                   /* the last line */
+    {
+        if (a_st7789_show_line(handle, start_x, start_y, start, num,
+                               color, background, font, scale) != 0)                /* show the line */
+        {
+            return 1;                                                               /* return error */
+        }
+    }
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     write a string with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ */
+uint8_t st7789_write_string_with_background(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                            uint32_t color, uint32_t background, st7789_font_t font)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                  /* return error */
+    }
+    if((x >= handle->column) || (y >= handle->row))                                 /* check x, y */
+    {
+        handle->debug_print("st7789: x or y is invalid.\n");                        /* x or y is invalid */
+
+        return 4;                                                                   /* return error */
+    }
+
+    return a_st7789_write_lines(handle, x, y, str, len, color, background, font, 1); /* write the lines */
+}
+
+/**
+ * @brief     write a scaled string with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @param[in] scale glyph scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 scale is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && 1 <= scale <= 4
+ *            every point of the glyph becomes a scale x scale block with the nearest neighbour,
+ *            so a 24 font gives digits up to 96 rows high without extra font tables,
+ *            every line of the string is still sent with one window
+ */
+uint8_t st7789_write_string_scaled(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                   uint32_t color, uint32_t background, st7789_font_t font, uint8_t scale)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                 /* return error */
+    }
+    if ((x >= handle->column) || (y >= handle->row))                               /* check x, y */
+    {
+        handle->debug_print("st7789: x or y is invalid.\n");                       /* x or y is invalid */
+
+        return 4;                                                                  /* return error */
+    }
+    if ((scale < 1) || (scale > 4))                                                /* check scale */
+    {
+        handle->debug_print("st7789: scale is invalid.\n");                        /* scale is invalid */
+
+        return 5;                                                                  /* return error */
+    }
+
+    return a_st7789_write_lines(handle, x, y, str, len, color, background, font, scale); /* write the lines */
+}
+
+/**
+ * @brief     get the coverage glyph of a char
+ * @param[in] chr display char
+ * @param[in] size display size
+ * @return    pointer to the glyph, NULL means the size is invalid
+ * @note      the glyph is row major and every row takes size / 4 bytes with the left point in the high nibble
+ */
+static const uint8_t *a_st7789_get_aa_glyph(uint8_t chr, uint8_t size)
+{
+    chr = chr - ' ';                                                               /* get index */
+    if (size == 12)                                                                /* if size 12 */
+    {
+        return gsc_st7789_ascii_aa_1206[chr];                                      /* get ascii aa 1206 */
+    }
+    else if (size == 16)                                                           /* if size 16 */
+    {
+        return gsc_st7789_ascii_aa_1608[chr];                                      /* get ascii aa 1608 */
+    }
+    else
+    {
+        return NULL;                                                               /* return NULL */
+    }
+}
+
+/**
+ * @brief     draw a line of anti-aliased chars in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a chars buffer
+ * @param[in] len chars length
+ * @param[in] *palette pointer to a blend palette
+ * @param[in] size display size
+ * @return    status code
+ *            - 0 success
+ *            - 1 show line failed
+ * @note      the whole line is sent with one window and every point is a palette lookup
+ */
+static uint8_t a_st7789_show_line_aa(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                     const uint32_t *palette, uint8_t size)
+{
+    const uint8_t *glyph;
+    uint8_t width;
+    uint8_t c;
+    uint8_t r;
+    uint8_t odd;
+    uint8_t coverage;
+    uint16_t i;
+    uint32_t j;
+    uint16_t right;
+    uint16_t bottom;
+
+    width = size / 2;                                                              /* glyph width */
+    right = x + len * width - 1;                                                   /* right */
+    bottom = y + size - 1;                                                         /* bottom */
+    if (a_st7789_blit_begin(handle, x, y, right, bottom) != 0)                     /* begin blit */
+    {
+        return 1;                                                                  /* return error */
     }
-    if (row > 320)                                             /* check column */
+    j = 0;                                                                         /* init 0 */
+    odd = 0;                                                                       /* init 0 */
+    for (r = 0; r < size; r++)                                                     /* all rows */
     {
-        handle->debug_print("st7789: row > 320.\n");           /* row > 320 */
-
-        return 4;                                              /* return error */
+        for (i = 0; i < len; i++)                                                  /* all chars */
+        {
+            glyph = a_st7789_get_aa_glyph((uint8_t)str[i], size);                  /* get glyph */
+            if (glyph == NULL)                                                     /* check glyph */
+            {
+                return 1;                                                          /* return error */
+            }
+            glyph += r * (width / 2);                                              /* row start */
+            for (c = 0; c < width; c++)                                            /* all columns */
+            {
+                coverage = ((c & 1) != 0) ? (glyph[c >> 1] & 0x0F) : (glyph[c >> 1] >> 4); /* get coverage */
+                if (a_st7789_blit_point(handle, x + i * width + c, y + r,
+                                        palette[coverage], &j, &odd) != 0)         /* blit point */
+                {
+                    return 1;                                                      /* return error */
+                }
+            }
+        }
     }
 
-    handle->row = row;                                         /* set row */
-
-    return 0;                                                  /* success return 0 */
+    return a_st7789_blit_end(handle, x, y, right, bottom, j, odd);                 /* end blit */
 }
 
 /**
- * @brief     clear the display
+ * @brief     write an anti-aliased string in the display
  * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
  * @return    status code
  *            - 0 success
- *            - 1 clear failed
+ *            - 1 write string failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 format is invalid
- * @note      none
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && font is ST7789_FONT_12 or ST7789_FONT_16
+ *            the glyphs have 4 bits coverage blended against the background by a palette built once,
+ *            every line of the string is sent with one window
  */
-uint8_t st7789_clear(st7789_handle_t *handle)
+uint8_t st7789_write_string_aa(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                               uint32_t color, uint32_t background, st7789_font_t font)
 {
-    uint8_t buf[4];
-    uint32_t i;
-    uint32_t m;
-    uint32_t n;
+    uint32_t palette[16];
+    char *start;
+    uint16_t num;
+    uint16_t start_x;
+    uint16_t start_y;
 
     if (handle == NULL)                                                            /* check handle */
     {
@@ -3462,387 +9648,755 @@ uint8_t st7789_clear(st7789_handle_t *handle)
     {
         return 3;                                                                  /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
-    }
-    buf[0] = (0x00 >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (0x00 >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((handle->column - 1) >> 8) & 0xFF;                                   /* end address msb */
-    buf[3] = ((handle->column - 1) >> 0) & 0xFF;                                   /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        return ST7789_STATUS_BUSY;                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
+    if ((x >= handle->column) || (y >= handle->row))                               /* check x, y */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        handle->debug_print("st7789: x or y is invalid.\n");                       /* x or y is invalid */
 
-        return 1;                                                                  /* return error */
+        return 4;                                                                  /* return error */
     }
-    buf[0] = (0x00 >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (0x00 >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((handle->row - 1) >> 8) & 0xFF;                                      /* end address msb */
-    buf[3] = ((handle->row - 1) >> 0) & 0xFF;                                      /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if ((font != ST7789_FONT_12) && (font != ST7789_FONT_16))                      /* check font */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+        handle->debug_print("st7789: font is invalid.\n");                         /* font is invalid */
 
-        return 1;                                                                  /* return error */
+        return 5;                                                                  /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    if (handle->kernel == NULL)                                                    /* check format */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
 
         return 1;                                                                  /* return error */
     }
 
-    if ((handle->format & 0x03) == 0x03)                                           /* rgb444 */
+    a_st7789_blend_palette(handle->kernel, color, background, palette);            /* build the palette */
+    start = str;                                                                   /* init start */
+    num = 0;                                                                       /* init 0 */
+    start_x = x;                                                                   /* init start x */
+    start_y = y;                                                                   /* init start y */
+    while ((len != 0) && (*str <= '~') && (*str >= ' '))                           /* write all string */
     {
-        memset(handle->buf, 0x00, sizeof(uint8_t) * ST7789_BUFFER_SIZE);           /* clear buffer */
-        m = ((uint32_t)(handle->row) * handle->column * 3 / 2) /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(handle->row) * handle->column * 3 / 2) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
+        if (x >= (handle->column - (font / 2)))                                    /* check x point */
         {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            x = 0;                                                                 /* set x */
+            y += (uint8_t)font;                                                    /* set next row */
         }
-        if (n != 0)                                                                /* not end */
+        if (y >= (handle->row - font))                                             /* check y point */
         {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            y = x = 0;                                                             /* reset to 0 */
         }
-    }
-    else if ((handle->format & 0x05) == 0x05)                                      /* rgb565 */
-    {
-        memset(handle->buf, 0x00, sizeof(uint8_t) * ST7789_BUFFER_SIZE);           /* clear buffer */
-        m = (uint32_t)(handle->row) * handle->column * 2 / ST7789_BUFFER_SIZE;     /* total times */
-        n = (uint32_t)(handle->row) * handle->column * 2 % ST7789_BUFFER_SIZE;     /* the last */
-        for (i = 0; i < m; i++)
+        if ((num != 0) && ((y != start_y) || (x != (start_x + num * (font / 2))))) /* a new line */
         {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
+            if (a_st7789_show_line_aa(handle, start_x, start_y, start, num,
+                                      palette, font) != 0)                         /* show the line */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
                 return 1;                                                          /* return error */
             }
+            num = 0;                                                               /* clear number */
         }
-        if (n != 0)                                                                /* not end */
+        if (num == 0)                                                              /* line start */
         {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            start = str;                                                           /* set start */
+            start_x = x;                                                           /* set start x */
+            start_y = y;                                                           /* set start y */
         }
+        num++;                                                                     /* number++ */
+        x += (uint8_t)(font / 2);                                                  /* x + font/2 */
+        str++;                                                                     /* str address++ */
+        len--;                                                                     /* str length-- */
     }
-    else if ((handle->format & 0x06) == 0x06)                                      /* rgb666 */
+    if (num != 0)                                                                  /* the last line */
     {
-        memset(handle->buf, 0x00, sizeof(uint8_t) * ST7789_BUFFER_SIZE);           /* clear buffer */
-        m = (uint32_t)(handle->row) * handle->column * 3 / ST7789_BUFFER_SIZE;     /* total times */
-        n = (uint32_t)(handle->row) * handle->column * 3 % ST7789_BUFFER_SIZE;     /* the last */
-        for (i = 0; i < m; i++)
-        {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
-        }
-        if (n != 0)                                                                /* not end */
+        if (a_st7789_show_line_aa(handle, start_x, start_y, start, num,
+                                  palette, font) != 0)                             /* show the line */
         {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            return 1;                                                              /* return error */
         }
     }
-    else
-    {
-        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
-
-        return 4;                                                                  /* return error */
-    }
 
     return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     fill the rect
- * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] left left coordinate x
- * @param[in] top top coordinate y
- * @param[in] right right coordinate x
- * @param[in] bottom bottom coordinate y
- * @param[in] color display color
- * @return    status code
- *            - 0 success
- *            - 1 fill rect failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 left is over column
- *            - 5 right is over column
- *            - 6 left >= right
- *            - 7 top is over row
- *            - 8 bottom is over row
- *            - 9 top >= bottom
- * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ * @brief      decode a utf-8 char
+ * @param[in]  *str pointer to a utf-8 string
+ * @param[in]  len string length
+ * @param[out] *code pointer to a code point buffer
+ * @return     decoded bytes
+ * @note       len > 0, an invalid or truncated sequence takes one byte and decodes to U+FFFD
  */
-uint8_t st7789_fill_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t color)
+static uint8_t a_st7789_utf8_decode(const char *str, uint16_t len, uint32_t *code)
 {
-    uint8_t buf[4];
-    uint32_t i;
-    uint32_t m;
-    uint32_t n;
+    const uint8_t *s;
+    uint8_t n;
+    uint8_t i;
+    uint32_t c;
 
-    if (handle == NULL)                                                            /* check handle */
+    s = (const uint8_t *)str;                                                      /* set bytes */
+    if (s[0] < 0x80)                                                               /* ascii */
     {
-        return 2;                                                                  /* return error */
+        *code = s[0];                                                              /* set code */
+
+        return 1;                                                                  /* one byte */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    else if ((s[0] & 0xE0) == 0xC0)                                                /* two bytes */
     {
-        return 3;                                                                  /* return error */
+        n = 2;                                                                     /* set length */
+        c = s[0] & 0x1F;                                                           /* set code */
     }
-    if (left > (handle->column - 1))                                               /* check left */
+    else if ((s[0] & 0xF0) == 0xE0)                                                /* three bytes */
     {
-        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+        n = 3;                                                                     /* set length */
+        c = s[0] & 0x0F;                                                           /* set code */
+    }
+    else if ((s[0] & 0xF8) == 0xF0)                                                /* four bytes */
+    {
+        n = 4;                                                                     /* set length */
+        c = s[0] & 0x07;                                                           /* set code */
+    }
+    else
+    {
+        *code = 0xFFFD;                                                            /* replacement char */
 
-        return 4;                                                                  /* return error */
+        return 1;                                                                  /* one byte */
     }
-    if (right > (handle->column - 1))                                              /* check right */
+    if (n > len)                                                                   /* truncated */
     {
-        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+        *code = 0xFFFD;                                                            /* replacement char */
 
-        return 5;                                                                  /* return error */
+        return 1;                                                                  /* one byte */
     }
-    if (left >= right)                                                             /* check left and right */
+    for (i = 1; i < n; i++)                                                        /* continuation bytes */
     {
-        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+        if ((s[i] & 0xC0) != 0x80)                                                 /* check the byte */
+        {
+            *code = 0xFFFD;                                                        /* replacement char */
 
-        return 6;                                                                  /* return error */
+            return 1;                                                              /* one byte */
+        }
+        c = (c << 6) | (s[i] & 0x3F);                                              /* add 6 bits */
     }
-    if (top > (handle->row - 1))                                                   /* check top */
+    if (((n == 2) && (c < 0x80)) || ((n == 3) && (c < 0x800)) || ((n == 4) && (c < 0x10000)) ||
+        (c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF)))                        /* overlong, surrogate or too big */
     {
-        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+        *code = 0xFFFD;                                                            /* replacement char */
 
-        return 7;                                                                  /* return error */
+        return 1;                                                                  /* one byte */
     }
-    if (bottom > (handle->row - 1))                                                /* check bottom */
+    *code = c;                                                                     /* set code */
+
+    return n;                                                                      /* return the length */
+}
+
+/**
+ * @brief      get a line of a bdf file
+ * @param[in]  *font pointer to a bdf font structure
+ * @param[in]  pos line start
+ * @param[out] *len pointer to a line length buffer
+ * @return     next line start
+ * @note       the line end and a carriage return are not in the line
+ */
+static uint32_t a_st7789_bdf_line(const st7789_bdf_t *font, uint32_t pos, uint32_t *len)
+{
+    uint32_t i;
+
+    for (i = pos; (i < font->len) && (font->data[i] != '\n'); i++)                 /* find the line end */
     {
-        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+    }
+    *len = i - pos;                                                                /* set length */
+    if ((*len != 0) && (font->data[i - 1] == '\r'))                                /* carriage return */
+    {
+        (*len)--;                                                                  /* length - 1 */
+    }
 
-        return 8;                                                                  /* return error */
+    return (i < font->len) ? (i + 1) : i;                                          /* return next line */
+}
+
+/**
+ * @brief     check the keyword of a bdf line
+ * @param[in] *line pointer to a line
+ * @param[in] len line length
+ * @param[in] *key pointer to a keyword
+ * @return    1 if the line starts with the keyword, 0 if not
+ * @note      none
+ */
+static uint8_t a_st7789_bdf_keyword(const char *line, uint32_t len, const char *key)
+{
+    uint32_t i;
+
+    for (i = 0; key[i] != '\0'; i++)                                               /* all keyword chars */
+    {
+        if ((i >= len) || (line[i] != key[i]))                                     /* check the char */
+        {
+            return 0;                                                              /* not the keyword */
+        }
     }
-    if (top >= bottom)                                                             /* check top and bottom */
+
+    return ((i == len) || (line[i] == ' ') || (line[i] == '\t')) ? 1 : 0;          /* the keyword ends */
+}
+
+/**
+ * @brief      parse the integers of a bdf line
+ * @param[in]  *line pointer to a line
+ * @param[in]  len line length
+ * @param[out] *value pointer to a values buffer
+ * @param[in]  num max values
+ * @return     parsed values
+ * @note       the keyword is skipped, parsing stops at a value over 0x10FFFF
+ */
+static uint8_t a_st7789_bdf_ints(const char *line, uint32_t len, int32_t *value, uint8_t num)
+{
+    uint32_t i;
+    uint8_t n;
+    uint8_t neg;
+
+    for (i = 0; (i < len) && (line[i] != ' ') && (line[i] != '\t'); i++)           /* skip the keyword */
     {
-        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+    }
+    for (n = 0; n < num; n++)                                                      /* all values */
+    {
+        while ((i < len) && ((line[i] == ' ') || (line[i] == '\t')))               /* skip the spaces */
+        {
+            i++;                                                                   /* next char */
+        }
+        neg = 0;                                                                   /* init 0 */
+        if ((i < len) && (line[i] == '-'))                                         /* negative */
+        {
+            neg = 1;                                                               /* set negative */
+            i++;                                                                   /* next char */
+        }
+        if ((i >= len) || (line[i] < '0') || (line[i] > '9'))                      /* no digit */
+        {
+            break;                                                                 /* break */
+        }
+        value[n] = 0;                                                              /* init 0 */
+        while ((i < len) && (line[i] >= '0') && (line[i] <= '9'))                  /* all digits */
+        {
+            value[n] = value[n] * 10 + (line[i] - '0');                            /* add the digit */
+            i++;                                                                   /* next char */
+            if (value[n] > 0x10FFFF)                                               /* over the last code point */
+            {
+                return n;                                                          /* stop before it overflows */
+            }
+        }
+        if (neg != 0)                                                              /* negative */
+        {
+            value[n] = -value[n];                                                  /* set sign */
+        }
+    }
 
-        return 9;                                                                  /* return error */
+    return n;                                                                      /* return the number */
+}
+
+/**
+ * @brief      load a glyph from a bdf file
+ * @param[in]  *font pointer to a bdf font structure
+ * @param[in]  code code point
+ * @param[out] *glyph pointer to a glyph structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 the glyph is not found or too big
+ * @note       the file is scanned from the first glyph
+ */
+static uint8_t a_st7789_bdf_load(const st7789_bdf_t *font, uint32_t code, st7789_glyph_t *glyph)
+{
+    const char *line;
+    uint32_t pos;
+    uint32_t next;
+    uint32_t len;
+    uint32_t i;
+    int32_t value[4];
+    uint8_t found;
+    uint8_t bytes;
+    uint8_t r;
+    uint8_t d;
+
+    found = 0;                                                                     /* not found */
+    pos = font->chars;                                                             /* the first glyph */
+    while (pos < font->len)                                                        /* all lines */
+    {
+        next = a_st7789_bdf_line(font, pos, &len);                                 /* get a line */
+        line = &font->data[pos];                                                   /* set line */
+        pos = next;                                                                /* next line */
+        if (found == 0)                                                            /* find the glyph */
+        {
+            if ((a_st7789_bdf_keyword(line, len, "ENCODING") != 0) &&
+                (a_st7789_bdf_ints(line, len, value, 1) == 1) && (value[0] >= 0) &&
+                ((uint32_t)value[0] == code))                                      /* the glyph */
+            {
+                found = 1;                                                         /* found */
+                glyph->width = 0;                                                  /* no bitmap */
+                glyph->height = 0;                                                 /* no bitmap */
+                glyph->x_offset = 0;                                               /* no offset */
+                glyph->y_offset = 0;                                               /* no offset */
+                glyph->advance = font->advance;                                    /* default advance */
+            }
+        }
+        else if (a_st7789_bdf_keyword(line, len, "DWIDTH") != 0)                   /* advance */
+        {
+            if ((a_st7789_bdf_ints(line, len, value, 1) == 1) && (value[0] >= 0) && (value[0] <= 255)) /* check the advance */
+            {
+                glyph->advance = (uint8_t)value[0];                                /* set advance */
+            }
+        }
+        else if (a_st7789_bdf_keyword(line, len, "BBX") != 0)                      /* bounding box */
+        {
+            if ((a_st7789_bdf_ints(line, len, value, 4) != 4) ||
+                (value[0] < 0) || (value[0] > 255) || (value[1] < 0) || (value[1] > 255) ||
+                (value[2] < -128) || (value[2] > 127) || (value[3] < -128) || (value[3] > 127) ||
+                (((value[0] + 7) / 8) * value[1] > ST7789_GLYPH_BYTES_MAX))        /* check the box */
+            {
+                return 1;                                                          /* return error */
+            }
+            glyph->width = (uint8_t)value[0];                                      /* set width */
+            glyph->height = (uint8_t)value[1];                                     /* set height */
+            glyph->x_offset = (int8_t)value[2];                                    /* set x offset */
+            glyph->y_offset = (int8_t)value[3];                                    /* set y offset */
+        }
+        else if (a_st7789_bdf_keyword(line, len, "BITMAP") != 0)                   /* bitmap */
+        {
+            bytes = (glyph->width + 7) / 8;                                        /* bytes of one row */
+            memset(glyph->bitmap, 0, bytes * glyph->height);                       /* clear the bitmap */
+            for (r = 0; (r < glyph->height) && (pos < font->len); r++)             /* all rows */
+            {
+                next = a_st7789_bdf_line(font, pos, &len);                         /* get a row */
+                line = &font->data[pos];                                           /* set line */
+                pos = next;                                                        /* next line */
+                for (i = 0; (i < len) && (i < (uint32_t)bytes * 2); i++)           /* all hex digits */
+                {
+                    if ((line[i] >= '0') && (line[i] <= '9'))                      /* 0 - 9 */
+                    {
+                        d = (uint8_t)(line[i] - '0');                              /* set digit */
+                    }
+                    else if ((line[i] >= 'A') && (line[i] <= 'F'))                 /* A - F */
+                    {
+                        d = (uint8_t)(line[i] - 'A' + 10);                         /* set digit */
+                    }
+                    else if ((line[i] >= 'a') && (line[i] <= 'f'))                 /* a - f */
+                    {
+                        d = (uint8_t)(line[i] - 'a' + 10);                         /* set digit */
+                    }
+                    else
+                    {
+                        break;                                                     /* break */
+                    }
+                    glyph->bitmap[r * bytes + i / 2] |= ((i & 1) != 0) ? d : (uint8_t)(d << 4); /* set the nibble */
+                }
+            }
+
+            return 0;                                                              /* success return 0 */
+        }
+        else if (a_st7789_bdf_keyword(line, len, "ENDCHAR") != 0)                  /* no bitmap */
+        {
+            return 0;                                                              /* success return 0 */
+        }
+        else
+        {
+            continue;                                                              /* other keywords */
+        }
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
+    return 1;                                                                      /* return error */
+}
+
+/**
+ * @brief     get a glyph through the cache
+ * @param[in] *font pointer to a bdf font structure
+ * @param[in] code code point
+ * @return    pointer to the glyph
+ * @note      a missed glyph replaces the least recently used entry, a char without a glyph is
+ *            cached as the default char or as a blank glyph so the file is scanned only once
+ */
+static const st7789_glyph_t *a_st7789_bdf_glyph(st7789_bdf_t *font, uint32_t code)
+{
+    st7789_glyph_t *victim;
+    uint16_t i;
+
+    font->stamp++;                                                                 /* use + 1 */
+    if (font->stamp == 0)                                                          /* wrap */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        for (i = 0; i < font->cache_num; i++)                                      /* all entries */
+        {
+            font->cache[i].stamp = 0;                                              /* empty */
+        }
+        font->stamp = 1;                                                           /* restart */
+    }
+    victim = &font->cache[0];                                                      /* init victim */
+    for (i = 0; i < font->cache_num; i++)                                          /* all entries */
+    {
+        if ((font->cache[i].stamp != 0) && (font->cache[i].code == code))          /* hit */
+        {
+            font->cache[i].stamp = font->stamp;                                    /* set last use */
+            font->hits++;                                                          /* hits + 1 */
 
-        return 1;                                                                  /* return error */
+            return &font->cache[i];                                                /* return the glyph */
+        }
+        if (font->cache[i].stamp < victim->stamp)                                  /* less recently used */
+        {
+            victim = &font->cache[i];                                              /* set victim */
+        }
     }
-    buf[0] = (left >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (left >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((right) >> 8) & 0xFF;                                                /* end address msb */
-    buf[3] = ((right) >> 0) & 0xFF;                                                /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    font->misses++;                                                                /* misses + 1 */
+    if (a_st7789_bdf_load(font, code, victim) != 0)                                /* load the glyph */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+        if ((code == font->default_char) ||
+            (a_st7789_bdf_load(font, font->default_char, victim) != 0))            /* load the default char */
+        {
+            victim->width = 0;                                                     /* no bitmap */
+            victim->height = 0;                                                    /* no bitmap */
+            victim->x_offset = 0;                                                  /* no offset */
+            victim->y_offset = 0;                                                  /* no offset */
+            victim->advance = font->advance;                                       /* default advance */
+        }
+    }
+    victim->code = code;                                                           /* set code */
+    victim->stamp = font->stamp;                                                   /* set last use */
 
-        return 1;                                                                  /* return error */
+    return victim;                                                                 /* return the glyph */
+}
+
+/**
+ * @brief     draw a glyph in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *font pointer to a bdf font structure
+ * @param[in] *glyph pointer to a glyph structure
+ * @param[in] x origin coordinate x
+ * @param[in] y line top coordinate y
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw glyph failed
+ * @note      every horizontal run of the glyph is sent with one window and clipped to the screen
+ */
+static uint8_t a_st7789_bdf_draw(st7789_handle_t *handle, const st7789_bdf_t *font, const st7789_glyph_t *glyph,
+                                 uint16_t x, uint16_t y, uint32_t color)
+{
+    const uint8_t *row;
+    int32_t left;
+    int32_t top;
+    uint8_t bytes;
+    uint8_t r;
+    uint8_t c;
+    uint8_t start;
+
+    bytes = (glyph->width + 7) / 8;                                                /* bytes of one row */
+    left = (int32_t)x + glyph->x_offset;                                           /* bitmap left */
+    top = (int32_t)y + font->ascent - glyph->y_offset - glyph->height;             /* bitmap top */
+    for (r = 0; r < glyph->height; r++)                                            /* all rows */
+    {
+        row = &glyph->bitmap[r * bytes];                                           /* row start */
+        c = 0;                                                                     /* init 0 */
+        while (c < glyph->width)                                                   /* find the runs */
+        {
+            if ((row[c >> 3] & (0x80 >> (c & 0x7))) == 0)                          /* if 0 */
+            {
+                c++;                                                               /* next point */
+
+                continue;                                                          /* continue */
+            }
+            start = c;                                                             /* run start */
+            while ((c < glyph->width) && ((row[c >> 3] & (0x80 >> (c & 0x7))) != 0)) /* if 1 */
+            {
+                c++;                                                               /* next point */
+            }
+            if (a_st7789_span(handle, left + start, top + r, left + c - 1, top + r, color) != 0) /* fill the run */
+            {
+                return 1;                                                          /* return error */
+            }
+        }
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+    return 0;                                                                      /* success return 0 */
+}
 
-        return 1;                                                                  /* return error */
-    }
-    buf[0] = (top >> 8) & 0xFF;                                                    /* start address msb */
-    buf[1] = (top >> 0) & 0xFF;                                                    /* start address lsb */
-    buf[2] = ((bottom) >> 8) & 0xFF;                                               /* end address msb */
-    buf[3] = ((bottom) >> 0) & 0xFF;                                               /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+/**
+ * @brief     draw a glyph cell with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *font pointer to a bdf font structure
+ * @param[in] *glyph pointer to a glyph structure
+ * @param[in] x origin coordinate x
+ * @param[in] y line top coordinate y
+ * @param[in] color display color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw cell failed
+ * @note      the cell is the advance wide and the line high, it is clipped to the screen and
+ *            sent with one window
+ */
+static uint8_t a_st7789_bdf_cell(st7789_handle_t *handle, const st7789_bdf_t *font, const st7789_glyph_t *glyph,
+                                 uint16_t x, uint16_t y, uint32_t color, uint32_t background)
+{
+    uint16_t right;
+    uint16_t bottom;
+    uint16_t r;
+    uint16_t c;
+    int32_t gx;
+    int32_t gy;
+    int32_t top;
+    uint32_t j;
+    uint32_t point;
+    uint8_t odd;
+    uint8_t bytes;
 
-        return 1;                                                                  /* return error */
+    if (glyph->advance == 0)                                                       /* no cell */
+    {
+        return 0;                                                                  /* success return 0 */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    right = x + glyph->advance - 1;                                                /* cell right */
+    bottom = y + font->ascent + font->descent - 1;                                 /* cell bottom */
+    right = (right < handle->column) ? right : (handle->column - 1);               /* clip right */
+    bottom = (bottom < handle->row) ? bottom : (handle->row - 1);                  /* clip bottom */
+    if (a_st7789_blit_begin(handle, x, y, right, bottom) != 0)                     /* begin blit */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
         return 1;                                                                  /* return error */
     }
-
-    if ((handle->format & 0x03) == 0x03)                                           /* rgb444 */
+    bytes = (glyph->width + 7) / 8;                                                /* bytes of one row */
+    top = (int32_t)font->ascent - glyph->y_offset - glyph->height;                 /* bitmap top in the cell */
+    j = 0;                                                                         /* init 0 */
+    odd = 0;                                                                       /* init 0 */
+    for (r = y; r <= bottom; r++)                                                  /* all rows */
     {
-        for (i = 0; i < ST7789_BUFFER_SIZE; i += 3)                                /* fill the buffer */
-        {
-            handle->buf[i] = (((color >> 8) & 0xF) << 4) |
-                             (((color >> 4) & 0xF) << 0);                          /* set the color */
-            handle->buf[i + 1] = (((color >> 0) & 0xF) << 4) |
-                                 (((color >> 8) & 0xF) << 0);                      /* set the color */
-            handle->buf[i + 2] = (((color >> 4) & 0xF) << 4) |
-                                 (((color >> 0) & 0xF) << 0);                      /* set the color */
-        }
-        m = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3 / 2) /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3 / 2) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
+        gy = (int32_t)(r - y) - top;                                               /* bitmap row */
+        for (c = x; c <= right; c++)                                               /* all columns */
         {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
+            gx = (int32_t)(c - x) - glyph->x_offset;                               /* bitmap column */
+            point = background;                                                    /* set background */
+            if ((gx >= 0) && (gx < glyph->width) && (gy >= 0) && (gy < glyph->height) &&
+                ((glyph->bitmap[gy * bytes + (gx >> 3)] & (0x80 >> (gx & 0x7))) != 0)) /* if 1 */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
+                point = color;                                                     /* set color */
             }
-        }
-        if (n != 0)                                                                /* not end */
-        {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
+            if (a_st7789_blit_point(handle, c, r, point, &j, &odd) != 0)           /* blit point */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
                 return 1;                                                          /* return error */
             }
         }
     }
-    else if ((handle->format & 0x05) == 0x05)                                      /* rgb565 */
-    {
-        for (i = 0; i < ST7789_BUFFER_SIZE; i += 2)                                /* fill the buffer */
+
+    return a_st7789_blit_end(handle, x, y, right, bottom, j, odd);                 /* end blit */
+}
+
+/**
+ * @brief     write a utf-8 string with a bdf font in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a utf-8 string
+ * @param[in] len string length in bytes
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] fill 1 to fill the cells with the background
+ * @param[in] *font pointer to a bdf font structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write utf8 failed
+ * @note      '\n' starts a new line and the other control chars are skipped
+ */
+static uint8_t a_st7789_write_utf8(st7789_handle_t *handle, uint16_t x, uint16_t y, const char *str, uint16_t len,
+                                   uint32_t color, uint32_t background, uint8_t fill, st7789_bdf_t *font)
+{
+    const st7789_glyph_t *glyph;
+    uint32_t code;
+    uint16_t height;
+    uint8_t n;
+
+    height = font->ascent + font->descent;                                         /* line height */
+    while ((len != 0) && (*str != '\0'))                                           /* write all string */
+    {
+        n = a_st7789_utf8_decode(str, len, &code);                                 /* decode a char */
+        str += n;                                                                  /* str address + n */
+        len -= n;                                                                  /* str length - n */
+        if (code == '\n')                                                          /* new line */
+        {
+            x = 0;                                                                 /* set x */
+            y += height;                                                           /* set next row */
+
+            continue;                                                              /* continue */
+        }
+        if (code < ' ')                                                            /* control char */
+        {
+            continue;                                                              /* continue */
+        }
+        glyph = a_st7789_bdf_glyph(font, code);                                    /* get glyph */
+        if ((x + glyph->advance) > handle->column)                                 /* check x point */
+        {
+            x = 0;                                                                 /* set x */
+            y += height;                                                           /* set next row */
+        }
+        if ((y + height) > handle->row)                                            /* check y point */
         {
-            handle->buf[i] = (color >> 8) & 0xFF;                                  /* set the color */
-            handle->buf[i + 1] = (color >> 0) & 0xFF;                              /* set the color */
+            y = x = 0;                                                             /* reset to 0 */
         }
-        m = (uint32_t)(right - left + 1) * (bottom - top + 1) * 2 /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 2) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
+        if (fill != 0)                                                             /* with the background */
         {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
+            if (a_st7789_bdf_cell(handle, font, glyph, x, y, color, background) != 0) /* draw cell */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
                 return 1;                                                          /* return error */
             }
         }
-        if (n != 0)                                                                /* not end */
+        else
         {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
+            if (a_st7789_bdf_draw(handle, font, glyph, x, y, color) != 0)          /* draw glyph */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
                 return 1;                                                          /* return error */
             }
         }
+        x += glyph->advance;                                                       /* x + advance */
+    }
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     init a bdf font
+ * @param[in] *font pointer to a bdf font structure
+ * @param[in] *data pointer to a mapped bdf file
+ * @param[in] len bdf file length
+ * @param[in] *cache pointer to a glyph cache buffer
+ * @param[in] num glyph cache entries
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is not a bdf font
+ *            - 2 font is NULL
+ *            - 4 data is NULL
+ *            - 5 cache is NULL
+ *            - 6 num is 0
+ * @note      the file and the cache must live as long as the font, the file is never copied and
+ *            the glyphs are decoded into the cache the first time they are used
+ */
+uint8_t st7789_bdf_init(st7789_bdf_t *font, const char *data, uint32_t len, st7789_glyph_t *cache, uint16_t num)
+{
+    const char *line;
+    uint32_t pos;
+    uint32_t next;
+    uint32_t n;
+    uint16_t i;
+    int32_t value[4];
+    int32_t ascent;
+    int32_t descent;
+    uint8_t bbx;
+
+    if (font == NULL)                                                              /* check font */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (data == NULL)                                                              /* check data */
+    {
+        return 4;                                                                  /* return error */
+    }
+    if (cache == NULL)                                                             /* check cache */
+    {
+        return 5;                                                                  /* return error */
+    }
+    if (num == 0)                                                                  /* check num */
+    {
+        return 6;                                                                  /* return error */
+    }
+
+    memset(font, 0, sizeof(st7789_bdf_t));                                         /* clear the font */
+    font->data = data;                                                             /* set data */
+    font->len = len;                                                               /* set length */
+    font->default_char = 0xFFFFFFFFU;                                              /* no default char */
+    font->cache = cache;                                                           /* set cache */
+    font->cache_num = num;                                                         /* set cache entries */
+    next = a_st7789_bdf_line(font, 0, &n);                                         /* get the first line */
+    if (a_st7789_bdf_keyword(data, n, "STARTFONT") == 0)                           /* check the file */
+    {
+        return 1;                                                                  /* return error */
     }
-    else if ((handle->format & 0x06) == 0x06)                                      /* rgb666 */
+    bbx = 0;                                                                       /* no bounding box */
+    ascent = -1;                                                                   /* no ascent */
+    descent = -1;                                                                  /* no descent */
+    pos = next;                                                                    /* the second line */
+    while (pos < len)                                                              /* all header lines */
     {
-        for (i = 0; i < ST7789_BUFFER_SIZE; i += 3)                                /* fill the buffer */
+        next = a_st7789_bdf_line(font, pos, &n);                                   /* get a line */
+        line = &data[pos];                                                         /* set line */
+        if (a_st7789_bdf_keyword(line, n, "STARTCHAR") != 0)                       /* the first glyph */
         {
-            handle->buf[i] = ((color >> 12) & 0x3F) << 2;                          /* set the color */
-            handle->buf[i + 1] = ((color >> 6) & 0x3F) << 2;                       /* set the color */
-            handle->buf[i + 2] = ((color >> 0) & 0x3F) << 2;                       /* set the color */
+            break;                                                                 /* break */
         }
-        m = (uint32_t)(right - left + 1) * (bottom - top + 1) * 3 /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
+        pos = next;                                                                /* next line */
+        if (a_st7789_bdf_keyword(line, n, "FONTBOUNDINGBOX") != 0)                 /* font bounding box */
         {
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
+            if ((a_st7789_bdf_ints(line, n, value, 4) == 4) && (value[0] > 0) && (value[0] <= 255) &&
+                (value[1] > 0) && (value[1] <= 255))                               /* check the box */
             {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
+                font->advance = (uint8_t)value[0];                                 /* set advance */
+                if (ascent < 0)                                                    /* no ascent */
+                {
+                    ascent = value[1] + value[3];                                  /* set ascent */
+                }
+                if (descent < 0)                                                   /* no descent */
+                {
+                    descent = -value[3];                                           /* set descent */
+                }
+                bbx = 1;                                                           /* set bounding box */
             }
         }
-        if (n != 0)                                                                /* not end */
+        else if ((a_st7789_bdf_keyword(line, n, "FONT_ASCENT") != 0) &&
+                 (a_st7789_bdf_ints(line, n, value, 1) == 1))                      /* font ascent */
         {
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            ascent = value[0];                                                     /* set ascent */
+        }
+        else if ((a_st7789_bdf_keyword(line, n, "FONT_DESCENT") != 0) &&
+                 (a_st7789_bdf_ints(line, n, value, 1) == 1))                      /* font descent */
+        {
+            descent = value[0];                                                    /* set descent */
+        }
+        else if ((a_st7789_bdf_keyword(line, n, "DEFAULT_CHAR") != 0) &&
+                 (a_st7789_bdf_ints(line, n, value, 1) == 1) && (value[0] >= 0))   /* default char */
+        {
+            font->default_char = (uint32_t)value[0];                               /* set default char */
+        }
+        else
+        {
+            continue;                                                              /* other keywords */
         }
     }
-    else
+    if ((bbx == 0) || (pos >= len) || (ascent < 0) || (descent < 0) ||
+        (ascent > 255) || (descent > 255) || ((ascent + descent) == 0))            /* check the header */
     {
-        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
-
-        return 4;                                                                  /* return error */
+        return 1;                                                                  /* return error */
+    }
+    font->chars = pos;                                                             /* set the first glyph */
+    font->ascent = (uint8_t)ascent;                                                /* set ascent */
+    font->descent = (uint8_t)descent;                                              /* set descent */
+    for (i = 0; i < num; i++)                                                      /* all entries */
+    {
+        cache[i].stamp = 0;                                                        /* empty */
     }
 
     return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     draw a picture
+ * @brief     write a utf-8 string with a bdf font in the display
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] left left coordinate x
- * @param[in] top top coordinate y
- * @param[in] right right coordinate x
- * @param[in] bottom bottom coordinate y
- * @param[in] *image pointer to an image buffer
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a utf-8 string
+ * @param[in] len string length in bytes
+ * @param[in] color display color
+ * @param[in] *font pointer to a bdf font structure
  * @return    status code
  *            - 0 success
- *            - 1 draw picture 12bits failed
+ *            - 1 write utf8 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 left is over column
- *            - 5 right is over column
- *            - 6 left >= right
- *            - 7 top is over row
- *            - 8 bottom is over row
- *            - 9 top >= bottom
- * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ *            - 4 x or y is invalid
+ *            - 5 font is NULL
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            y is the top of the line, '\n' starts a new line and the chars without a glyph use the default char,
+ *            every horizontal run of a glyph is sent with one window
  */
-uint8_t st7789_draw_picture_12bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image)
+uint8_t st7789_write_utf8(st7789_handle_t *handle, uint16_t x, uint16_t y, const char *str, uint16_t len,
+                          uint32_t color, st7789_bdf_t *font)
 {
-    uint8_t buf[4];
-    uint32_t i;
-    uint32_t j;
-    uint32_t m;
-    uint32_t n;
-    uint32_t point;
-
     if (handle == NULL)                                                            /* check handle */
     {
         return 2;                                                                  /* return error */
@@ -3851,759 +10405,678 @@ uint8_t st7789_draw_picture_12bits(st7789_handle_t *handle, uint16_t left, uint1
     {
         return 3;                                                                  /* return error */
     }
-    if (left > (handle->column - 1))                                               /* check left */
-    {
-        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
-
-        return 4;                                                                  /* return error */
-    }
-    if (right > (handle->column - 1))                                              /* check right */
-    {
-        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
-
-        return 5;                                                                  /* return error */
-    }
-    if (left >= right)                                                             /* check left and right */
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
     {
-        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
-
-        return 6;                                                                  /* return error */
+        return ST7789_STATUS_BUSY;                                                 /* return error */
     }
-    if (top > (handle->row - 1))                                                   /* check top */
+    if ((x >= handle->column) || (y >= handle->row))                               /* check x, y */
     {
-        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
+        handle->debug_print("st7789: x or y is invalid.\n");                       /* x or y is invalid */
 
-        return 7;                                                                  /* return error */
+        return 4;                                                                  /* return error */
     }
-    if (bottom > (handle->row - 1))                                                /* check bottom */
+    if (font == NULL)                                                              /* check font */
     {
-        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+        handle->debug_print("st7789: font is null.\n");                            /* font is null */
 
-        return 8;                                                                  /* return error */
+        return 5;                                                                  /* return error */
     }
-    if (top >= bottom)                                                             /* check top and bottom */
+    if (handle->kernel == NULL)                                                    /* check format */
     {
-        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
 
-        return 9;                                                                  /* return error */
+        return 1;                                                                  /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+    return a_st7789_write_utf8(handle, x, y, str, len, color, 0, 0, font);         /* write utf8 */
+}
 
-        return 1;                                                                  /* return error */
-    }
-    buf[0] = (left >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (left >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((right) >> 8) & 0xFF;                                                /* end address msb */
-    buf[3] = ((right) >> 0) & 0xFF;                                                /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+/**
+ * @brief     write a utf-8 string with a bdf font and the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a utf-8 string
+ * @param[in] len string length in bytes
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] *font pointer to a bdf font structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write utf8 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is NULL
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            y is the top of the line, '\n' starts a new line and the chars without a glyph use the default char,
+ *            every glyph cell is sent with one window
+ */
+uint8_t st7789_write_utf8_with_background(st7789_handle_t *handle, uint16_t x, uint16_t y, const char *str, uint16_t len,
+                                          uint32_t color, uint32_t background, st7789_bdf_t *font)
+{
+    if (handle == NULL)                                                            /* check handle */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        return 2;                                                                  /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
+    if (handle->inited != 1)                                                       /* check handle initialization */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
+        return 3;                                                                  /* return error */
     }
-    buf[0] = (top >> 8) & 0xFF;                                                    /* start address msb */
-    buf[1] = (top >> 0) & 0xFF;                                                    /* start address lsb */
-    buf[2] = ((bottom) >> 8) & 0xFF;                                               /* end address msb */
-    buf[3] = ((bottom) >> 0) & 0xFF;                                               /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (a_st7789_panel_busy(handle) != 0)                                          /* check the panel */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        return ST7789_STATUS_BUSY;                                                 /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    if ((x >= handle->column) || (y >= handle->row))                               /* check x, y */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        handle->debug_print("st7789: x or y is invalid.\n");                       /* x or y is invalid */
 
-        return 1;                                                                  /* return error */
+        return 4;                                                                  /* return error */
     }
-
-    if ((handle->format & 0x03) == 0x03)                                           /* rgb444 */
+    if (font == NULL)                                                              /* check font */
     {
-        uint16_t r;
-        uint16_t c;
-        uint16_t color;
-
-        c = right - left + 1;                                                      /* column */
-        r = bottom - top + 1;                                                      /* row */
-        point = 0;                                                                 /* image point init 0 */
-        m = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3 / 2) /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3 / 2) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
-        {
-            for (j = 0; j < ST7789_BUFFER_SIZE; j += 3)                            /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[i] = (((color >> 8) & 0xF) << 4) |
-                                 (((color >> 4) & 0xF) << 0);                      /* set the color */
-                handle->buf[i + 1] = (((color >> 0) & 0xF) << 4) |
-                                     (((color >> 8) & 0xF) << 0);                  /* set the color */
-                handle->buf[i + 2] = (((color >> 4) & 0xF) << 4) |
-                                     (((color >> 0) & 0xF) << 0);                  /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
-        }
-        if (n != 0)                                                                /* not end */
-        {
-            for (j = 0; j < n; j += 3)                                             /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[i] = (((color >> 8) & 0xF) << 4) |
-                                 (((color >> 4) & 0xF) << 0);                      /* set the color */
-                handle->buf[i + 1] = (((color >> 0) & 0xF) << 4) |
-                                     (((color >> 8) & 0xF) << 0);                  /* set the color */
-                handle->buf[i + 2] = (((color >> 4) & 0xF) << 4) |
-                                     (((color >> 0) & 0xF) << 0);                  /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
+        handle->debug_print("st7789: font is null.\n");                            /* font is null */
 
-                return 1;                                                          /* return error */
-            }
-        }
+        return 5;                                                                  /* return error */
     }
-    else
+    if (handle->kernel == NULL)                                                    /* check format */
     {
         handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
 
-        return 4;                                                                  /* return error */
+        return 1;                                                                  /* return error */
     }
 
-    return 0;                                                                      /* success return 0 */
+    return a_st7789_write_utf8(handle, x, y, str, len, color, background, 1, font); /* write utf8 */
 }
 
 /**
- * @brief     draw a picture
+ * @brief     draw a point in the display
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] left left coordinate x
- * @param[in] top top coordinate y
- * @param[in] right right coordinate x
- * @param[in] bottom bottom coordinate y
- * @param[in] *image pointer to an image buffer
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color point color
  * @return    status code
  *            - 0 success
- *            - 1 draw picture 16bits failed
+ *            - 1 draw point failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 left is over column
- *            - 5 right is over column
- *            - 6 left >= right
- *            - 7 top is over row
- *            - 8 bottom is over row
- *            - 9 top >= bottom
- * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 10 panel is busy
+ * @note      x < column && y < row
  */
-uint8_t st7789_draw_picture_16bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image)
-{
-    uint8_t buf[4];
-    uint32_t i;
-    uint32_t j;
-    uint32_t m;
-    uint32_t n;
-    uint32_t point;
-
-    if (handle == NULL)                                                            /* check handle */
+uint8_t st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color)
+{
+    if (handle == NULL)                                          /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                /* return error */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    if (handle->inited != 1)                                     /* check handle initialization */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                /* return error */
     }
-    if (left > (handle->column - 1))                                               /* check left */
+    if (a_st7789_panel_busy(handle) != 0)                        /* check the panel */
     {
-        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
-
-        return 4;                                                                  /* return error */
+        return ST7789_STATUS_BUSY;                               /* return error */
     }
-    if (right > (handle->column - 1))                                              /* check right */
+    if (x >= handle->column)                                     /* check x */
     {
-        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+        handle->debug_print("st7789: x is over column.\n");      /* x is over column */
 
-        return 5;                                                                  /* return error */
+        return 4;                                                /* return error */
     }
-    if (left >= right)                                                             /* check left and right */
+    if (y >= handle->row)                                        /* check y */
     {
-        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+        handle->debug_print("st7789: y is over row.\n");         /* y is over row */
 
-        return 6;                                                                  /* return error */
+        return 5;                                                /* return error */
     }
-    if (top > (handle->row - 1))                                                   /* check top */
-    {
-        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
 
-        return 7;                                                                  /* return error */
-    }
-    if (bottom > (handle->row - 1))                                                /* check bottom */
+    if (handle->framebuffer != NULL)                             /* framebuffer mode */
     {
-        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+        a_st7789_framebuffer_put(handle, x, y, color);           /* put the point */
+        a_st7789_framebuffer_mark(handle, x, y, x, y);           /* mark dirty */
 
-        return 8;                                                                  /* return error */
+        return 0;                                                /* success return 0 */
     }
-    if (top >= bottom)                                                             /* check top and bottom */
-    {
-        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
 
-        return 9;                                                                  /* return error */
-    }
+    return a_st7789_draw_point(handle, x, y, color);             /* draw point */
+}
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
+/**
+ * @brief     set the transfer buffer
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *buf pointer to a transfer buffer, NULL means use the inner buffer
+ * @param[in] len transfer buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set buffer failed
+ *            - 2 handle is NULL
+ *            - 4 len is too small
+ *            - 5 no inner buffer
+ * @note      len >= 16
+ *            it can be called before st7789_init and it must be when ST7789_BUFFER_SIZE is 0
+ *            all the chunked transfers use the buffer size, so a bigger buffer needs fewer transfers
+ *            with the async write the buffer is used in two halves of len / 2 bytes
+ */
+uint8_t st7789_set_buffer(st7789_handle_t *handle, uint8_t *buf, uint32_t len)
+{
+    if (handle == NULL)                                                             /* check handle */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
+        return 2;                                                                   /* return error */
     }
-    buf[0] = (left >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (left >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((right) >> 8) & 0xFF;                                                /* end address msb */
-    buf[3] = ((right) >> 0) & 0xFF;                                                /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (handle->inited == 1)                                                        /* the old buffer may be in flight */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        if (a_st7789_wait(handle) != 0)                                             /* wait for the last half */
+        {
+            return 1;                                                               /* return error */
+        }
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
+    if (buf == NULL)                                                                /* use the inner buffer */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+#if (ST7789_BUFFER_SIZE != 0)
+        handle->buf = handle->inner_buf;                                            /* set the inner buffer */
+        handle->buf_size = ST7789_BUFFER_SIZE;                                      /* set size */
+        handle->buf_half = 0;                                                       /* the first half */
 
-        return 1;                                                                  /* return error */
-    }
-    buf[0] = (top >> 8) & 0xFF;                                                    /* start address msb */
-    buf[1] = (top >> 0) & 0xFF;                                                    /* start address lsb */
-    buf[2] = ((bottom) >> 8) & 0xFF;                                               /* end address msb */
-    buf[3] = ((bottom) >> 0) & 0xFF;                                               /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+        return 0;                                                                   /* success return 0 */
+#else
+        handle->debug_print("st7789: no inner buffer.\n");                          /* no inner buffer */
 
-        return 1;                                                                  /* return error */
+        return 5;                                                                   /* return error */
+#endif
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    if (len < ST7789_BUFFER_SIZE_MIN)                                               /* check length */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        handle->debug_print("st7789: len is too small.\n");                         /* len is too small */
 
-        return 1;                                                                  /* return error */
+        return 4;                                                                   /* return error */
     }
 
-    if ((handle->format & 0x05) == 0x05)                                           /* rgb565 */
-    {
-        uint16_t r;
-        uint16_t c;
-        uint16_t color;
-
-        c = right - left + 1;                                                      /* column */
-        r = bottom - top + 1;                                                      /* row */
-        point = 0;                                                                 /* image point init 0 */
-        m = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 2) /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 2) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
-        {
-            for (j = 0; j < ST7789_BUFFER_SIZE; j += 2)                            /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[j] = (color >> 8) & 0xFF;                              /* set the color */
-                handle->buf[j + 1] = (color >> 0) & 0xFF;                          /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
+    handle->buf = buf;                                                              /* set buffer */
+    handle->buf_size = len;                                                         /* set size */
+    handle->buf_half = 0;                                                           /* the first half */
 
-                return 1;                                                          /* return error */
-            }
-        }
-        if (n != 0)                                                                /* not end */
-        {
-            for (j = 0; j < n; j += 2)                                             /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[j] = (color >> 8) & 0xFF;                              /* set the color */
-                handle->buf[j + 1] = (color >> 0) & 0xFF;                          /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
+    return 0;                                                                       /* success return 0 */
+}
 
-                return 1;                                                          /* return error */
-            }
-        }
-    }
-    else
+/**
+ * @brief     report the end of the async write
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] res write result, 0 means success
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the transport calls it from its completion interrupt or thread when the async write is done,
+ *            the driver then stops waiting at once and spi_write_cmd_busy is only polled as a fallback
+ */
+uint8_t st7789_async_complete(st7789_handle_t *handle, uint8_t res)
+{
+    if (handle == NULL)                                                             /* check handle */
     {
-        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
-
-        return 4;                                                                  /* return error */
+        return 2;                                                                   /* return error */
     }
 
-    return 0;                                                                      /* success return 0 */
+    handle->async_res = (res != 0) ? 1 : 0;                                         /* save the result before the busy flag */
+    handle->async_busy = 0;                                                         /* the write is done */
+
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief     draw a picture
+ * @brief     set the framebuffer
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] left left coordinate x
- * @param[in] top top coordinate y
- * @param[in] right right coordinate x
- * @param[in] bottom bottom coordinate y
- * @param[in] *image pointer to an image buffer
+ * @param[in] *framebuffer pointer to a framebuffer, NULL means detach the framebuffer
+ * @param[in] len framebuffer length
  * @return    status code
  *            - 0 success
- *            - 1 draw picture 18bits failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 left is over column
- *            - 5 right is over column
- *            - 6 left >= right
- *            - 7 top is over row
- *            - 8 bottom is over row
- *            - 9 top >= bottom
- * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
+ *            - 4 format is invalid
+ *            - 5 len is too small
+ * @note      len >= column * row * 2 in rgb444 and rgb565 format, len >= column * row * 3 in rgb666 format
  */
-uint8_t st7789_draw_picture_18bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t *image)
+uint8_t st7789_set_framebuffer(st7789_handle_t *handle, uint8_t *framebuffer, uint32_t len)
 {
-    uint8_t buf[4];
-    uint32_t i;
-    uint32_t j;
-    uint32_t m;
-    uint32_t n;
-    uint32_t point;
-
-    if (handle == NULL)                                                            /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                                   /* return error */
     }
-    if (left > (handle->column - 1))                                               /* check left */
+    if (framebuffer == NULL)                                                        /* detach */
     {
-        handle->debug_print("st7789: left is over column.\n");                     /* left is over column */
+        handle->framebuffer = NULL;                                                 /* clear framebuffer */
+        handle->framebuffer_size = 0;                                               /* clear size */
+        handle->dirty_num = 0;                                                      /* clear dirty areas */
 
-        return 4;                                                                  /* return error */
+        return 0;                                                                   /* success return 0 */
     }
-    if (right > (handle->column - 1))                                              /* check right */
+    if (handle->kernel == NULL)                                                     /* check format */
     {
-        handle->debug_print("st7789: right is over column.\n");                    /* right is over column */
+        handle->debug_print("st7789: format is invalid.\n");                        /* format is invalid */
 
-        return 5;                                                                  /* return error */
+        return 4;                                                                   /* return error */
     }
-    if (left >= right)                                                             /* check left and right */
+    if (len < (uint32_t)(handle->column) * handle->row * handle->kernel->point_size) /* check length */
     {
-        handle->debug_print("st7789: left >= right.\n");                           /* left >= right */
+        handle->debug_print("st7789: len is too small.\n");                         /* len is too small */
 
-        return 6;                                                                  /* return error */
+        return 5;                                                                   /* return error */
     }
-    if (top > (handle->row - 1))                                                   /* check top */
-    {
-        handle->debug_print("st7789: top is over row.\n");                         /* top is over row */
 
-        return 7;                                                                  /* return error */
+    handle->framebuffer = framebuffer;                                              /* set framebuffer */
+    handle->framebuffer_size = len;                                                 /* set size */
+    handle->dirty_num = 0;                                                          /* clear dirty areas */
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     set the glyph cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *slot pointer to a glyph slot buffer, NULL means detach the glyph cache
+ * @param[in] num glyph slot number
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 num is 0
+ * @note      it can be called before st7789_init
+ *            the cache takes num * sizeof(st7789_glyph_slot_t) bytes and keeps the text with the background
+ *            already expanded to the wire format, so a cached char is one window and one write, the least recently
+ *            used slot is replaced on a miss and the cache is not used in framebuffer mode
+ */
+uint8_t st7789_set_glyph_cache(st7789_handle_t *handle, st7789_glyph_slot_t *slot, uint16_t num)
+{
+    uint16_t i;
+
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
     }
-    if (bottom > (handle->row - 1))                                                /* check bottom */
+    if (slot == NULL)                                                               /* detach */
     {
-        handle->debug_print("st7789: bottom is over row.\n");                      /* bottom is over row */
+        handle->glyph_slot = NULL;                                                  /* clear slots */
+        handle->glyph_slot_num = 0;                                                 /* clear number */
 
-        return 8;                                                                  /* return error */
+        return 0;                                                                   /* success return 0 */
     }
-    if (top >= bottom)                                                             /* check top and bottom */
+    if (num == 0)                                                                   /* check num */
     {
-        handle->debug_print("st7789: top >= bottom.\n");                           /* top >= bottom */
+        handle->debug_print("st7789: num is 0.\n");                                 /* num is 0 */
 
-        return 9;                                                                  /* return error */
+        return 4;                                                                   /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
+    for (i = 0; i < num; i++)                                                       /* all slots */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
+        slot[i].stamp = 0;                                                          /* empty */
     }
-    buf[0] = (left >> 8) & 0xFF;                                                   /* start address msb */
-    buf[1] = (left >> 0) & 0xFF;                                                   /* start address lsb */
-    buf[2] = ((right) >> 8) & 0xFF;                                                /* end address msb */
-    buf[3] = ((right) >> 0) & 0xFF;                                                /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
-    {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+    handle->glyph_slot = slot;                                                      /* set slots */
+    handle->glyph_slot_num = num;                                                   /* set number */
+    handle->glyph_stamp = 0;                                                        /* clear use counter */
+    handle->glyph_hits = 0;                                                         /* clear hits */
+    handle->glyph_misses = 0;                                                       /* clear misses */
 
-        return 1;                                                                  /* return error */
-    }
+    return 0;                                                                       /* success return 0 */
+}
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+/**
+ * @brief     flush the dirty areas of the framebuffer to the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 framebuffer is NULL
+ *            - 10 panel is busy
+ * @note      none
+ */
+uint8_t st7789_flush(st7789_handle_t *handle)
+{
+    uint8_t i;
 
-        return 1;                                                                  /* return error */
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
     }
-    buf[0] = (top >> 8) & 0xFF;                                                    /* start address msb */
-    buf[1] = (top >> 0) & 0xFF;                                                    /* start address lsb */
-    buf[2] = ((bottom) >> 8) & 0xFF;                                               /* end address msb */
-    buf[3] = ((bottom) >> 0) & 0xFF;                                               /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        return 3;                                                                   /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
+        return ST7789_STATUS_BUSY;                                                  /* return error */
     }
-
-    if ((handle->format & 0x06) == 0x06)                                           /* rgb666 */
+    if (handle->framebuffer == NULL)                                                /* check framebuffer */
     {
-        uint16_t r;
-        uint16_t c;
-        uint32_t color;
+        handle->debug_print("st7789: framebuffer is NULL.\n");                      /* framebuffer is NULL */
 
-        c = right - left + 1;                                                      /* column */
-        r = bottom - top + 1;                                                      /* row */
-        point = 0;                                                                 /* image point init 0 */
-        m = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3) /
-             ST7789_BUFFER_SIZE;                                                   /* total times */
-        n = ((uint32_t)(right - left + 1) * (bottom - top + 1) * 3) %
-             ST7789_BUFFER_SIZE;                                                   /* the last */
-        for (i = 0; i < m; i++)
-        {
-            for (j = 0; j < ST7789_BUFFER_SIZE; j += 3)                            /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[j] = ((color >> 12) & 0x3F) << 2;                      /* set the color */
-                handle->buf[j + 1] = ((color >> 6) & 0x3F) << 2;                   /* set the color */
-                handle->buf[j + 2] = ((color >> 0) & 0x3F) << 2;                   /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf,
-                ST7789_BUFFER_SIZE, ST7789_DATA) != 0)                             /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
+        return 4;                                                                   /* return error */
+    }
 
-                return 1;                                                          /* return error */
-            }
-        }
-        if (n != 0)                                                                /* not end */
+    for (i = 0; i < handle->dirty_num; i++)                                         /* flush all dirty areas */
+    {
+        if (a_st7789_framebuffer_flush_area(handle, &handle->dirty[i]) != 0)        /* flush area */
         {
-            for (j = 0; j < n; j += 3)                                             /* fill the buffer */
-            {
-                color = image[(point % c) * r + (point / c)];                      /* set color */
-                handle->buf[j] = ((color >> 12) & 0x3F) << 2;                      /* set the color */
-                handle->buf[j + 1] = ((color >> 6) & 0x3F) << 2;                   /* set the color */
-                handle->buf[j + 2] = ((color >> 0) & 0x3F) << 2;                   /* set the color */
-                point++;                                                           /* point++ */
-            }
-            if (a_st7789_write_bytes(handle, handle->buf, n, ST7789_DATA) != 0)    /* write data */
-            {
-                handle->debug_print("st7789: write data failed.\n");               /* write data failed */
-
-                return 1;                                                          /* return error */
-            }
+            return 1;                                                               /* return error */
         }
     }
-    else
-    {
-        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
-
-        return 4;                                                                  /* return error */
-    }
+    handle->dirty_num = 0;                                                          /* clear dirty areas */
 
-    return 0;                                                                      /* success return 0 */
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief     draw a point in the display
+ * @brief     convert a screen row to the frame memory row
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] color point color
- * @return    status code
- *            - 0 success
- *            - 1 draw point failed
- * @note      none
+ * @param[in] y screen row
+ * @return    frame memory row
+ * @note      the scrolling area shows the frame memory from the start address and wraps at its end
  */
-static uint8_t a_st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color)
+static uint16_t a_st7789_scroll_row(st7789_handle_t *handle, uint16_t y)
 {
-    uint8_t buf[4];
+    uint16_t top;
+    uint16_t area;
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_CASET, ST7789_CMD) != 0)            /* write set column address command */
+    top = handle->scroll_top;                                                       /* get top */
+    area = handle->scroll_area;                                                     /* get area */
+    if ((area != 0) && (y >= top) && (y < (top + area)) &&
+        (handle->scroll_start >= top) && (handle->scroll_start < (top + area)))     /* in the scrolling area */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+        return top + (y - top + handle->scroll_start - top) % area;                 /* wrap in the area */
+    }
 
-        return 1;                                                                  /* return error */
+    return y;                                                                       /* fixed row */
+}
+
+/**
+ * @brief      convert a screen row to the frame memory row
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  y screen row
+ * @param[out] *row pointer to a frame memory row buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 y is over row
+ * @note       y < row
+ */
+uint8_t st7789_get_scroll_row(st7789_handle_t *handle, uint16_t y, uint16_t *row)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
     }
-    buf[0] = (x >> 8) & 0xFF;                                                      /* start address msb */
-    buf[1] = (x >> 0) & 0xFF;                                                      /* start address lsb */
-    buf[2] = (x >> 8) & 0xFF;                                                      /* end address msb */
-    buf[3] = (x >> 0) & 0xFF;                                                      /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
+        return 3;                                                                   /* return error */
+    }
+    if (y >= handle->row)                                                           /* check y */
+    {
+        handle->debug_print("st7789: y is over row.\n");                            /* y is over row */
 
-        return 1;                                                                  /* return error */
+        return 4;                                                                   /* return error */
     }
 
-    if (a_st7789_write_byte(handle, ST7789_CMD_RASET, ST7789_CMD) != 0)            /* write set row address command */
-    {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
+    *row = a_st7789_scroll_row(handle, y);                                          /* get the memory row */
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     initialize a scrolling text console
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *console pointer to an st7789 console structure
+ * @param[in] header fixed header rows
+ * @param[in] footer fixed footer rows
+ * @param[in] font text font
+ * @param[in] color text color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 console init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 header and footer are too large
+ *            - 10 panel is busy
+ * @note      header + footer + font <= row
+ */
+uint8_t st7789_console_init(st7789_handle_t *handle, st7789_console_t *console, uint16_t header, uint16_t footer,
+                            st7789_font_t font, uint32_t color, uint32_t background)
+{
+    uint16_t area;
 
-        return 1;                                                                  /* return error */
-    }
-    buf[0] = (y >> 8) & 0xFF;                                                      /* start address msb */
-    buf[1] = (y >> 0) & 0xFF;                                                      /* start address lsb */
-    buf[2] = (y >> 8) & 0xFF;                                                      /* end address msb */
-    buf[3] = (y >> 0) & 0xFF;                                                      /* end address lsb */
-    if (a_st7789_write_bytes(handle, buf, 4, ST7789_DATA) != 0)                    /* write data */
+    if (handle == NULL)                                                             /* check handle */
     {
-        handle->debug_print("st7789: write data failed.\n");                       /* write data failed */
-
-        return 1;                                                                  /* return error */
+        return 2;                                                                   /* return error */
     }
-
-    if (a_st7789_write_byte(handle, ST7789_CMD_RAMWR, ST7789_CMD) != 0)            /* write memory write command */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        handle->debug_print("st7789: write command failed.\n");                    /* write command failed */
-
-        return 1;                                                                  /* return error */
+        return 3;                                                                   /* return error */
     }
-
-    if ((handle->format & 0x03) == 0x03)                                           /* rgb444 */
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
     {
-        handle->buf[0] = (((color >> 8) & 0xF) << 4) |
-                         (((color >> 4) & 0xF) << 0);                              /* set the color */
-        handle->buf[1] = (((color >> 0) & 0xF) << 4);                              /* set the color */
-        if (a_st7789_write_bytes(handle, handle->buf,
-            2, ST7789_DATA) != 0)                                                  /* write data */
-        {
-            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
-
-            return 1;                                                              /* return error */
-        }
+        return ST7789_STATUS_BUSY;                                                  /* return error */
     }
-    else if ((handle->format & 0x05) == 0x05)                                      /* rgb565 */
+    if (((uint32_t)header + footer + font) > handle->row)                           /* check header and footer */
     {
-        handle->buf[0] = (color >> 8) & 0xFF;                                      /* set the color */
-        handle->buf[1] = (color >> 0) & 0xFF;                                      /* set the color */
-        if (a_st7789_write_bytes(handle, handle->buf,
-            2, ST7789_DATA) != 0)                                                  /* write data */
-        {
-            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
+        handle->debug_print("st7789: header and footer are too large.\n");          /* header and footer are too large */
 
-            return 1;                                                              /* return error */
-        }
+        return 4;                                                                   /* return error */
     }
-    else if ((handle->format & 0x06) == 0x06)                                      /* rgb666 */
-    {
-        handle->buf[0] = ((color >> 12) & 0x3F) << 2;                              /* set the color */
-        handle->buf[1] = ((color >> 6) & 0x3F) << 2;                               /* set the color */
-        handle->buf[2] = ((color >> 0) & 0x3F) << 2;                               /* set the color */
-        if (a_st7789_write_bytes(handle, handle->buf,
-            3, ST7789_DATA) != 0)                                                  /* write data */
-        {
-            handle->debug_print("st7789: write data failed.\n");                   /* write data failed */
 
-            return 1;                                                              /* return error */
-        }
-    }
-    else
+    console->top = header;                                                          /* set top */
+    console->lines = (handle->row - header - footer) / font;                        /* set lines */
+    console->columns = handle->column / (font / 2);                                 /* set columns */
+    console->font = font;                                                           /* set font */
+    console->color = color;                                                         /* set color */
+    console->background = background;                                               /* set background */
+    area = console->lines * font;                                                   /* scrolling area */
+    if (st7789_set_vertical_scrolling(handle, header, area,
+                                      ST7789_MEMORY_ROW - header - area) != 0)      /* set vertical scrolling */
     {
-        handle->debug_print("st7789: format is invalid.\n");                       /* format is invalid */
-
-        return 4;                                                                  /* return error */
+        return 1;                                                                   /* return error */
     }
 
-    return 0;                                                                      /* success return 0 */
+    return st7789_console_clear(handle, console);                                   /* clear the console */
 }
 
 /**
- * @brief     draw a char in the display
+ * @brief     write a string in the console
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] chr display char
- * @param[in] size display size
- * @param[in] color display color
+ * @param[in] *console pointer to an st7789 console structure
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
  * @return    status code
  *            - 0 success
- *            - 1 show char failed
+ *            - 1 console write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 10 panel is busy
  * @note      none
  */
-static uint8_t a_st7789_show_char(st7789_handle_t *handle, uint16_t x, uint16_t y, uint8_t chr, uint8_t size, uint32_t color)
+uint8_t st7789_console_write(st7789_handle_t *handle, st7789_console_t *console, char *str, uint16_t len)
 {
-    uint8_t temp, t, t1;
-    uint16_t y0 = y;
-    uint8_t csize = (size / 8 + ((size % 8) ? 1 : 0)) * (size / 2);                 /* get size */
+    char *start;
+    uint16_t num;
+    uint16_t area;
+    uint16_t row;
 
-    chr = chr - ' ';                                                                /* get index */
-    for (t = 0; t < csize; t++)                                                     /* write size */
+    if (handle == NULL)                                                             /* check handle */
     {
-        if (size == 12)                                                             /* if size 12 */
-        {
-            temp = gsc_st7789_ascii_1206[chr][t];                                   /* get ascii 1206 */
-        }
-        else if (size == 16)                                                        /* if size 16 */
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                  /* return error */
+    }
+
+    start = str;                                                                    /* init start */
+    num = 0;                                                                        /* init 0 */
+    while (len != 0)                                                                /* write all string */
+    {
+        if ((*str >= ' ') && (*str <= '~') && ((console->x + num) < console->columns))  /* a char in the line */
         {
-            temp = gsc_st7789_ascii_1608[chr][t];                                   /* get ascii 1608 */
+            if (num == 0)                                                           /* run start */
+            {
+                start = str;                                                        /* set start */
+            }
+            num++;                                                                  /* number++ */
+            str++;                                                                  /* str address++ */
+            len--;                                                                  /* str length-- */
+
+            continue;                                                               /* next char */
         }
-        else if(size == 24)                                                         /* if size 24 */
+        if (num != 0)                                                               /* show the run */
         {
-            temp = gsc_st7789_ascii_2412[chr][t];                                   /* get ascii 2412 */
+            row = a_st7789_scroll_row(handle, console->top + console->line * console->font);  /* get the memory row */
+            if (a_st7789_show_line(handle, console->x * (console->font / 2), row, start, num,
+                                   console->color, console->background, console->font, 1) != 0)  /* show the line */
+            {
+                return 1;                                                           /* return error */
+            }
+            console->x += num;                                                      /* move the cursor */
+            num = 0;                                                                /* clear number */
         }
-        else
+        if (*str == '\r')                                                           /* carriage return */
         {
-            return 1;                                                               /* return error */
+            console->x = 0;                                                         /* line start */
         }
-        for (t1 = 0; t1 < 8; t1++)                                                  /* write one line */
+        else if ((*str == '\n') || (console->x >= console->columns))                /* new line or wrap */
         {
-            if ((temp & 0x80) != 0)                                                 /* if 1 */
+            console->x = 0;                                                         /* line start */
+            if ((console->line + 1) < console->lines)                               /* not the last line */
+            {
+                console->line++;                                                    /* next line */
+            }
+            else
             {
-                if (a_st7789_draw_point(handle, x, y, color) != 0)                  /* draw point */
+                area = console->lines * console->font;                              /* scrolling area */
+                row = a_st7789_scroll_row(handle, console->top);                    /* the top line is exposed next */
+                if (st7789_fill_rect(handle, 0, row, handle->column - 1, row + console->font - 1,
+                                     console->background) != 0)                     /* clear the line */
+                {
+                    return 1;                                                       /* return error */
+                }
+                if (st7789_set_vertical_scroll_start_address(handle,
+                    console->top + (row - console->top + console->font) % area) != 0)  /* scroll one line */
                 {
                     return 1;                                                       /* return error */
                 }
             }
-            temp <<= 1;                                                             /* left shift 1 */
-            y++;
-            if ((y - y0) == size)                                                   /* reset size */
+            if (*str != '\n')                                                       /* wrapped char */
             {
-                y = y0;                                                             /* set y */
-                x++;                                                                /* x++ */
-
-                break;                                                              /* break */
+                continue;                                                           /* write it in the new line */
             }
         }
+        str++;                                                                      /* str address++ */
+        len--;                                                                      /* str length-- */
+    }
+    if (num != 0)                                                                   /* the last run */
+    {
+        row = a_st7789_scroll_row(handle, console->top + console->line * console->font);  /* get the memory row */
+        if (a_st7789_show_line(handle, console->x * (console->font / 2), row, start, num,
+                               console->color, console->background, console->font, 1) != 0)  /* show the line */
+        {
+            return 1;                                                               /* return error */
+        }
+        console->x += num;                                                          /* move the cursor */
     }
 
     return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief     write a string in the display
+ * @brief     clear the console
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] *str pointer to a write string address
- * @param[in] len length of the string
- * @param[in] color display color
- * @param[in] font string font
+ * @param[in] *console pointer to an st7789 console structure
  * @return    status code
  *            - 0 success
- *            - 1 draw point failed
+ *            - 1 console clear failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 x or y is invalid
- * @note      x < column && y < row
+ *            - 10 panel is busy
+ * @note      none
  */
-uint8_t st7789_write_string(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len, uint32_t color, st7789_font_t font)
+uint8_t st7789_console_clear(st7789_handle_t *handle, st7789_console_t *console)
 {
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                   /* return error */
     }
-    if((x >= handle->column) || (y >= handle->row))                          /* check x, y */
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
     {
-        handle->debug_print("ssd1351: x or y is invalid.\n");                /* x or y is invalid */
-
-        return 4;                                                            /* return error */
+        return ST7789_STATUS_BUSY;                                                  /* return error */
     }
 
-    while ((len != 0) && (*str <= '~') && (*str >= ' '))                     /* write all string */
+    if (st7789_fill_rect(handle, 0, console->top, handle->column - 1,
+                         console->top + console->lines * console->font - 1,
+                         console->background) != 0)                                 /* clear the scrolling area */
     {
-        if (x >= (handle->column - (font / 2)))                              /* check x point */
-        {
-            x = 0;                                                           /* set x */
-            y += (uint8_t)font;                                              /* set next row */
-        }
-        if (y >= (handle->row - font))                                       /* check y pont */
-        {
-            y = x = 0;                                                       /* reset to 0 */
-        }
-        if (a_st7789_show_char(handle, x, y, *str, font, color) != 0)        /* show a char */
-        {
-            return 1;                                                        /* return error */
-        }
-        x += (uint8_t)(font / 2);                                            /* x + font/2 */
-        str++;                                                               /* str address++ */
-        len--;                                                               /* str length-- */
+        return 1;                                                                   /* return error */
+    }
+    if (st7789_set_vertical_scroll_start_address(handle, console->top) != 0)        /* reset the start address */
+    {
+        return 1;                                                                   /* return error */
     }
+    console->line = 0;                                                              /* the first line */
+    console->x = 0;                                                                 /* line start */
 
-    return 0;                                                                /* success return 0 */
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief     draw a point in the display
+ * @brief     close the console
  * @param[in] *handle pointer to an st7789 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] color point color
+ * @param[in] *console pointer to an st7789 console structure
  * @return    status code
  *            - 0 success
- *            - 1 draw point failed
+ *            - 1 console deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 x is over column
- *            - 5 y is over row
- * @note      x < column && y < row
+ *            - 10 panel is busy
+ * @note      none
  */
-uint8_t st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color)
+uint8_t st7789_console_deinit(st7789_handle_t *handle, st7789_console_t *console)
 {
-    if (handle == NULL)                                          /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                     /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                /* return error */
+        return 3;                                                                   /* return error */
     }
-    if (x >= handle->column)                                     /* check x */
+    if (a_st7789_panel_busy(handle) != 0)                                           /* check the panel */
     {
-        handle->debug_print("ssd1351: x is over column.\n");     /* x is over column */
+        return ST7789_STATUS_BUSY;                                                  /* return error */
+    }
 
-        return 4;                                                /* return error */
+    if (st7789_set_vertical_scrolling(handle, 0, ST7789_MEMORY_ROW, 0) != 0)        /* whole screen */
+    {
+        return 1;                                                                   /* return error */
     }
-    if (y >= handle->row)                                        /* check y */
+    if (st7789_set_vertical_scroll_start_address(handle, 0) != 0)                   /* reset the start address */
     {
-        handle->debug_print("ssd1351: y is over row.\n");        /* y is over row */
-
-        return 5;                                                /* return error */
+        return 1;                                                                   /* return error */
     }
+    console->line = 0;                                                              /* the first line */
+    console->x = 0;                                                                 /* line start */
 
-    return a_st7789_draw_point(handle, x, y, color);             /* draw point */
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
@@ -4628,6 +11101,8 @@ uint8_t st7789_write_cmd(st7789_handle_t *handle, uint8_t cmd)
         return 3;                                               /* return error */
     }
 
+    a_st7789_invalidate(handle);                                /* the caches are unknown */
+
     return a_st7789_write_byte(handle, cmd, ST7789_CMD);        /* write command */
 }
 
@@ -4653,9 +11128,266 @@ uint8_t st7789_write_data(st7789_handle_t *handle, uint8_t data)
         return 3;                                                /* return error */
     }
 
+    a_st7789_invalidate(handle);                                 /* the caches are unknown */
+
     return a_st7789_write_byte(handle, data, ST7789_DATA);       /* write data */
 }
 
+/**
+ * @brief     check a script
+ * @param[in] *script pointer to a script buffer
+ * @param[in] len script length
+ * @return    status code
+ *            - 0 success
+ *            - 1 script is invalid
+ * @note      none
+ */
+static uint8_t a_st7789_script_check(const uint8_t *script, uint32_t len)
+{
+    uint32_t i;
+    uint32_t size;
+
+    i = 0;                                                                              /* first entry */
+    while (i < len)                                                                     /* check all entries */
+    {
+        if ((len - i) < 2)                                                              /* check the header */
+        {
+            return 1;                                                                   /* return error */
+        }
+        size = 2 + (script[i + 1] & ~ST7789_SCRIPT_DELAY) +
+               (((script[i + 1] & ST7789_SCRIPT_DELAY) != 0) ? 1 : 0);                  /* entry size */
+        if ((len - i) < size)                                                           /* check the params */
+        {
+            return 1;                                                                   /* return error */
+        }
+        i += size;                                                                      /* next entry */
+    }
+
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     find the reset default of a command
+ * @param[in] cmd command
+ * @return    pointer to the default entry, NULL if the command has no known default
+ * @note      none
+ */
+static const uint8_t *a_st7789_script_default(uint8_t cmd)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(gsc_st7789_reset_default); i += 2 + gsc_st7789_reset_default[i + 1])   /* find the command */
+    {
+        if (gsc_st7789_reset_default[i] == cmd)                                         /* found */
+        {
+            return &gsc_st7789_reset_default[i];                                        /* return the entry */
+        }
+    }
+
+    return NULL;                                                                        /* not found */
+}
+
+/**
+ * @brief     update the driver state after a script entry
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] cmd sent command
+ * @param[in] *param pointer to the sent params
+ * @param[in] len param length
+ * @note      none
+ */
+static void a_st7789_script_track(st7789_handle_t *handle, uint8_t cmd, const uint8_t *param, uint8_t len)
+{
+    uint8_t i;
+
+    i = a_st7789_shadow_find(cmd);                                                      /* find the register */
+    if ((i < ST7789_SHADOW_NUM) && (gsc_st7789_shadow[i].len == len))                   /* a whole shadowed register */
+    {
+        memcpy(&handle->shadow[gsc_st7789_shadow[i].offset], param, len);               /* save the params */
+        handle->shadow_valid[i / 8] |= (1 << (i % 8));                                  /* the shadow is valid */
+    }
+    else if (i < ST7789_SHADOW_NUM)                                                     /* a partial write */
+    {
+        handle->shadow_valid[i / 8] &= ~(1 << (i % 8));                                 /* the register is unknown */
+    }
+    if (cmd == ST7789_CMD_SWRESET)                                                      /* software reset */
+    {
+        a_st7789_software_reset_state(handle);                                          /* power on state */
+    }
+    else if ((cmd == ST7789_CMD_COLMOD) && (len == 1))                                  /* interface pixel format */
+    {
+        handle->format = param[0];                                                      /* set format */
+        a_st7789_kernel_resolve(handle);                                                /* resolve the kernel */
+        a_st7789_framebuffer_check(handle);                                             /* check framebuffer */
+    }
+    else if ((cmd == ST7789_CMD_VSCRDEF) && (len == 6))                                 /* vertical scrolling definition */
+    {
+        handle->scroll_top = ((uint16_t)param[0] << 8) | param[1];                      /* save top fixed area */
+        handle->scroll_area = ((uint16_t)param[2] << 8) | param[3];                     /* save scrolling area */
+    }
+    else if ((cmd == ST7789_CMD_VSCRSADD) && (len == 2))                                /* vertical scrolling start address */
+    {
+        handle->scroll_start = ((uint16_t)param[0] << 8) | param[1];                    /* save start address */
+    }
+    else if ((cmd == ST7789_CMD_MADCTL) || (cmd == ST7789_CMD_CASET) || (cmd == ST7789_CMD_RASET) ||
+             (cmd == ST7789_CMD_RAMWR) || (cmd == ST7789_CMD_RAMWRC))                   /* the address window changes */
+    {
+        handle->window_valid = 0;                                                       /* the address window is unknown */
+    }
+}
+
+/**
+ * @brief     run an init script
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *script pointer to a script buffer
+ * @param[in] len script length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run script failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 script is invalid
+ *            - 10 panel is busy
+ * @note      commands without params are sent together in one command transfer and the command of the
+ *            next entry with params joins them, so an entry with params costs one command and one data
+ *            transfer, the register shadow, the pixel format and the scrolling state follow the script
+ */
+uint8_t st7789_run_script(st7789_handle_t *handle, const uint8_t *script, uint32_t len)
+{
+    uint8_t num;
+    uint8_t param;
+    uint8_t delay;
+    uint8_t cmd[ST7789_SCRIPT_BATCH];
+    uint32_t i;
+
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (a_st7789_panel_busy(handle) != 0)                                               /* check the panel */
+    {
+        return ST7789_STATUS_BUSY;                                                      /* return error */
+    }
+    if ((script == NULL) || (a_st7789_script_check(script, len) != 0))                  /* check script */
+    {
+        handle->debug_print("st7789: script is invalid.\n");                            /* script is invalid */
+
+        return 4;                                                                       /* return error */
+    }
+
+    num = 0;                                                                            /* no pending command */
+    i = 0;                                                                              /* first entry */
+    while (i < len)                                                                     /* run all entries */
+    {
+        param = script[i + 1] & ~ST7789_SCRIPT_DELAY;                                   /* param length */
+        delay = script[i + 1] & ST7789_SCRIPT_DELAY;                                    /* delay flag */
+        cmd[num++] = script[i];                                                         /* queue the command */
+        if ((param != 0) || (delay != 0) || (num == ST7789_SCRIPT_BATCH) ||
+            ((i + 2) == len))                                                           /* flush the commands */
+        {
+            if (a_st7789_write_bytes(handle, cmd, num, ST7789_CMD) != 0)                /* write commands */
+            {
+                handle->debug_print("st7789: write command failed.\n");                 /* write command failed */
+                a_st7789_invalidate(handle);                                            /* the caches are unknown */
+
+                return 1;                                                               /* return error */
+            }
+            num = 0;                                                                    /* no pending command */
+        }
+        if (param != 0)                                                                 /* has params */
+        {
+            if (a_st7789_write_bytes(handle, (uint8_t *)&script[i + 2], param, ST7789_DATA) != 0)  /* write params */
+            {
+                handle->debug_print("st7789: write data failed.\n");                    /* write data failed */
+                a_st7789_invalidate(handle);                                            /* the caches are unknown */
+
+                return 1;                                                               /* return error */
+            }
+        }
+        a_st7789_script_track(handle, script[i], &script[i + 2], param);                /* update the driver state */
+        if (delay != 0)                                                                 /* delay */
+        {
+            handle->delay_ms(script[i + 2 + param]);                                    /* delay ms */
+        }
+        i += 2 + param + ((delay != 0) ? 1 : 0);                                        /* next entry */
+    }
+
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      strip the entries that write the reset defaults
+ * @param[in]  *script pointer to a script buffer
+ * @param[in]  len script length
+ * @param[out] *out pointer to an output buffer
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 script is invalid
+ *             - 2 script is NULL
+ * @note       the output is never longer than the script and out can be the script itself
+ */
+uint8_t st7789_strip_script_defaults(const uint8_t *script, uint32_t len, uint8_t *out, uint32_t *out_len)
+{
+    uint8_t cmd;
+    uint8_t param;
+    uint8_t touched[32];
+    const uint8_t *def;
+    uint32_t i;
+    uint32_t j;
+    uint32_t size;
+
+    if ((script == NULL) || (out == NULL) || (out_len == NULL))                         /* check script */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (a_st7789_script_check(script, len) != 0)                                        /* check script */
+    {
+        return 1;                                                                       /* return error */
+    }
+
+    memset(touched, 0, sizeof(touched));                                                /* every register holds the default */
+    i = 0;                                                                              /* first entry */
+    j = 0;                                                                              /* first output */
+    while (i < len)                                                                     /* strip all entries */
+    {
+        cmd = script[i];                                                                /* get command */
+        param = script[i + 1] & ~ST7789_SCRIPT_DELAY;                                   /* param length */
+        size = 2 + param + (((script[i + 1] & ST7789_SCRIPT_DELAY) != 0) ? 1 : 0);      /* entry size */
+        def = a_st7789_script_default(cmd);                                             /* find the default */
+        if (cmd == ST7789_CMD_SWRESET)                                                  /* software reset */
+        {
+            memset(touched, 0, sizeof(touched));                                        /* the defaults are back */
+        }
+        else if (((script[i + 1] & ST7789_SCRIPT_DELAY) == 0) && (def != NULL) &&
+                 ((touched[cmd / 8] & (1 << (cmd % 8))) == 0) && (def[1] == param) &&
+                 (memcmp(&def[2], &script[i + 2], param) == 0))                         /* the register keeps the default */
+        {
+            i += size;                                                                  /* drop the entry */
+
+            continue;                                                                   /* next entry */
+        }
+        else
+        {
+            touched[cmd / 8] |= (1 << (cmd % 8));                                       /* the register leaves the default */
+            if (((def != NULL) && (def[1] == 0)) ||
+                (((def = a_st7789_script_default(cmd ^ 0x01)) != NULL) && (def[1] == 0)))  /* an on and off pair */
+            {
+                touched[(cmd ^ 0x01) / 8] |= (1 << ((cmd ^ 0x01) % 8));                 /* the pair leaves the default */
+            }
+        }
+        memmove(&out[j], &script[i], size);                                             /* copy the entry */
+        j += size;                                                                      /* next output */
+        i += size;                                                                      /* next entry */
+    }
+    *out_len = j;                                                                       /* set output length */
+
+    return 0;                                                                           /* success return 0 */
+}
+
 /**
  * @brief      get chip's information
  * @param[out] *info pointer to an st7789 info structure
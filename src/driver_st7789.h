@@ -57,12 +57,79 @@ extern "C"{
  */
 
 /**
- * @brief st7789 buffer size definition
+ * @brief st7789 inner buffer size definition, 0 means no inner buffer
  */
 #ifndef ST7789_BUFFER_SIZE
     #define ST7789_BUFFER_SIZE    (4096)        /**< 4096 */
 #endif
 
+/**
+ * @brief st7789 max dirty area definition
+ */
+#ifndef ST7789_DIRTY_AREA_MAX
+    #define ST7789_DIRTY_AREA_MAX    (8)        /**< 8 */
+#endif
+
+/**
+ * @brief st7789 dirty area merge cost definition
+ * @note  two dirty areas are merged when their bounding box wastes no more than this pixels
+ */
+#ifndef ST7789_DIRTY_MERGE_COST
+    #define ST7789_DIRTY_MERGE_COST    (256)        /**< 256 */
+#endif
+
+/**
+ * @brief st7789 simd definition
+ * @note  set 0 to force the scalar color conversion
+ */
+#ifndef ST7789_USE_SIMD
+    #define ST7789_USE_SIMD    (1)        /**< 1 */
+#endif
+
+/**
+ * @brief st7789 max polygon points definition
+ * @note  the edge table of st7789_fill_polygon is on the stack and has this size
+ */
+#ifndef ST7789_POLYGON_POINTS_MAX
+    #define ST7789_POLYGON_POINTS_MAX    (16)        /**< 16 */
+#endif
+
+/**
+ * @brief st7789 max glyph bitmap bytes definition
+ * @note  every glyph cache entry has this size, 128 holds a 32x32 glyph
+ */
+#ifndef ST7789_GLYPH_BYTES_MAX
+    #define ST7789_GLYPH_BYTES_MAX    (128)        /**< 128 */
+#endif
+
+/**
+ * @brief st7789 glyph slot size definition
+ * @note  every slot of the wire format glyph cache has this size, 864 holds a 24 font glyph in rgb666,
+ *        a bigger glyph is drawn without the cache
+ */
+#ifndef ST7789_GLYPH_SLOT_SIZE
+    #define ST7789_GLYPH_SLOT_SIZE    (864)        /**< 864 */
+#endif
+
+/**
+ * @brief st7789 register shadow definition
+ */
+#define ST7789_SHADOW_NUM     (39)         /**< shadowed registers */
+#define ST7789_SHADOW_SIZE    (221)        /**< shadowed register bytes */
+
+/**
+ * @brief st7789 busy status definition
+ * @note  the drawing, console and script functions return it until a non-blocking reset or sleep change is over
+ */
+#define ST7789_STATUS_BUSY    (10)        /**< panel is busy */
+
+/**
+ * @brief st7789 script definition
+ * @note  a script entry is the command, the param length and the params, a length or'ed with
+ *        ST7789_SCRIPT_DELAY is followed by one more byte with the delay in ms after the entry
+ */
+#define ST7789_SCRIPT_DELAY    (0x80)        /**< delay flag */
+
 /**
  * @brief st7789 bool enumeration definition
  */
@@ -82,6 +149,26 @@ typedef enum
     ST7789_FONT_24 = 0x18,        /**< font 24 */
 } st7789_font_t;
 
+/**
+ * @brief st7789 image layout enumeration definition
+ */
+typedef enum
+{
+    ST7789_IMAGE_LAYOUT_COLUMN_MAJOR = 0x00,        /**< image[x * height + y] */
+    ST7789_IMAGE_LAYOUT_ROW_MAJOR    = 0x01,        /**< image[y * width + x] */
+} st7789_image_layout_t;
+
+/**
+ * @brief st7789 jpeg scale enumeration definition
+ */
+typedef enum
+{
+    ST7789_JPEG_SCALE_1_1 = 0x00,        /**< full size */
+    ST7789_JPEG_SCALE_1_2 = 0x01,        /**< 1/2 size */
+    ST7789_JPEG_SCALE_1_4 = 0x02,        /**< 1/4 size */
+    ST7789_JPEG_SCALE_1_8 = 0x03,        /**< 1/8 size */
+} st7789_jpeg_scale_t;
+
 /**
  * @brief st7789 gamma curve enumeration definition
  */
@@ -550,6 +637,41 @@ typedef enum
  * @{
  */
 
+/**
+ * @brief st7789 area structure definition
+ */
+typedef struct st7789_area_s
+{
+    uint16_t left;          /**< left coordinate x */
+    uint16_t top;           /**< top coordinate y */
+    uint16_t right;         /**< right coordinate x */
+    uint16_t bottom;        /**< bottom coordinate y */
+} st7789_area_t;
+
+/**
+ * @brief st7789 point structure definition
+ */
+typedef struct st7789_point_s
+{
+    uint16_t x;          /**< coordinate x */
+    uint16_t y;          /**< coordinate y */
+} st7789_point_t;
+
+/**
+ * @brief st7789 glyph slot structure definition
+ */
+typedef struct st7789_glyph_slot_s
+{
+    uint32_t color;                                /**< text color */
+    uint32_t background;                           /**< background color */
+    uint32_t stamp;                                /**< last use, 0 means empty */
+    uint16_t len;                                  /**< wire format length */
+    uint8_t chr;                                   /**< ascii char */
+    uint8_t font;                                  /**< font size */
+    uint8_t format;                                /**< pixel format */
+    uint8_t data[ST7789_GLYPH_SLOT_SIZE];          /**< row major glyph in the wire format */
+} st7789_glyph_slot_t;
+
 /**
  * @brief st7789 handle structure definition
  */
@@ -557,7 +679,9 @@ typedef struct st7789_handle_s
 {
     uint8_t (*spi_init)(void);                                   /**< point to a spi_init function address */
     uint8_t (*spi_deinit)(void);                                 /**< point to a spi_deinit function address */
-    uint8_t (*spi_write_cmd)(uint8_t *buf, uint16_t len);        /**< point to a spi_write_cmd function address */
+    uint8_t (*spi_write_cmd)(uint8_t *buf, uint32_t len);        /**< point to a spi_write_cmd function address */
+    uint8_t (*spi_write_cmd_async)(uint8_t *buf, uint32_t len);  /**< point to a spi_write_cmd_async function address */
+    uint8_t (*spi_write_cmd_busy)(void);                         /**< point to a spi_write_cmd_busy function address */
     uint8_t (*cmd_data_gpio_init)(void);                         /**< point to a cmd_data_gpio_init function address */
     uint8_t (*cmd_data_gpio_deinit)(void);                       /**< point to a cmd_data_gpio_deinit function address */
     uint8_t (*cmd_data_gpio_write)(uint8_t value);               /**< point to a cmd_data_gpio_write function address */
@@ -566,13 +690,148 @@ typedef struct st7789_handle_s
     uint8_t (*reset_gpio_write)(uint8_t value);                  /**< point to a reset_gpio_write function address */
     void (*debug_print)(const char *const fmt, ...);             /**< point to a debug_print function address */
     void (*delay_ms)(uint32_t ms);                               /**< point to a delay_ms function address */
+    uint32_t (*get_time_ms)(void);                               /**< point to a get_time_ms function address */
     uint8_t inited;                                              /**< inited flag */
     uint16_t column;                                             /**< column */
     uint16_t row;                                                /**< row */
     uint8_t format;                                              /**< format */
-    uint8_t buf[ST7789_BUFFER_SIZE + 8];                         /**< inner buffer */
+    const struct st7789_kernel_s *kernel;                        /**< pixel format kernel */
+    uint8_t image_layout;                                        /**< image layout */
+    volatile uint8_t async_busy;                                 /**< async write busy flag */
+    volatile uint8_t async_res;                                  /**< async write result */
+    uint8_t buf_half;                                            /**< inner buffer half in use */
+    uint8_t *framebuffer;                                        /**< framebuffer address */
+    uint32_t framebuffer_size;                                   /**< framebuffer size */
+    st7789_area_t dirty[ST7789_DIRTY_AREA_MAX];                  /**< dirty areas */
+    uint8_t dirty_num;                                           /**< dirty area number */
+    uint16_t scroll_top;                                         /**< vertical scrolling top fixed area */
+    uint16_t scroll_area;                                        /**< vertical scrolling area */
+    uint16_t scroll_start;                                       /**< vertical scrolling start address */
+    uint16_t window_left;                                        /**< address window left */
+    uint16_t window_top;                                         /**< address window top */
+    uint16_t window_right;                                       /**< address window right */
+    uint16_t window_bottom;                                      /**< address window bottom */
+    uint32_t window_pointer;                                     /**< memory write pointer in the address window */
+    uint8_t window_valid;                                        /**< address window valid flags */
+    uint8_t shadow[ST7789_SHADOW_SIZE];                          /**< write-only register shadow */
+    uint8_t shadow_valid[(ST7789_SHADOW_NUM + 7) / 8];           /**< register shadow valid flags */
+    uint8_t wait_state;                                          /**< panel wait state */
+    uint32_t wait_start;                                         /**< panel wait start time */
+    uint32_t wait_ms;                                            /**< panel wait time */
+    uint8_t *buf;                                                /**< transfer buffer */
+    uint32_t buf_size;                                           /**< transfer buffer size */
+    st7789_glyph_slot_t *glyph_slot;                             /**< glyph cache slots */
+    uint16_t glyph_slot_num;                                     /**< glyph cache slot number */
+    uint32_t glyph_stamp;                                        /**< glyph cache use counter */
+    uint32_t glyph_hits;                                         /**< glyph cache hits */
+    uint32_t glyph_misses;                                       /**< glyph cache misses */
+#if (ST7789_BUFFER_SIZE != 0)
+    uint8_t inner_buf[ST7789_BUFFER_SIZE];                       /**< inner buffer */
+#endif
 } st7789_handle_t;
 
+/**
+ * @brief st7789 console structure definition
+ */
+typedef struct st7789_console_s
+{
+    uint16_t top;                 /**< scrolling area top row */
+    uint16_t lines;               /**< text line number */
+    uint16_t columns;             /**< text column number */
+    uint16_t line;                /**< cursor line */
+    uint16_t x;                   /**< cursor column */
+    uint32_t color;               /**< text color */
+    uint32_t background;          /**< background color */
+    st7789_font_t font;           /**< text font */
+} st7789_console_t;
+
+/**
+ * @brief st7789 glyph structure definition
+ */
+typedef struct st7789_glyph_s
+{
+    uint32_t code;                                 /**< unicode code point */
+    uint32_t stamp;                                /**< last use, 0 means empty */
+    uint8_t width;                                 /**< bitmap width */
+    uint8_t height;                                /**< bitmap height */
+    int8_t x_offset;                               /**< bitmap left from the origin */
+    int8_t y_offset;                               /**< bitmap bottom from the baseline */
+    uint8_t advance;                               /**< distance to the next origin */
+    uint8_t bitmap[ST7789_GLYPH_BYTES_MAX];        /**< row major bitmap, (width + 7) / 8 bytes a row with msb first */
+} st7789_glyph_t;
+
+/**
+ * @brief st7789 bdf font structure definition
+ */
+typedef struct st7789_bdf_s
+{
+    const char *data;              /**< mapped bdf file */
+    uint32_t len;                  /**< bdf file length */
+    uint32_t chars;                /**< offset of the first glyph */
+    uint32_t default_char;         /**< glyph of the missing chars */
+    uint8_t ascent;                /**< points above the baseline */
+    uint8_t descent;               /**< points below the baseline */
+    uint8_t advance;               /**< advance of the missing chars */
+    st7789_glyph_t *cache;         /**< glyph cache */
+    uint16_t cache_num;            /**< glyph cache entries */
+    uint32_t stamp;                /**< use counter */
+    uint32_t hits;                 /**< cache hits */
+    uint32_t misses;               /**< cache misses */
+} st7789_bdf_t;
+
+/**
+ * @brief st7789 jpeg huffman table structure definition
+ */
+typedef struct st7789_jpeg_huffman_s
+{
+    uint16_t fast[256];           /**< 8 bits lookup, code length << 8 | value, 0 means a longer code */
+    int32_t maxcode[17];          /**< biggest code of each length, -1 means none */
+    int32_t delta[17];            /**< value index minus code of each length */
+    uint8_t value[256];           /**< values in the code order */
+    uint8_t valid;                /**< table is defined */
+} st7789_jpeg_huffman_t;
+
+/**
+ * @brief st7789 jpeg component structure definition
+ */
+typedef struct st7789_jpeg_component_s
+{
+    uint8_t id;          /**< component id */
+    uint8_t h;           /**< horizontal sampling factor */
+    uint8_t v;           /**< vertical sampling factor */
+    uint8_t tq;          /**< quantization table */
+    uint8_t td;          /**< dc huffman table */
+    uint8_t ta;          /**< ac huffman table */
+    int32_t dc;          /**< dc prediction */
+} st7789_jpeg_component_t;
+
+/**
+ * @brief st7789 jpeg structure definition
+ */
+typedef struct st7789_jpeg_s
+{
+    const uint8_t *data;                     /**< mapped jpeg file */
+    uint32_t len;                            /**< jpeg file length */
+    uint32_t scan;                           /**< offset of the entropy coded data */
+    uint32_t pos;                            /**< read offset */
+    uint32_t bits;                           /**< msb aligned bit buffer */
+    uint8_t bit_num;                         /**< bits in the bit buffer */
+    uint8_t pad;                             /**< zero bytes fed after the data end or a marker */
+    uint8_t marker;                          /**< marker found in the entropy coded data */
+    uint16_t width;                          /**< image width */
+    uint16_t height;                         /**< image height */
+    uint16_t restart;                        /**< restart interval in mcus, 0 means none */
+    uint8_t comp_num;                        /**< component number, 1 or 3 */
+    uint8_t h_max;                           /**< mcu width in blocks */
+    uint8_t v_max;                           /**< mcu height in blocks */
+    uint8_t quant_valid;                     /**< defined quantization table flags */
+    st7789_jpeg_component_t comp[3];         /**< components */
+    uint16_t quant[4][64];                   /**< natural order quantization tables */
+    st7789_jpeg_huffman_t huffman[4];        /**< dc 0, dc 1, ac 0 and ac 1 huffman tables */
+    int16_t coef[64];                        /**< natural order block coefficients */
+    uint8_t sample[6][64];                   /**< mcu samples, 4 luma blocks, cb and cr */
+} st7789_jpeg_t;
+
 /**
  * @brief st7789 information structure definition
  */
@@ -632,6 +891,23 @@ typedef struct st7789_info_s
  */
 #define DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(HANDLE, FUC)         (HANDLE)->spi_write_cmd = FUC
 
+/**
+ * @brief     link spi_write_cmd_async function
+ * @param[in] HANDLE pointer to an st7789 handle structure
+ * @param[in] FUC pointer to a spi_write_cmd_async function address
+ * @note      optional, the blocking spi_write_cmd is used when it is NULL,
+ *            the end of the write is reported with st7789_async_complete or polled with spi_write_cmd_busy
+ */
+#define DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_ASYNC(HANDLE, FUC)   (HANDLE)->spi_write_cmd_async = FUC
+
+/**
+ * @brief     link spi_write_cmd_busy function
+ * @param[in] HANDLE pointer to an st7789 handle structure
+ * @param[in] FUC pointer to a spi_write_cmd_busy function address
+ * @note      optional, it is polled when the transport does not call st7789_async_complete
+ */
+#define DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_BUSY(HANDLE, FUC)    (HANDLE)->spi_write_cmd_busy = FUC
+
 /**
  * @brief     link cmd_data_gpio_init function
  * @param[in] HANDLE pointer to an st7789 handle structure
@@ -688,6 +964,14 @@ typedef struct st7789_info_s
  */
 #define DRIVER_ST7789_LINK_DELAY_MS(HANDLE, FUC)                  (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link get_time_ms function
+ * @param[in] HANDLE pointer to an st7789 handle structure
+ * @param[in] FUC pointer to a get_time_ms function address
+ * @note      it is optional and only needed by the non-blocking functions
+ */
+#define DRIVER_ST7789_LINK_GET_TIME_MS(HANDLE, FUC)               (HANDLE)->get_time_ms = FUC
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to an st7789 handle structure
@@ -746,6 +1030,35 @@ uint8_t st7789_init(st7789_handle_t *handle);
  */
 uint8_t st7789_deinit(st7789_handle_t *handle);
 
+/**
+ * @brief     initialize the chip without blocking
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 spi initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ *            - 5 command && data init failed
+ * @note      it returns with the reset pin low, st7789_poll finishes the reset,
+ *            the drawing, console and script functions return ST7789_STATUS_BUSY and the other
+ *            commands block for the remaining time until the panel is ready
+ */
+uint8_t st7789_init_start(st7789_handle_t *handle);
+
+/**
+ * @brief      poll the panel
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[out] *ready pointer to a ready buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       it finishes the reset and sleep waits whose time is over and never blocks
+ */
+uint8_t st7789_poll(st7789_handle_t *handle, st7789_bool_t *ready);
+
 /**
  * @brief     set column
  * @param[in] *handle pointer to an st7789 handle structure
@@ -781,6 +1094,7 @@ uint8_t st7789_set_row(st7789_handle_t *handle, uint16_t row);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 format is invalid
+ *            - 10 panel is busy
  * @note      none
  */
 uint8_t st7789_clear(st7789_handle_t *handle);
@@ -798,6 +1112,7 @@ uint8_t st7789_clear(st7789_handle_t *handle);
  *            - 3 handle is not initialized
  *            - 4 x is over column
  *            - 5 y is over row
+ *            - 10 panel is busy
  * @note      x < column && y < row
  */
 uint8_t st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint32_t color);
@@ -817,10 +1132,154 @@ uint8_t st7789_draw_point(st7789_handle_t *handle, uint16_t x, uint16_t y, uint3
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 x or y is invalid
+ *            - 10 panel is busy
  * @note      x < column && y < row
  */
 uint8_t st7789_write_string(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len, uint32_t color, st7789_font_t font);
 
+/**
+ * @brief     write a string with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            every line of the string is sent with one window
+ */
+uint8_t st7789_write_string_with_background(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                            uint32_t color, uint32_t background, st7789_font_t font);
+
+/**
+ * @brief     write a scaled string with the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @param[in] scale glyph scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 scale is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && 1 <= scale <= 4
+ *            every point of the glyph becomes a scale x scale block with the nearest neighbour,
+ *            so a 24 font gives digits up to 96 rows high without extra font tables,
+ *            every line of the string is still sent with one window
+ */
+uint8_t st7789_write_string_scaled(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                                   uint32_t color, uint32_t background, st7789_font_t font, uint8_t scale);
+
+/**
+ * @brief     write an anti-aliased string in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && font is ST7789_FONT_12 or ST7789_FONT_16
+ *            the glyphs have 4 bits coverage blended against the background by a palette built once,
+ *            every line of the string is sent with one window
+ */
+uint8_t st7789_write_string_aa(st7789_handle_t *handle, uint16_t x, uint16_t y, char *str, uint16_t len,
+                               uint32_t color, uint32_t background, st7789_font_t font);
+
+/**
+ * @brief     init a bdf font
+ * @param[in] *font pointer to a bdf font structure
+ * @param[in] *data pointer to a mapped bdf file
+ * @param[in] len bdf file length
+ * @param[in] *cache pointer to a glyph cache buffer
+ * @param[in] num glyph cache entries
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is not a bdf font
+ *            - 2 font is NULL
+ *            - 4 data is NULL
+ *            - 5 cache is NULL
+ *            - 6 num is 0
+ * @note      the file and the cache must live as long as the font, the file is never copied and
+ *            the glyphs are decoded into the cache the first time they are used
+ */
+uint8_t st7789_bdf_init(st7789_bdf_t *font, const char *data, uint32_t len, st7789_glyph_t *cache, uint16_t num);
+
+/**
+ * @brief     write a utf-8 string with a bdf font in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a utf-8 string
+ * @param[in] len string length in bytes
+ * @param[in] color display color
+ * @param[in] *font pointer to a bdf font structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write utf8 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is NULL
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            y is the top of the line, '\n' starts a new line and the chars without a glyph use the default char,
+ *            every horizontal run of a glyph is sent with one window
+ */
+uint8_t st7789_write_utf8(st7789_handle_t *handle, uint16_t x, uint16_t y, const char *str, uint16_t len,
+                          uint32_t color, st7789_bdf_t *font);
+
+/**
+ * @brief     write a utf-8 string with a bdf font and the background in the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a utf-8 string
+ * @param[in] len string length in bytes
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] *font pointer to a bdf font structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write utf8 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is NULL
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            y is the top of the line, '\n' starts a new line and the chars without a glyph use the default char,
+ *            every glyph cell is sent with one window
+ */
+uint8_t st7789_write_utf8_with_background(st7789_handle_t *handle, uint16_t x, uint16_t y, const char *str, uint16_t len,
+                                          uint32_t color, uint32_t background, st7789_bdf_t *font);
+
 /**
  * @brief     fill the rect
  * @param[in] *handle pointer to an st7789 handle structure
@@ -840,10 +1299,294 @@ uint8_t st7789_write_string(st7789_handle_t *handle, uint16_t x, uint16_t y, cha
  *            - 7 top is over row
  *            - 8 bottom is over row
  *            - 9 top >= bottom
+ *            - 10 panel is busy
  * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
  */
 uint8_t st7789_fill_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t color);
 
+/**
+ * @brief     draw a horizontal line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] right right coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw hline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 y is over row
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && y < row
+ */
+uint8_t st7789_draw_hline(st7789_handle_t *handle, uint16_t left, uint16_t right, uint16_t y, uint32_t color);
+
+/**
+ * @brief     draw a vertical line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw vline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 top is over row
+ *            - 6 bottom is over row
+ *            - 7 top > bottom
+ *            - 10 panel is busy
+ * @note      x < column && top < row && bottom < row && top <= bottom
+ */
+uint8_t st7789_draw_vline(st7789_handle_t *handle, uint16_t x, uint16_t top, uint16_t bottom, uint32_t color);
+
+/**
+ * @brief     draw a line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 start coordinate x
+ * @param[in] y0 start coordinate y
+ * @param[in] x1 end coordinate x
+ * @param[in] y1 end coordinate y
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row
+ *            the line is split into horizontal or vertical runs and every run is sent with one window
+ */
+uint8_t st7789_draw_line(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t color);
+
+/**
+ * @brief     draw an anti-aliased line
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 start coordinate x
+ * @param[in] y0 start coordinate y
+ * @param[in] x1 end coordinate x
+ * @param[in] y1 end coordinate y
+ * @param[in] color line color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line aa failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row
+ *            every major step covers two points with the wu algorithm, the coverage is blended
+ *            against the background by a palette built once, the points of one minor position
+ *            are merged into a run two points thick and every run is sent with one window
+ */
+uint8_t st7789_draw_line_aa(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                            uint32_t color, uint32_t background);
+
+/**
+ * @brief     draw a polyline
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *points pointer to a points buffer
+ * @param[in] num number of points
+ * @param[in] color line color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw polyline failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 points is NULL
+ *            - 5 num < 2
+ *            - 6 point is invalid
+ *            - 10 panel is busy
+ * @note      every point x < column && y < row
+ *            the shared points of the segments are only drawn once
+ */
+uint8_t st7789_draw_polyline(st7789_handle_t *handle, const st7789_point_t *points, uint16_t num, uint32_t color);
+
+/**
+ * @brief     draw a circle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color circle color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            the circle is clipped to the screen and every octant run is sent with one window
+ */
+uint8_t st7789_draw_circle(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r, uint32_t color);
+
+/**
+ * @brief     fill a circle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color circle color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            the circle is clipped to the screen and every scanline is sent with one window
+ */
+uint8_t st7789_fill_circle(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r, uint32_t color);
+
+/**
+ * @brief     draw an arc
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] start_angle start angle in degrees
+ * @param[in] end_angle end angle in degrees
+ * @param[in] color arc color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw arc failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over column
+ *            - 5 y is over row
+ *            - 6 start angle is over 359
+ *            - 7 end angle is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row && start_angle < 360 && start_angle < end_angle <= start_angle + 360
+ *            0 degree is at the right of the center and the arc goes clockwise on the screen,
+ *            the octant runs are cut at the arc ends and every part is sent with one window
+ */
+uint8_t st7789_draw_arc(st7789_handle_t *handle, uint16_t x, uint16_t y, uint16_t r,
+                        uint16_t start_angle, uint16_t end_angle, uint32_t color);
+
+/**
+ * @brief     draw a rounded rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color rect color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && top < row && bottom < row && top <= bottom
+ *            r is limited to half of the shorter side, every edge and octant run is sent with one window
+ */
+uint8_t st7789_draw_round_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               uint16_t r, uint32_t color);
+
+/**
+ * @brief     fill a rounded rect
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color rect color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ * @note      left < column && right < column && left <= right && top < row && bottom < row && top <= bottom
+ *            r is limited to half of the shorter side, every corner scanline is sent with one window
+ */
+uint8_t st7789_fill_round_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               uint16_t r, uint32_t color);
+
+/**
+ * @brief     fill a triangle
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x0 first coordinate x
+ * @param[in] y0 first coordinate y
+ * @param[in] x1 second coordinate x
+ * @param[in] y1 second coordinate y
+ * @param[in] x2 third coordinate x
+ * @param[in] y2 third coordinate y
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill triangle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x0 is over column
+ *            - 5 y0 is over row
+ *            - 6 x1 is over column
+ *            - 7 y1 is over row
+ *            - 8 x2 is over column
+ *            - 9 y2 is over row
+ *            - 10 panel is busy
+ * @note      x0 < column && y0 < row && x1 < column && y1 < row && x2 < column && y2 < row
+ *            the rows are the same as st7789_fill_polygon with three points,
+ *            but the two edges of every row are known without an edge table
+ */
+uint8_t st7789_fill_triangle(st7789_handle_t *handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                             uint16_t x2, uint16_t y2, uint32_t color);
+
+/**
+ * @brief     fill a polygon
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *points pointer to a points buffer
+ * @param[in] num number of points
+ * @param[in] color fill color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill polygon failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 points is NULL
+ *            - 5 num < 3
+ *            - 6 point is invalid
+ *            - 7 num is over max
+ *            - 10 panel is busy
+ * @note      every point x < column && y < row && 3 <= num <= ST7789_POLYGON_POINTS_MAX
+ *            the last point is joined to the first one, concave and self-crossing polygons use
+ *            the even-odd rule and every inner span of a row is sent with one window
+ */
+uint8_t st7789_fill_polygon(st7789_handle_t *handle, const st7789_point_t *points, uint16_t num, uint32_t color);
+
 /**
  * @brief     draw a picture
  * @param[in] *handle pointer to an st7789 handle structure
@@ -863,6 +1606,7 @@ uint8_t st7789_fill_rect(st7789_handle_t *handle, uint16_t left, uint16_t top, u
  *            - 7 top is over row
  *            - 8 bottom is over row
  *            - 9 top >= bottom
+ *            - 10 panel is busy
  * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
  */
 uint8_t st7789_draw_picture_12bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image);
@@ -886,6 +1630,7 @@ uint8_t st7789_draw_picture_12bits(st7789_handle_t *handle, uint16_t left, uint1
  *            - 7 top is over row
  *            - 8 bottom is over row
  *            - 9 top >= bottom
+ *            - 10 panel is busy
  * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
  */
 uint8_t st7789_draw_picture_16bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t *image);
@@ -909,10 +1654,330 @@ uint8_t st7789_draw_picture_16bits(st7789_handle_t *handle, uint16_t left, uint1
  *            - 7 top is over row
  *            - 8 bottom is over row
  *            - 9 top >= bottom
+ *            - 10 panel is busy
  * @note      left <= column && right <= column && left < right && top <= row && bottom <= row && top < bottom
  */
 uint8_t st7789_draw_picture_18bits(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint32_t *image);
 
+/**
+ * @brief     set the image layout
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] layout image layout
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the layout is used by all draw picture functions and the default is column major
+ *            row major rgb565 pictures are streamed with only a byte swap
+ */
+uint8_t st7789_set_image_layout(st7789_handle_t *handle, st7789_image_layout_t layout);
+
+/**
+ * @brief      get the image layout
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[out] *layout pointer to an image layout buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t st7789_get_image_layout(st7789_handle_t *handle, st7789_image_layout_t *layout);
+
+/**
+ * @brief     draw the raw data
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a raw data buffer
+ * @param[in] len raw data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw raw failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ *            - 11 len is invalid
+ *            - 12 format is invalid
+ * @note      left <= column && right <= column && left <= right && top <= row && bottom <= row && top <= bottom
+ *            the data is already in the interface format, big endian rgb565, packed rgb444 or rgb666 in 3 bytes
+ *            and is sent to spi_write_cmd in one call without being copied
+ *            len == (right - left + 1) * (bottom - top + 1) * 2 in rgb565 format
+ *            len == ((right - left + 1) * (bottom - top + 1) * 3 + 1) / 2 in rgb444 format
+ *            len == (right - left + 1) * (bottom - top + 1) * 3 in rgb666 format
+ */
+uint8_t st7789_draw_raw(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                        uint8_t *data, uint32_t len);
+
+/**
+ * @brief     draw a compressed picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a compressed data buffer
+ * @param[in] len compressed data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw compressed failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over column
+ *            - 5 right is over column
+ *            - 6 left > right
+ *            - 7 top is over row
+ *            - 8 bottom is over row
+ *            - 9 top > bottom
+ *            - 10 panel is busy
+ *            - 11 data is invalid
+ *            - 12 format is invalid
+ * @note      left <= column && right <= column && left <= right && top <= row && bottom <= row && top <= bottom
+ *            data is the row major picture in the panel byte format of st7789_draw_raw split into blocks,
+ *            it starts with 'Z' and the point bits (12, 16 or 18) of the format, every block has a method byte
+ *            (0 stored, 1 rle, 2 lz4), the decoded and the encoded length in 2 little endian bytes each and the
+ *            encoded bytes, the rle unit is the transfer unit (3 bytes in rgb444 and rgb666, 2 bytes in rgb565),
+ *            lz4 is the lz4 block format with the matches inside the block
+ *            every block is decoded into the transfer buffer and sent, so a block must not be longer than the
+ *            buffer (its half with the async write) and all blocks but the last must hold whole transfer units,
+ *            a corrupt block stops the drawing and the blocks before it stay drawn
+ */
+uint8_t st7789_draw_compressed(st7789_handle_t *handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                               const uint8_t *data, uint32_t len);
+
+/**
+ * @brief     init a jpeg picture
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] *data pointer to a mapped jpeg file
+ * @param[in] len jpeg file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 data is not a jpeg picture
+ *            - 2 jpeg is NULL
+ *            - 4 data is NULL
+ *            - 5 jpeg is not supported
+ * @note      the file must live as long as the jpeg structure, it is never copied,
+ *            the headers are parsed once and jpeg->width and jpeg->height are set,
+ *            baseline huffman pictures with 8 bits samples, gray or ycbcr with 4:4:4, 4:2:2, 4:4:0 or 4:2:0
+ *            chroma subsampling and restart markers are supported, progressive pictures are not
+ */
+uint8_t st7789_jpeg_init(st7789_jpeg_t *jpeg, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief     draw a jpeg picture
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *jpeg pointer to a jpeg structure
+ * @param[in] scale picture scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw jpeg failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 jpeg is invalid
+ *            - 6 scale is invalid
+ *            - 7 buffer is too small
+ *            - 8 data is invalid
+ *            - 10 panel is busy
+ * @note      x < column && y < row
+ *            the picture is (jpeg->width + (1 << scale) - 1) >> scale points wide and
+ *            (jpeg->height + (1 << scale) - 1) >> scale points high and is clipped at the panel edge,
+ *            one mcu row (8 or 16 lines) is decoded at a time straight into the transfer buffer in the panel format
+ *            and sent with one window, a row wider than the buffer is sent in chunks of whole mcus,
+ *            so the buffer (its half with the async write) must hold one mcu of up to 16 x 16 points,
+ *            1/8 scale only uses the dc coefficients, 1/2 and 1/4 scale average the decoded points,
+ *            decoding stops after the last visible mcu row
+ */
+uint8_t st7789_draw_jpeg(st7789_handle_t *handle, uint16_t x, uint16_t y, st7789_jpeg_t *jpeg, st7789_jpeg_scale_t scale);
+
+/**
+ * @brief     set the transfer buffer
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *buf pointer to a transfer buffer, NULL means use the inner buffer
+ * @param[in] len transfer buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set buffer failed
+ *            - 2 handle is NULL
+ *            - 4 len is too small
+ *            - 5 no inner buffer
+ * @note      len >= 16
+ *            it can be called before st7789_init and it must be when ST7789_BUFFER_SIZE is 0
+ *            all the chunked transfers use the buffer size, so a bigger buffer needs fewer transfers
+ *            with the async write the buffer is used in two halves of len / 2 bytes
+ */
+uint8_t st7789_set_buffer(st7789_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     report the end of the async write
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] res write result, 0 means success
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the transport calls it from its completion interrupt or thread when the async write is done,
+ *            the driver then stops waiting at once and spi_write_cmd_busy is only polled as a fallback
+ */
+uint8_t st7789_async_complete(st7789_handle_t *handle, uint8_t res);
+
+/**
+ * @brief     set the framebuffer
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *framebuffer pointer to a framebuffer, NULL means detach the framebuffer
+ * @param[in] len framebuffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 format is invalid
+ *            - 5 len is too small
+ * @note      len >= column * row * 2 in rgb444 and rgb565 format, len >= column * row * 3 in rgb666 format
+ *            when the framebuffer is set, the draw functions only update the framebuffer and mark the dirty areas
+ *            and st7789_flush sends the dirty areas to the display
+ *            the framebuffer is detached when column, row or format changes and it can't hold the screen
+ */
+uint8_t st7789_set_framebuffer(st7789_handle_t *handle, uint8_t *framebuffer, uint32_t len);
+
+/**
+ * @brief     set the glyph cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *slot pointer to a glyph slot buffer, NULL means detach the glyph cache
+ * @param[in] num glyph slot number
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 num is 0
+ * @note      it can be called before st7789_init
+ *            the cache takes num * sizeof(st7789_glyph_slot_t) bytes and keeps the text with the background
+ *            already expanded to the wire format, so a cached char is one window and one write, the least recently
+ *            used slot is replaced on a miss and the cache is not used in framebuffer mode
+ */
+uint8_t st7789_set_glyph_cache(st7789_handle_t *handle, st7789_glyph_slot_t *slot, uint16_t num);
+
+/**
+ * @brief     flush the dirty areas of the framebuffer to the display
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 framebuffer is NULL
+ *            - 10 panel is busy
+ * @note      none
+ */
+uint8_t st7789_flush(st7789_handle_t *handle);
+
+/**
+ * @brief      convert a screen row to the frame memory row
+ * @param[in]  *handle pointer to an st7789 handle structure
+ * @param[in]  y screen row
+ * @param[out] *row pointer to a frame memory row buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 y is over row
+ * @note       y < row
+ *             the draw functions address the frame memory, so when the vertical scrolling is used
+ *             a point shown at the screen row y is drawn at the returned frame memory row
+ *             rows outside the scrolling area are returned unchanged
+ */
+uint8_t st7789_get_scroll_row(st7789_handle_t *handle, uint16_t y, uint16_t *row);
+
+/**
+ * @brief     initialize a scrolling text console
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *console pointer to an st7789 console structure
+ * @param[in] header fixed header rows
+ * @param[in] footer fixed footer rows
+ * @param[in] font text font
+ * @param[in] color text color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 console init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 header and footer are too large
+ *            - 10 panel is busy
+ * @note      header + footer + font <= row
+ *            the rows between the header and the footer become the hardware scrolling area, the rows
+ *            that don't fill a whole text line are added to the footer
+ *            the header and the footer are drawn with the draw functions and are never scrolled
+ *            the default memory data access control order is assumed
+ */
+uint8_t st7789_console_init(st7789_handle_t *handle, st7789_console_t *console, uint16_t header, uint16_t footer,
+                            st7789_font_t font, uint32_t color, uint32_t background);
+
+/**
+ * @brief     write a string in the console
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *console pointer to an st7789 console structure
+ * @param[in] *str pointer to a write string address
+ * @param[in] len length of the string
+ * @return    status code
+ *            - 0 success
+ *            - 1 console write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 10 panel is busy
+ * @note      '\n' starts a new line, '\r' returns to the line start and long lines are wrapped
+ *            when the last line is full the console scrolls in hardware and only the exposed line is cleared
+ *            in framebuffer mode st7789_flush must be called to show the text
+ */
+uint8_t st7789_console_write(st7789_handle_t *handle, st7789_console_t *console, char *str, uint16_t len);
+
+/**
+ * @brief     clear the console
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *console pointer to an st7789 console structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 console clear failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 10 panel is busy
+ * @note      none
+ */
+uint8_t st7789_console_clear(st7789_handle_t *handle, st7789_console_t *console);
+
+/**
+ * @brief     close the console
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *console pointer to an st7789 console structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 console deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 10 panel is busy
+ * @note      the whole screen becomes the scrolling area again and the start address is reset
+ */
+uint8_t st7789_console_deinit(st7789_handle_t *handle, st7789_console_t *console);
+
+/**
+ * @brief     invalidate the register shadow and the address window cache
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the setters skip the bus write when the register already holds the value, call it after
+ *            the panel is reset or written outside the driver so that the next setters write again
+ */
+uint8_t st7789_invalidate_cache(st7789_handle_t *handle);
+
 /**
  * @brief     nop
  * @param[in] *handle pointer to an st7789 handle structure
@@ -933,7 +1998,7 @@ uint8_t st7789_nop(st7789_handle_t *handle);
  *            - 1 software reset failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the pixel format goes back to the power on rgb666 and the scrolling area to the whole memory
  */
 uint8_t st7789_software_reset(st7789_handle_t *handle);
 
@@ -961,6 +2026,32 @@ uint8_t st7789_sleep_in(st7789_handle_t *handle);
  */
 uint8_t st7789_sleep_out(st7789_handle_t *handle);
 
+/**
+ * @brief     start the sleep in without blocking
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sleep in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 get_time_ms is NULL
+ * @note      st7789_poll reports the panel ready again
+ */
+uint8_t st7789_sleep_in_start(st7789_handle_t *handle);
+
+/**
+ * @brief     start the sleep out without blocking
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sleep out failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 get_time_ms is NULL
+ * @note      st7789_poll reports the panel ready again
+ */
+uint8_t st7789_sleep_out_start(st7789_handle_t *handle);
+
 /**
  * @brief     partial display mode on
  * @param[in] *handle pointer to an st7789 handle structure
@@ -1090,7 +2181,7 @@ uint8_t st7789_set_row_address(st7789_handle_t *handle, uint16_t start_address,
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_memory_write(st7789_handle_t *handle, uint8_t *data, uint16_t len);
+uint8_t st7789_memory_write(st7789_handle_t *handle, uint8_t *data, uint32_t len);
 
 /**
  * @brief     set partial areas
@@ -1225,7 +2316,7 @@ uint8_t st7789_set_interface_pixel_format(st7789_handle_t *handle, st7789_rgb_in
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t st7789_memory_continue_write(st7789_handle_t *handle, uint8_t *data, uint16_t len);
+uint8_t st7789_memory_continue_write(st7789_handle_t *handle, uint8_t *data, uint32_t len);
 
 /**
  * @brief     set tear scanline
@@ -2030,6 +3121,39 @@ uint8_t st7789_write_cmd(st7789_handle_t *handle, uint8_t cmd);
  */
 uint8_t st7789_write_data(st7789_handle_t *handle, uint8_t data);
 
+/**
+ * @brief     run an init script
+ * @param[in] *handle pointer to an st7789 handle structure
+ * @param[in] *script pointer to a script buffer
+ * @param[in] len script length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run script failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 script is invalid
+ *            - 10 panel is busy
+ * @note      each entry is sent with at most one command and one data transfer and the commands
+ *            without params are sent together, the driver state follows the written registers
+ */
+uint8_t st7789_run_script(st7789_handle_t *handle, const uint8_t *script, uint32_t len);
+
+/**
+ * @brief      strip the entries that write the reset defaults
+ * @param[in]  *script pointer to a script buffer
+ * @param[in]  len script length
+ * @param[out] *out pointer to an output buffer
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 script is invalid
+ *             - 2 script is NULL
+ * @note       the stripped script is only valid right after a hardware or software reset of a panel
+ *             whose nvm keeps the datasheet defaults, entries with a delay are kept and out can be
+ *             the script itself
+ */
+uint8_t st7789_strip_script_defaults(const uint8_t *script, uint32_t len, uint8_t *out, uint32_t *out_len);
+
 /**
  * @}
  */
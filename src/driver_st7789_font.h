@@ -351,6 +351,214 @@ static const uint8_t gsc_st7789_ascii_2412[95][36] =
     {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00}, /*"~", 94*/
 };
 
+/**
+ * @brief ascii aa 1206 definition
+ * @note  4 bits coverage, row major and the left point is the high nibble,
+ *        every point is the area average of the ascii 2412
+ */
+static const uint8_t gsc_st7789_ascii_aa_1206[95][36] =
+{
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ", 0*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00}, /*"!", 1*/
+    {0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x04, 0xB4, 0xB0, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*""", 2*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x08, 0x00, 0x80, 0x4B, 0x88, 0xB4, 0x4B, 0x88, 0xB4, 0x08, 0x00, 0x80, 0x4B, 0x88, 0xB4, 0x4B, 0x88, 0xB4, 0x08, 0x00, 0x80, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00}, /*"#", 3*/
+    {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x8B, 0x40, 0x0B, 0x48, 0xF0, 0x0F, 0x08, 0x80, 0x04, 0xB8, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0B, 0xB0, 0x0F, 0x08, 0xF0, 0x0B, 0x08, 0xB0, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x00}, /*"$", 4*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x80, 0x84, 0x40, 0x80, 0x80, 0x88, 0x00, 0x80, 0x8B, 0x00, 0x8B, 0xBB, 0xB0, 0x00, 0x88, 0x08, 0x04, 0x88, 0x08, 0x08, 0x08, 0x44, 0x04, 0x04, 0x80, 0x00, 0x00, 0x00}, /*"%", 5*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x0B, 0x84, 0xB0, 0x4B, 0x40, 0x80, 0xB0, 0xB8, 0x00, 0xF0, 0x8B, 0x00, 0xB4, 0x4B, 0x04, 0x08, 0x40, 0x80, 0x00, 0x00, 0x00}, /*"&", 6*/
+    {0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x80, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"'", 7*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x04, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x04}, /*"(", 8*/
+    {0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0xF0, 0x00, 0x04, 0x80, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00}, /*")", 9*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x48, 0x08, 0x48, 0x08, 0xBB, 0xB4, 0x08, 0xBB, 0xB4, 0x48, 0x08, 0x48, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"*", 10*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x48, 0x8B, 0x88, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"+", 11*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x80, 0x00, 0x48, 0x00, 0x00}, /*", ", 12*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"-", 13*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00}, /*".", 14*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x84, 0x00, 0x00, 0x80, 0x00, 0x04, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x48, 0x00, 0x00, 0x40, 0x00, 0x00}, /*"/", 15*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0B, 0x44, 0xB0, 0x4B, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x4B, 0x00, 0xB4, 0x0B, 0x44, 0xB0, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"0", 16*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"1", 17*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x44, 0x04, 0xB0, 0x88, 0x00, 0xF0, 0x00, 0x04, 0xB0, 0x00, 0x0B, 0x40, 0x00, 0x80, 0x00, 0x08, 0x00, 0x80, 0x88, 0x88, 0xB0, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"2", 18*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x48, 0x0B, 0x40, 0x88, 0x08, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x40, 0x00, 0x00, 0xB0, 0x88, 0x00, 0xF0, 0x48, 0x04, 0xB0, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"3", 19*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x88, 0x80, 0x04, 0x48, 0x80, 0x08, 0x08, 0x80, 0x88, 0x8B, 0xB4, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00}, /*"4", 20*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x80, 0x0B, 0x88, 0x80, 0x08, 0x00, 0x00, 0x08, 0x88, 0x00, 0x0B, 0x04, 0xB0, 0x00, 0x00, 0xF0, 0x88, 0x00, 0xF0, 0x44, 0x08, 0x80, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"5", 21*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x0B, 0x40, 0xF0, 0x0B, 0x00, 0x00, 0x88, 0x48, 0x40, 0x8B, 0x40, 0xB4, 0x88, 0x00, 0x88, 0x48, 0x00, 0x88, 0x0B, 0x40, 0xB0, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"6", 22*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x84, 0x0F, 0x88, 0xB4, 0x08, 0x00, 0x80, 0x00, 0x04, 0x40, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00}, /*"7", 23*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x40, 0x4B, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x4F, 0x80, 0xB0, 0x08, 0x8F, 0x40, 0x48, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x4B, 0x00, 0xB4, 0x00, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"8", 24*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x00, 0xB0, 0x88, 0x00, 0x84, 0x88, 0x00, 0x88, 0x4B, 0x04, 0xB8, 0x04, 0x84, 0x88, 0x00, 0x00, 0xF0, 0x0F, 0x04, 0x80, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00}, /*"9", 25*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00}, /*":", 26*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x48, 0x00, 0x00, 0x40, 0x00}, /*";", 27*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x04, 0x40, 0x00, 0x44, 0x00, 0x04, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00}, /*"<", 28*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"=", 29*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x44, 0x00, 0x04, 0x40, 0x00, 0x44, 0x00, 0x04, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00}, /*">", 30*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xB0, 0x80, 0x00, 0x88, 0x88, 0x00, 0x88, 0x00, 0x04, 0xB0, 0x00, 0x84, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00}, /*"?", 31*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x08, 0x80, 0x48, 0x0B, 0x4B, 0xB8, 0x88, 0x80, 0x88, 0x88, 0x80, 0x88, 0x88, 0x88, 0x88, 0x4B, 0x44, 0x84, 0x0B, 0x40, 0x44, 0x00, 0x48, 0x40, 0x00, 0x00, 0x00}, /*"@", 32*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x8F, 0x00, 0x08, 0x0B, 0x40, 0x08, 0x08, 0x80, 0x08, 0x88, 0xB0, 0x08, 0x00, 0xF0, 0x48, 0x00, 0x88, 0x88, 0x00, 0x88, 0x00, 0x00, 0x00}, /*"A", 33*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x88, 0x04, 0xB0, 0x88, 0x00, 0xF0, 0x88, 0x04, 0xB0, 0x8B, 0x88, 0x80, 0x88, 0x00, 0x84, 0x88, 0x00, 0x88, 0x88, 0x00, 0xB4, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"B", 34*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x0B, 0x40, 0x48, 0x0B, 0x00, 0x04, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x4B, 0x00, 0x08, 0x0B, 0x40, 0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"C", 35*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x88, 0x04, 0xB0, 0x88, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0xB4, 0x88, 0x08, 0xB0, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00}, /*"D", 36*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x80, 0x88, 0x00, 0x44, 0x88, 0x00, 0x00, 0x88, 0x08, 0x00, 0x8B, 0x8B, 0x00, 0x88, 0x04, 0x00, 0x88, 0x00, 0x04, 0x88, 0x00, 0x44, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"E", 37*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x80, 0x88, 0x00, 0x84, 0x88, 0x00, 0x04, 0x88, 0x08, 0x00, 0x8B, 0x8B, 0x00, 0x88, 0x04, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"F", 38*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0B, 0x40, 0xB0, 0x0B, 0x00, 0x40, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x08, 0xF8, 0x4B, 0x00, 0xF0, 0x0B, 0x40, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"G", 39*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x8B, 0x88, 0xB8, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x00, 0x00, 0x00}, /*"H", 40*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"I", 41*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x44, 0x08, 0x80, 0x4B, 0x8B, 0x00}, /*"J", 42*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x08, 0x84, 0x88, 0x04, 0x40, 0x88, 0x08, 0x00, 0x88, 0xB0, 0x00, 0x8F, 0xB4, 0x00, 0x88, 0x4F, 0x00, 0x88, 0x0B, 0x80, 0x88, 0x00, 0xF4, 0x88, 0x04, 0x88, 0x00, 0x00, 0x00}, /*"K", 43*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x04, 0x88, 0x00, 0x44, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"L", 44*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x8F, 0x00, 0xF8, 0x8B, 0x44, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xF8, 0x88, 0x80, 0xF8, 0x88, 0x80, 0x80, 0x88, 0x84, 0x40, 0x88, 0x00, 0x00, 0x00}, /*"M", 45*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x48, 0x8F, 0x00, 0x08, 0x88, 0x80, 0x08, 0x80, 0xB4, 0x08, 0x80, 0x4B, 0x08, 0x80, 0x0B, 0x48, 0x80, 0x00, 0xF8, 0x80, 0x00, 0x88, 0x84, 0x00, 0x04, 0x00, 0x00, 0x00}, /*"N", 46*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0B, 0x44, 0xB0, 0x4B, 0x00, 0x84, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x4B, 0x00, 0x84, 0x0B, 0x44, 0xB0, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"O", 47*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x40, 0x88, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x8B, 0x88, 0xB0, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"P", 48*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0B, 0x44, 0xB0, 0x4B, 0x00, 0x84, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x4B, 0x88, 0x84, 0x0B, 0x08, 0xB0, 0x00, 0x8B, 0xB4, 0x00, 0x00, 0x80}, /*"Q", 49*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x40, 0x88, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x88, 0x00, 0xB4, 0x8B, 0xBB, 0x00, 0x88, 0x0F, 0x00, 0x88, 0x08, 0x80, 0x88, 0x00, 0xF0, 0x88, 0x00, 0x48, 0x00, 0x00, 0x00}, /*"R", 50*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x04, 0x4B, 0x00, 0x88, 0x88, 0x00, 0x04, 0x4F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xB4, 0x80, 0x00, 0x88, 0x8B, 0x00, 0xB4, 0x40, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"S", 51*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x84, 0x80, 0x88, 0x08, 0x40, 0x88, 0x04, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"T", 52*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x48, 0x88, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x08, 0x4B, 0x00, 0x44, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"U", 53*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x4F, 0x00, 0x84, 0x0F, 0x00, 0x80, 0x0B, 0x40, 0x80, 0x08, 0x80, 0x80, 0x04, 0xB4, 0x40, 0x00, 0xF8, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00}, /*"V", 54*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x48, 0x88, 0x88, 0x08, 0x88, 0x88, 0x80, 0x4B, 0x8F, 0x80, 0x0F, 0x8F, 0x80, 0x0F, 0x8F, 0x80, 0x0F, 0x8B, 0x80, 0x08, 0x08, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00}, /*"W", 55*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x44, 0x84, 0x0B, 0x40, 0xB0, 0x08, 0x84, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x8F, 0x00, 0x04, 0x8B, 0x80, 0x0B, 0x04, 0xB0, 0x48, 0x44, 0x84, 0x00, 0x00, 0x00}, /*"X", 56*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x40, 0x88, 0x4F, 0x00, 0x84, 0x0B, 0x40, 0x80, 0x04, 0xB4, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"Y", 57*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x84, 0x44, 0x04, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x88, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x80, 0x04, 0x0F, 0x40, 0x44, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"Z", 58*/
+    {0x00, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x48, 0x84}, /*"[", 59*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x44, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x44}, /*"\", 60*/
+    {0x00, 0x00, 0x00, 0x08, 0x8B, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x08, 0x88, 0x00}, /*"]", 61*/
+    {0x00, 0x00, 0x00, 0x00, 0xBB, 0x40, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"^", 62*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88}, /*"_", 63*/
+    {0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"`", 64*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xB0, 0x08, 0x48, 0xF0, 0x0B, 0x80, 0xF0, 0x88, 0x00, 0xF0, 0x8B, 0x04, 0xF4, 0x08, 0x84, 0x88, 0x00, 0x00, 0x00}, /*"a", 65*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x88, 0xB0, 0x0F, 0x40, 0x88, 0x0F, 0x00, 0x88, 0x0F, 0x00, 0x88, 0x0F, 0x40, 0xB0, 0x04, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"b", 66*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8B, 0x40, 0x4B, 0x08, 0x80, 0x88, 0x00, 0x00, 0x88, 0x00, 0x40, 0x0F, 0x00, 0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"c", 67*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x0B, 0x88, 0xF0, 0x4B, 0x00, 0xF0, 0x88, 0x00, 0xF0, 0x88, 0x00, 0xF0, 0x0B, 0x04, 0xF4, 0x04, 0x84, 0x40, 0x00, 0x00, 0x00}, /*"d", 68*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0xB0, 0x0B, 0x00, 0x88, 0x0F, 0x88, 0x84, 0x0F, 0x00, 0x00, 0x08, 0xB0, 0x44, 0x00, 0x48, 0x40, 0x00, 0x00, 0x00}, /*"e", 69*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0xB4, 0x88, 0x00, 0xF0, 0x00, 0x48, 0xF8, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"f", 70*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBB, 0x8B, 0x0F, 0x00, 0xF0, 0x0B, 0x44, 0xB0, 0x0B, 0x88, 0x00, 0x0B, 0xFB, 0x80, 0x88, 0x00, 0x88, 0x4B, 0x88, 0xB4}, /*"g", 71*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x88, 0xB0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x48, 0x44, 0x84, 0x00, 0x00, 0x00}, /*"h", 72*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"i", 73*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x0F, 0x8B, 0x00}, /*"j", 74*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x0F, 0x0B, 0x00, 0x0F, 0xB8, 0x00, 0x0F, 0x4F, 0x00, 0x0F, 0x08, 0x80, 0x48, 0x44, 0x84, 0x00, 0x00, 0x00}, /*"k", 75*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"l", 76*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x48, 0x48, 0x00, 0x00, 0x00}, /*"m", 77*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x88, 0xB0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x48, 0x44, 0x84, 0x00, 0x00, 0x00}, /*"n", 78*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBB, 0x40, 0x4B, 0x00, 0xB4, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x0F, 0x00, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"o", 79*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x88, 0xB0, 0x0F, 0x00, 0x88, 0x0F, 0x00, 0x88, 0x0F, 0x00, 0x88, 0x0F, 0x40, 0xF0, 0x0F, 0x48, 0x40, 0x4F, 0x80, 0x00}, /*"p", 80*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x88, 0xB0, 0x4B, 0x00, 0xF0, 0x88, 0x00, 0xF0, 0x88, 0x00, 0xF0, 0x0B, 0x04, 0xF0, 0x04, 0x84, 0xF0, 0x00, 0x08, 0xF4}, /*"q", 81*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x88, 0xB8, 0x08, 0xB0, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00}, /*"r", 82*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB8, 0xB8, 0x0F, 0x00, 0x04, 0x04, 0xF8, 0x40, 0x04, 0x04, 0xB4, 0x0B, 0x00, 0xB4, 0x08, 0x88, 0x40, 0x00, 0x00, 0x00}, /*"s", 83*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x48, 0xF8, 0x40, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x48, 0x40, 0x00, 0x00, 0x00}, /*"t", 84*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x4F, 0x04, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x44, 0xF4, 0x04, 0x84, 0x40, 0x00, 0x00, 0x00}, /*"u", 85*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0xBB, 0x08, 0x80, 0x80, 0x00, 0xF0, 0x80, 0x00, 0xB8, 0x40, 0x00, 0x8F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00}, /*"v", 86*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x4F, 0x4B, 0x88, 0x4F, 0x08, 0x0F, 0x8B, 0x84, 0x0F, 0x88, 0xF0, 0x0B, 0x44, 0xB0, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00}, /*"w", 87*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0xB4, 0x04, 0xB8, 0x40, 0x00, 0xB8, 0x00, 0x00, 0x8F, 0x00, 0x08, 0x48, 0xB0, 0x48, 0x48, 0x84, 0x00, 0x00, 0x00}, /*"x", 88*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB4, 0xB4, 0x08, 0x80, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x48, 0x00, 0x00, 0x80, 0x00, 0x0B, 0x80, 0x00}, /*"y", 89*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0xB0, 0x04, 0x0F, 0x40, 0x00, 0x8B, 0x00, 0x00, 0xF4, 0x04, 0x08, 0xB0, 0x48, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00}, /*"z", 90*/
+    {0x00, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x48, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x80}, /*"{", 91*/
+    {0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00}, /*"|", 92*/
+    {0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x84, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x04, 0x80, 0x00, 0x08, 0x00, 0x00}, /*"}", 93*/
+    {0x08, 0x40, 0x00, 0x44, 0x44, 0x04, 0x40, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~", 94*/
+};
+
+/**
+ * @brief ascii aa 1608 definition
+ * @note  4 bits coverage, row major and the left point is the high nibble,
+ *        every point is the area average of the ascii 2412
+ */
+static const uint8_t gsc_st7789_ascii_aa_1608[95][64] =
+{
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ", 0*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x52, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"!", 1*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0xA3, 0x00, 0x2C, 0x73, 0xD3, 0x00, 0xC8, 0x3D, 0x30, 0x03, 0x70, 0x73, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*""", 2*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x5F, 0xFF, 0xFF, 0xF5, 0x25, 0xC5, 0x55, 0xC2, 0x03, 0x70, 0x03, 0x70, 0x0A, 0x00, 0x0A, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x2C, 0x55, 0x5C, 0x52, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"#", 3*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x3A, 0xDA, 0x00, 0x03, 0xD3, 0xAA, 0xA0, 0x0A, 0xA0, 0xAA, 0xA0, 0x07, 0xC2, 0xA0, 0x00, 0x00, 0x8C, 0xA0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x30, 0xAA, 0xA0, 0x0A, 0xA0, 0xAA, 0xA0, 0x07, 0xA0, 0xAA, 0x70, 0x00, 0x7A, 0xD7, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x30, 0x00}, /*"$", 4*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x70, 0x07, 0x70, 0x73, 0x82, 0x0A, 0x00, 0xA0, 0x55, 0x37, 0x00, 0xA0, 0x55, 0x85, 0x00, 0xA0, 0x55, 0xC2, 0x00, 0x58, 0xDD, 0xCC, 0xA0, 0x25, 0x3A, 0x82, 0x73, 0x00, 0x55, 0xA0, 0x55, 0x00, 0xC5, 0xA0, 0x55, 0x00, 0xA0, 0x82, 0x73, 0x07, 0x30, 0x5C, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"%", 5*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x0A, 0x0A, 0xA0, 0x00, 0x0A, 0x0A, 0xA0, 0x00, 0x0A, 0x0A, 0x85, 0x30, 0x0A, 0xA7, 0x2C, 0x30, 0x28, 0xC2, 0x0A, 0x00, 0x55, 0x85, 0x37, 0x00, 0xF5, 0x3D, 0x85, 0x00, 0xF5, 0x0A, 0xC2, 0x00, 0xC8, 0x03, 0xC5, 0x22, 0x2C, 0xA7, 0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"&", 6*/
+    {0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0xC5, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x25, 0x70, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"'", 7*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x07, 0xC2, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x22}, /*"(", 8*/
+    {0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00}, /*")", 9*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x3D, 0xC2, 0xA3, 0xFC, 0x03, 0x8C, 0xDD, 0x52, 0x03, 0x8C, 0xDD, 0x52, 0x3D, 0xC2, 0xA3, 0xFC, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"*", 10*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x3A, 0xAA, 0xDA, 0xAA, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"+", 11*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC2, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x3A, 0x30, 0x00, 0x00}, /*", ", 12*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"-", 13*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*".", 14*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x0A, 0x30, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00}, /*"/", 15*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x03, 0xD3, 0x3D, 0x30, 0x0A, 0xA0, 0x0A, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x2C, 0x70, 0x07, 0xC2, 0x07, 0xC2, 0x2C, 0x70, 0x00, 0x8C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"0", 16*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x5C, 0xA0, 0x00, 0x03, 0x5C, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x07, 0xAD, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"1", 17*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA3, 0x00, 0x28, 0x00, 0x3D, 0x30, 0x5C, 0x00, 0x0A, 0xA0, 0x3A, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x3D, 0x30, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x07, 0x52, 0x00, 0x00, 0x73, 0x00, 0x30, 0x07, 0x30, 0x00, 0xA0, 0x58, 0x55, 0x55, 0xA0, 0x5F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"2", 18*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x2C, 0x00, 0xC8, 0x00, 0x5F, 0x00, 0x5F, 0x00, 0x3A, 0x00, 0x5F, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x3A, 0x85, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x25, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x3D, 0x00, 0x2C, 0x70, 0x03, 0xAA, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"3", 19*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x82, 0x5F, 0x00, 0x0A, 0x00, 0x5F, 0x00, 0x37, 0x00, 0x5F, 0x00, 0x3A, 0xAA, 0xCF, 0xA3, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x07, 0xCF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"4", 20*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0x70, 0x0A, 0xAA, 0xAA, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x3A, 0xA3, 0x00, 0x0A, 0x70, 0x3D, 0x30, 0x03, 0x00, 0x0A, 0xA0, 0x25, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x37, 0x00, 0x5F, 0x00, 0x03, 0xAA, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"5", 21*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0x00, 0x03, 0xD3, 0x0A, 0xA0, 0x0A, 0xA0, 0x03, 0x30, 0x2C, 0x00, 0x00, 0x00, 0x5F, 0x07, 0xAA, 0x00, 0x5F, 0x73, 0x07, 0xC2, 0x5F, 0x30, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x2C, 0x00, 0x00, 0xF5, 0x07, 0xC2, 0x03, 0xA0, 0x00, 0x8C, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"6", 22*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA3, 0x0A, 0xDA, 0xAA, 0xD3, 0x0A, 0x30, 0x07, 0x30, 0x07, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"7", 23*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x2C, 0x70, 0x07, 0xC2, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x30, 0x00, 0xD3, 0x2C, 0xDA, 0x07, 0xA0, 0x03, 0x7A, 0xF8, 0x00, 0x0A, 0x30, 0x5C, 0x70, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x3D, 0x30, 0x03, 0xD3, 0x03, 0x7A, 0xAD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"8", 24*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x0A, 0xA0, 0x0A, 0x30, 0x3D, 0x30, 0x03, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x3D, 0x30, 0x28, 0xF5, 0x03, 0xDA, 0x82, 0xF5, 0x00, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0xA0, 0x2C, 0x00, 0x03, 0xDA, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"9", 25*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*":", 26*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x03, 0x00, 0x00}, /*";", 27*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"<", 28*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0x52, 0x25, 0x55, 0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"=", 29*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x73, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x73, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*">", 30*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x00, 0x07, 0x85, 0x5C, 0x70, 0x55, 0x00, 0x00, 0xF5, 0x5C, 0x00, 0x00, 0xF5, 0x3A, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x3D, 0x30, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"?", 31*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0x00, 0x00, 0xDA, 0x00, 0xC5, 0x07, 0xA0, 0xA3, 0x88, 0x2C, 0x0A, 0x7A, 0x7A, 0x5F, 0x0A, 0x0A, 0x0A, 0x5F, 0x55, 0x0A, 0x0A, 0x5F, 0x55, 0x3D, 0x0A, 0x5F, 0x37, 0x7D, 0x73, 0x2C, 0x73, 0x33, 0x37, 0x07, 0xC2, 0x00, 0x73, 0x00, 0x58, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"@", 32*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x2C, 0xA0, 0x00, 0x00, 0x58, 0xD3, 0x00, 0x00, 0x73, 0xF5, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00, 0xA0, 0x5F, 0x00, 0x00, 0xDA, 0xCF, 0x00, 0x0A, 0x00, 0x0A, 0xA0, 0x0A, 0x00, 0x0A, 0xA0, 0x2C, 0x00, 0x00, 0xF5, 0xCF, 0x70, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"A", 33*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA3, 0x00, 0x5F, 0x00, 0x3D, 0x30, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x3D, 0x30, 0x5F, 0xAA, 0xA7, 0x30, 0x5F, 0x00, 0x03, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x03, 0xD3, 0xCF, 0xAA, 0xAD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"B", 34*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xA3, 0x03, 0xD3, 0x00, 0xC5, 0x0A, 0xA0, 0x00, 0x55, 0x2C, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x22, 0x2C, 0x70, 0x00, 0x55, 0x07, 0xC2, 0x03, 0x70, 0x00, 0x8C, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"C", 35*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x70, 0x00, 0x5F, 0x00, 0x3D, 0x30, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x07, 0xC2, 0x5F, 0x00, 0x5C, 0x70, 0xCF, 0xAA, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"D", 36*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x70, 0x5F, 0x00, 0x00, 0x82, 0x5F, 0x00, 0x00, 0x22, 0x5F, 0x00, 0x22, 0x00, 0x5F, 0x00, 0x55, 0x00, 0x5F, 0xAA, 0xC5, 0x00, 0x5F, 0x00, 0x55, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x33, 0x5F, 0x00, 0x00, 0x73, 0xCF, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"E", 37*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x70, 0x5F, 0x00, 0x07, 0x82, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x22, 0x00, 0x5F, 0x00, 0x55, 0x00, 0x5F, 0xAA, 0xC5, 0x00, 0x5F, 0x00, 0x55, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"F", 38*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x70, 0x03, 0xD3, 0x07, 0xA0, 0x0A, 0xA0, 0x00, 0xA0, 0x2C, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0xAA, 0xAA, 0x5F, 0x00, 0x0A, 0xA0, 0x2C, 0x70, 0x0A, 0xA0, 0x07, 0xC2, 0x0A, 0xA0, 0x00, 0x8C, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"G", 39*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x07, 0xAA, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0xAA, 0xAA, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0xCF, 0x70, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"H", 40*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0x70, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x07, 0xAD, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"I", 41*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x5F, 0x00, 0x8C, 0x00, 0x2C, 0xAA, 0xC2, 0x00}, /*"J", 42*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0xAA, 0xA3, 0x5F, 0x00, 0x28, 0x00, 0x5F, 0x00, 0x82, 0x00, 0x5F, 0x03, 0x70, 0x00, 0x5F, 0x3D, 0x00, 0x00, 0x5F, 0xDD, 0x30, 0x00, 0x5F, 0x3A, 0xD3, 0x00, 0x5F, 0x00, 0xF8, 0x00, 0x5F, 0x00, 0x8F, 0x00, 0x5F, 0x00, 0x0A, 0xC2, 0xCF, 0x70, 0x3D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"K", 43*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x33, 0x5F, 0x00, 0x00, 0x73, 0xCF, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"L", 44*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x07, 0xAA, 0x5F, 0xA0, 0x0A, 0xF5, 0x5F, 0xA0, 0x0A, 0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x55, 0xF5, 0x73, 0xF5, 0x55, 0x8C, 0xA0, 0xF5, 0x55, 0x5F, 0xA0, 0xF5, 0x55, 0x5F, 0xA0, 0xF5, 0x55, 0x0A, 0x00, 0xF5, 0xCC, 0x0A, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"M", 45*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAA, 0x5F, 0xA0, 0x00, 0x55, 0x58, 0xD3, 0x00, 0x55, 0x55, 0xC8, 0x00, 0x55, 0x55, 0x2C, 0x70, 0x55, 0x55, 0x07, 0xC2, 0x55, 0x55, 0x00, 0xF5, 0x55, 0x55, 0x00, 0x3D, 0x85, 0x55, 0x00, 0x0A, 0xF5, 0x55, 0x00, 0x00, 0xF5, 0xCC, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"N", 46*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x03, 0xD3, 0x3D, 0x30, 0x0A, 0xA0, 0x03, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x2C, 0x70, 0x00, 0xC2, 0x07, 0xC2, 0x2C, 0x70, 0x00, 0x8C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"O", 47*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x5F, 0x00, 0x07, 0xC2, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x55, 0x5C, 0x70, 0x5F, 0x55, 0x55, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"P", 48*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x00, 0x03, 0xD3, 0x3D, 0x30, 0x0A, 0xA0, 0x03, 0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x25, 0x30, 0xF5, 0x2C, 0x85, 0xA0, 0xC2, 0x07, 0xA0, 0x5F, 0x70, 0x00, 0x7A, 0xCF, 0x00, 0x00, 0x00, 0x3D, 0xD3, 0x00, 0x00, 0x03, 0x30}, /*"Q", 49*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x5F, 0x00, 0x07, 0xC2, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x07, 0xC2, 0x5F, 0xAD, 0xD3, 0x00, 0x5F, 0x03, 0xD3, 0x00, 0x5F, 0x00, 0xC8, 0x00, 0x5F, 0x00, 0x5F, 0x00, 0x5F, 0x00, 0x0A, 0xA0, 0xCF, 0x70, 0x03, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"R", 50*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA3, 0x33, 0x2C, 0x70, 0x07, 0xC5, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x30, 0x00, 0x00, 0x2C, 0xDA, 0x00, 0x00, 0x00, 0x3A, 0xF8, 0x30, 0x00, 0x00, 0x5C, 0xA0, 0x22, 0x00, 0x00, 0xF5, 0x55, 0x00, 0x00, 0xF5, 0x5F, 0x30, 0x03, 0xD3, 0x58, 0x7A, 0xAD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"S", 51*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x73, 0x0A, 0xA0, 0x37, 0xA0, 0x0A, 0xA0, 0x0A, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x3D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"T", 52*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x00, 0xAA, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x5F, 0x00, 0x00, 0x55, 0x3D, 0x30, 0x00, 0x73, 0x03, 0xDA, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"U", 53*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA3, 0x07, 0xAA, 0x3D, 0xA0, 0x00, 0xD3, 0x0A, 0xA0, 0x00, 0xA0, 0x0A, 0xA0, 0x03, 0x70, 0x03, 0xD3, 0x0A, 0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x5F, 0x55, 0x00, 0x00, 0x5F, 0x55, 0x00, 0x00, 0x3D, 0xD3, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"V", 54*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x77, 0xA3, 0xAA, 0x5F, 0x0A, 0xA0, 0x55, 0x5F, 0x0A, 0xA0, 0x82, 0x5F, 0x0A, 0xC2, 0xA0, 0x2C, 0x7A, 0xF5, 0xA0, 0x0A, 0xC8, 0xF8, 0x70, 0x0A, 0xF5, 0xFF, 0x00, 0x0A, 0xF5, 0xFF, 0x00, 0x0A, 0xF5, 0x8F, 0x00, 0x00, 0xA0, 0x55, 0x00, 0x00, 0xA0, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"W", 55*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xA3, 0x3A, 0xA3, 0x07, 0xC2, 0x0A, 0x70, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0xC8, 0x55, 0x00, 0x00, 0x5F, 0x82, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xD3, 0x00, 0x00, 0x55, 0xF8, 0x00, 0x00, 0xC5, 0x8F, 0x00, 0x03, 0xA0, 0x3D, 0x30, 0x3D, 0xD3, 0x3D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"X", 56*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA3, 0x07, 0xAA, 0x3D, 0xA0, 0x00, 0xD3, 0x0A, 0xA0, 0x07, 0x30, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x8C, 0x37, 0x00, 0x00, 0x5F, 0x73, 0x00, 0x00, 0x2C, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0xAD, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"Y", 57*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0xA3, 0x28, 0x00, 0x2C, 0xA0, 0x22, 0x00, 0x5F, 0x30, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x3D, 0x30, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x33, 0x0A, 0xD3, 0x00, 0x73, 0x3D, 0xDA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"Z", 58*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xA3, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x55, 0x52, 0x00, 0x03, 0x55, 0x52}, /*"[", 59*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x73}, /*"\", 60*/
+    {0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0x55, 0x85, 0x00, 0x03, 0x55, 0x52, 0x00}, /*"]", 61*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA3, 0x00, 0x00, 0x7A, 0x3A, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"^", 62*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA}, /*"_", 63*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"`", 64*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x00, 0x07, 0x85, 0x5C, 0x70, 0x07, 0x73, 0x5C, 0xA0, 0x00, 0xAD, 0x5C, 0xA0, 0x2C, 0x70, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x30, 0x2C, 0xA3, 0x2C, 0xDA, 0x8C, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"a", 65*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x55, 0x00, 0x0A, 0xDA, 0x5C, 0x70, 0x0A, 0xD3, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xC2, 0x03, 0xA0, 0x0A, 0x8C, 0xAD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"b", 66*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x00, 0x07, 0x85, 0x8C, 0x00, 0x2C, 0x70, 0x5F, 0x00, 0x5F, 0x00, 0x25, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x70, 0x0A, 0xA0, 0x03, 0x70, 0x03, 0x7A, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"c", 67*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x55, 0x3A, 0xA0, 0x07, 0xC5, 0x7D, 0xA0, 0x2C, 0x70, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x0A, 0x30, 0x2C, 0xC2, 0x03, 0xDA, 0x8C, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"d", 68*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0xA7, 0x5C, 0x70, 0x03, 0xA0, 0x00, 0xF5, 0x0A, 0xDA, 0xAA, 0xF5, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x73, 0x00, 0x5C, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"e", 69*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x2C, 0x70, 0xF5, 0x00, 0x5F, 0x00, 0x52, 0x25, 0x8F, 0x55, 0x30, 0x25, 0x8F, 0x55, 0x30, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x07, 0xCF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"f", 70*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x55, 0x00, 0xC8, 0x8C, 0x5C, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x00, 0xF8, 0x8C, 0x00, 0x07, 0xC5, 0x52, 0x00, 0x07, 0xFF, 0xC5, 0x30, 0x3A, 0x55, 0x55, 0xD3, 0x5F, 0x30, 0x03, 0xF5, 0x25, 0xDA, 0xAD, 0x52}, /*"g", 71*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA3, 0x55, 0x00, 0x0A, 0xD7, 0x5C, 0x70, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x3D, 0xD3, 0x3D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"h", 72*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x30, 0x00, 0x03, 0x5C, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x07, 0xAD, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"i", 73*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x00, 0x00, 0x25, 0x8F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x03, 0x30, 0x8C, 0x00, 0x0A, 0xDA, 0xC2, 0x00}, /*"j", 74*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x55, 0x30, 0x0A, 0xA0, 0x88, 0x30, 0x0A, 0xA0, 0xD3, 0x00, 0x0A, 0xA7, 0xA0, 0x00, 0x0A, 0xFC, 0xC2, 0x00, 0x0A, 0xC2, 0xF5, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x3D, 0xD3, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"k", 75*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x07, 0xAA, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x07, 0xAD, 0xDA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"l", 76*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x25, 0x33, 0x52, 0x8F, 0x8C, 0xD7, 0xF5, 0x5F, 0x0A, 0xA0, 0xF5, 0x5F, 0x0A, 0xA0, 0xF5, 0x5F, 0x0A, 0xA0, 0xF5, 0x5F, 0x0A, 0xA0, 0xF5, 0x5F, 0x0A, 0xA0, 0xF5, 0xCF, 0x7A, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"m", 77*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x55, 0x00, 0x2C, 0xDA, 0x5C, 0x70, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x3D, 0xD3, 0x3D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"n", 78*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x00, 0x00, 0xC8, 0x8C, 0x00, 0x2C, 0x70, 0x07, 0xC2, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x5F, 0x00, 0x00, 0xF5, 0x0A, 0xA0, 0x0A, 0xA0, 0x03, 0x7A, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"o", 79*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x33, 0x55, 0x00, 0x2C, 0xD7, 0x5C, 0x70, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xA0, 0x00, 0xF5, 0x0A, 0xC2, 0x0A, 0xA0, 0x0A, 0xC8, 0xAD, 0x30, 0x0A, 0xA0, 0x00, 0x00, 0x3D, 0xDA, 0x00, 0x00}, /*"p", 80*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x30, 0x30, 0x07, 0xC5, 0x7A, 0xA0, 0x2C, 0x70, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x5F, 0x00, 0x0A, 0xA0, 0x0A, 0x30, 0x2C, 0xA0, 0x03, 0xDA, 0x8C, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0xAD, 0xD3}, /*"q", 81*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x52, 0x25, 0x52, 0x55, 0xF5, 0x85, 0xF5, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0xAA, 0xFC, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"r", 82*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x52, 0x00, 0xC8, 0x55, 0xF5, 0x0A, 0xA0, 0x00, 0x33, 0x03, 0xDA, 0x00, 0x00, 0x00, 0x3A, 0xCF, 0x30, 0x07, 0x00, 0x25, 0xD3, 0x0A, 0x30, 0x03, 0xD3, 0x0A, 0xDA, 0xAD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"s", 83*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x25, 0x8F, 0x55, 0x00, 0x25, 0x8F, 0x55, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0xA0, 0x00, 0x2C, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"t", 84*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xA0, 0x25, 0xA0, 0x2C, 0xA0, 0x2C, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xC2, 0x2C, 0xC2, 0x03, 0xFC, 0x8C, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"u", 85*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x03, 0x55, 0x2C, 0xF8, 0x03, 0xF8, 0x00, 0xF5, 0x00, 0xA0, 0x00, 0x8C, 0x07, 0x30, 0x00, 0x5F, 0x0A, 0x00, 0x00, 0x2C, 0xA7, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"v", 86*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x33, 0x55, 0x25, 0x8F, 0x33, 0xF8, 0x58, 0x5F, 0x03, 0xF5, 0x55, 0x2C, 0x7A, 0xF5, 0x55, 0x0A, 0xC8, 0x5F, 0xA0, 0x0A, 0xF5, 0x5F, 0xA0, 0x07, 0xD3, 0x3D, 0x70, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"w", 87*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x25, 0x52, 0x25, 0xF8, 0x2C, 0x52, 0x00, 0xC8, 0x5C, 0x00, 0x00, 0x5F, 0x82, 0x00, 0x00, 0x0A, 0xC2, 0x00, 0x00, 0x37, 0xF5, 0x00, 0x00, 0xD3, 0x5F, 0x30, 0x3A, 0xD3, 0xCF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"x", 88*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x25, 0x52, 0x2C, 0xF8, 0x2C, 0x52, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x8C, 0x37, 0x00, 0x00, 0x5F, 0x55, 0x00, 0x00, 0x2C, 0x82, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x07, 0x30, 0x00, 0x03, 0x28, 0x00, 0x00, 0x0A, 0xC5, 0x00, 0x00}, /*"y", 89*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x55, 0x30, 0x0A, 0x55, 0x8F, 0x30, 0x07, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x2C, 0xA0, 0x00, 0x00, 0x5F, 0x30, 0x33, 0x00, 0xFC, 0x00, 0x85, 0x07, 0xFC, 0xAA, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"z", 90*/
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x07, 0x52, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x3D, 0x30, 0x00, 0x00, 0x03, 0x30}, /*"{", 91*/
+    {0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00}, /*"|", 92*/
+    {0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x25, 0x70, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00}, /*"}", 93*/
+    {0x03, 0x52, 0x00, 0x00, 0x0A, 0x58, 0x00, 0x00, 0x55, 0x00, 0x82, 0x28, 0x22, 0x00, 0x28, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~", 94*/
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,580 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_st7789_async_test.c
+ * @brief     driver st7789 async test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2023-04-15
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2023/04/15  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_st7789_async_test.h"
+
+/**
+ * @brief async test screen definition
+ */
+#define ST7789_ASYNC_TEST_COLUMN        120        /**< test column */
+#define ST7789_ASYNC_TEST_ROW           80         /**< test row */
+#define ST7789_ASYNC_TEST_IMAGE_WIDTH   40         /**< test image width */
+#define ST7789_ASYNC_TEST_IMAGE_HEIGHT  30         /**< test image height */
+
+static st7789_handle_t gs_handle;                                                                 /**< st7789 handle */
+static uint16_t gs_image16[ST7789_ASYNC_TEST_IMAGE_WIDTH * ST7789_ASYNC_TEST_IMAGE_HEIGHT];       /**< 16 bits image */
+static uint32_t gs_image32[ST7789_ASYNC_TEST_IMAGE_WIDTH * ST7789_ASYNC_TEST_IMAGE_HEIGHT];       /**< 18 bits image */
+static uint8_t gs_framebuffer[ST7789_ASYNC_TEST_COLUMN * ST7789_ASYNC_TEST_ROW * 3];             /**< framebuffer */
+static uint32_t gs_mock_hash;                                                                     /**< stream hash */
+static uint8_t gs_mock_dc;                                                                        /**< command data level */
+static uint8_t gs_mock_last_dc;                                                                   /**< hashed command data level */
+static uint8_t *gs_mock_buf;                                                                      /**< buffer in flight */
+static uint32_t gs_mock_len;                                                                      /**< length in flight */
+static uint32_t gs_mock_sum;                                                                      /**< checksum of the buffer in flight */
+static uint8_t gs_mock_pending;                                                                   /**< busy polls left */
+static uint8_t gs_mock_fail;                                                                      /**< fail the next async write */
+static uint32_t gs_mock_error;                                                                    /**< protocol errors */
+static uint32_t gs_mock_async;                                                                    /**< async writes */
+static uint8_t gs_mock_callback;                                                                  /**< report the end with st7789_async_complete */
+
+/**
+ * @brief     mock checksum
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    checksum
+ * @note      none
+ */
+static uint32_t a_mock_sum(uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t sum;
+    
+    sum = 0;
+    for (i = 0; i < len; i++)
+    {
+        sum = (sum << 5) + sum + buf[i] + i;
+    }
+    
+    return sum;
+}
+
+/**
+ * @brief     mock feed the stream hash
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @note      back to back data writes hash the same as one write
+ */
+static void a_mock_feed(uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    
+    if (gs_mock_dc != gs_mock_last_dc)
+    {
+        gs_mock_hash = (gs_mock_hash ^ (0x100U | gs_mock_dc)) * 16777619U;
+        gs_mock_last_dc = gs_mock_dc;
+    }
+    for (i = 0; i < len; i++)
+    {
+        gs_mock_hash = (gs_mock_hash ^ buf[i]) * 16777619U;
+    }
+}
+
+/**
+ * @brief  mock spi init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_mock_spi_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     mock spi bus write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_spi_write_cmd(uint8_t *buf, uint32_t len)
+{
+    if (gs_mock_pending != 0)
+    {
+        gs_mock_error++;
+    }
+    a_mock_feed(buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     mock spi bus write without waiting
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      the write stays busy for two polls or is done at once and reported with st7789_async_complete
+ */
+static uint8_t a_mock_spi_write_cmd_async(uint8_t *buf, uint32_t len)
+{
+    if (gs_mock_pending != 0)
+    {
+        gs_mock_error++;
+    }
+    if (gs_mock_callback != 0)
+    {
+        a_mock_feed(buf, len);
+        gs_mock_async++;
+        (void)st7789_async_complete(&gs_handle, gs_mock_fail);
+        gs_mock_fail = 0;
+        
+        return 0;
+    }
+    gs_mock_buf = buf;
+    gs_mock_len = len;
+    gs_mock_sum = a_mock_sum(buf, len);
+    gs_mock_pending = 3;
+    gs_mock_async++;
+    
+    return 0;
+}
+
+/**
+ * @brief  mock spi bus write status
+ * @return status code
+ *         - 0 idle
+ *         - 1 busy
+ *         - 2 the last write failed
+ * @note   the buffer must not change while it is in flight
+ */
+static uint8_t a_mock_spi_write_cmd_busy(void)
+{
+    if (gs_mock_pending == 0)
+    {
+        return 0;
+    }
+    gs_mock_pending--;
+    if (gs_mock_pending != 0)
+    {
+        return 1;
+    }
+    if (a_mock_sum(gs_mock_buf, gs_mock_len) != gs_mock_sum)
+    {
+        gs_mock_error++;
+    }
+    a_mock_feed(gs_mock_buf, gs_mock_len);
+    if (gs_mock_fail != 0)
+    {
+        gs_mock_fail = 0;
+        
+        return 2;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     mock gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      the command data level must not change while a write is in flight
+ */
+static uint8_t a_mock_cmd_data_gpio_write(uint8_t value)
+{
+    if (gs_mock_pending != 0)
+    {
+        gs_mock_error++;
+    }
+    gs_mock_dc = value;
+    
+    return 0;
+}
+
+/**
+ * @brief     mock gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_reset_gpio_write(uint8_t value)
+{
+    (void)value;
+    
+    return 0;
+}
+
+/**
+ * @brief     draw the test picture in the current format
+ * @param[in] format control interface color format
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw failed
+ * @note      none
+ */
+static uint8_t a_st7789_async_test_draw_picture(st7789_control_interface_color_format_t format,
+                                                uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT)
+    {
+        return st7789_draw_picture_12bits(&gs_handle, left, top, right, bottom, gs_image16);
+    }
+    else if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT)
+    {
+        return st7789_draw_picture_16bits(&gs_handle, left, top, right, bottom, gs_image16);
+    }
+    else
+    {
+        return st7789_draw_picture_18bits(&gs_handle, left, top, right, bottom, gs_image32);
+    }
+}
+
+/**
+ * @brief     run the drawing sequence
+ * @param[in] async async write mode, 0 blocking, 1 busy polling, 2 completion callback
+ * @param[out] *hash pointer to a stream hash buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_async_test_run(uint8_t async, uint32_t *hash)
+{
+    uint8_t res;
+    uint8_t i;
+    char str[] = "libdriver";
+    st7789_control_interface_color_format_t format[3] = {ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_18_BIT};
+                                                         
+    /* link functions */
+    DRIVER_ST7789_LINK_INIT(&gs_handle, st7789_handle_t);
+    DRIVER_ST7789_LINK_SPI_INIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_SPI_DEINIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(&gs_handle, a_mock_spi_write_cmd);
+    if (async != 0)
+    {
+        DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_ASYNC(&gs_handle, a_mock_spi_write_cmd_async);
+    }
+    if (async == 1)
+    {
+        DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_BUSY(&gs_handle, a_mock_spi_write_cmd_busy);
+    }
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, a_mock_cmd_data_gpio_write);
+    DRIVER_ST7789_LINK_RESET_GPIO_INIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_DEINIT(&gs_handle, a_mock_spi_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_WRITE(&gs_handle, a_mock_reset_gpio_write);
+    DRIVER_ST7789_LINK_DELAY_MS(&gs_handle, st7789_interface_delay_ms);
+    DRIVER_ST7789_LINK_DEBUG_PRINT(&gs_handle, st7789_interface_debug_print);
+    
+    /* reset the mock */
+    gs_mock_hash = 2166136261U;
+    gs_mock_dc = 0;
+    gs_mock_last_dc = 0xFF;
+    gs_mock_pending = 0;
+    gs_mock_fail = 0;
+    gs_mock_error = 0;
+    gs_mock_async = 0;
+    gs_mock_callback = (async == 2) ? 1 : 0;
+    
+    /* st7789 init */
+    res = st7789_init(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_column(&gs_handle, ST7789_ASYNC_TEST_COLUMN);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set column failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_set_row(&gs_handle, ST7789_ASYNC_TEST_ROW);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set row failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < 3; i++)
+    {
+        res = st7789_set_interface_pixel_format(&gs_handle, ST7789_RGB_INTERFACE_COLOR_FORMAT_262K, format[i]);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_clear(&gs_handle);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: clear failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* row major and column major pictures */
+        res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_ROW_MAJOR);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set image layout failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = a_st7789_async_test_draw_picture(format[i], 0, 0, ST7789_ASYNC_TEST_IMAGE_WIDTH - 1,
+                                               ST7789_ASYNC_TEST_IMAGE_HEIGHT - 1);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: draw picture failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_COLUMN_MAJOR);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set image layout failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = a_st7789_async_test_draw_picture(format[i], 50, 10, 50 + ST7789_ASYNC_TEST_IMAGE_HEIGHT - 1,
+                                               10 + ST7789_ASYNC_TEST_IMAGE_WIDTH - 1);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: draw picture failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* strings */
+        res = st7789_write_string(&gs_handle, 0, 40, str, (uint16_t)strlen(str), 0xFFFF, ST7789_FONT_16);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: write string failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_write_string_with_background(&gs_handle, 0, 56, str, (uint16_t)strlen(str),
+                                                  0x07E0, 0x001F, ST7789_FONT_24);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: write string with background failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* framebuffer flush */
+        res = st7789_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_clear(&gs_handle);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: clear failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_fill_rect(&gs_handle, 0, 0, ST7789_ASYNC_TEST_COLUMN - 1, 20, 0xF800);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: fill rect failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_write_string(&gs_handle, 30, 30, str, (uint16_t)strlen(str), 0xFFFF, ST7789_FONT_12);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: write string failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_flush(&gs_handle);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: flush failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = st7789_set_framebuffer(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    *hash = gs_mock_hash;
+    
+    /* the failed async write must be reported */
+    if (async != 0)
+    {
+        res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_ROW_MAJOR);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set image layout failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: async write failure test.\n");
+        gs_mock_fail = 1;
+        res = st7789_draw_picture_18bits(&gs_handle, 0, 0, ST7789_ASYNC_TEST_IMAGE_WIDTH - 1,
+                                         ST7789_ASYNC_TEST_IMAGE_HEIGHT - 1, gs_image32);
+        if (res == 0)
+        {
+            st7789_interface_debug_print("st7789: async write failure is not reported.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* finish all */
+    (void)st7789_deinit(&gs_handle);
+    if (gs_mock_pending != 0)
+    {
+        st7789_interface_debug_print("st7789: async write is left in flight.\n");
+        
+        return 1;
+    }
+    if (gs_mock_error != 0)
+    {
+        st7789_interface_debug_print("st7789: %d async protocol errors.\n", gs_mock_error);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  async test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the spi bus is replaced by a software mock, no panel is needed
+ */
+uint8_t st7789_async_test(void)
+{
+    uint32_t i;
+    uint32_t hash_blocking;
+    uint32_t hash_async;
+    uint32_t hash_callback;
+    
+    /* print chip info */
+    st7789_interface_debug_print("st7789: start async test.\n");
+    
+    /* make the images */
+    for (i = 0; i < ST7789_ASYNC_TEST_IMAGE_WIDTH * ST7789_ASYNC_TEST_IMAGE_HEIGHT; i++)
+    {
+        gs_image16[i] = (uint16_t)(i * 37 + (i >> 3));
+        gs_image32[i] = (i * 2654435761U) & 0x3FFFF;
+    }
+    
+    /* blocking write */
+    st7789_interface_debug_print("st7789: blocking write test.\n");
+    if (a_st7789_async_test_run(0, &hash_blocking) != 0)
+    {
+        return 1;
+    }
+    
+    /* async write */
+    st7789_interface_debug_print("st7789: async write test.\n");
+    if (a_st7789_async_test_run(1, &hash_async) != 0)
+    {
+        return 1;
+    }
+    if (gs_mock_async == 0)
+    {
+        st7789_interface_debug_print("st7789: async write is not used.\n");
+        
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: %d async writes.\n", gs_mock_async);
+    
+    /* async write with the completion callback */
+    st7789_interface_debug_print("st7789: async completion callback test.\n");
+    if (a_st7789_async_test_run(2, &hash_callback) != 0)
+    {
+        return 1;
+    }
+    if (gs_mock_async == 0)
+    {
+        st7789_interface_debug_print("st7789: async write is not used.\n");
+        
+        return 1;
+    }
+    
+    /* check the stream */
+    st7789_interface_debug_print("st7789: blocking stream hash 0x%08X.\n", hash_blocking);
+    st7789_interface_debug_print("st7789: async stream hash 0x%08X.\n", hash_async);
+    st7789_interface_debug_print("st7789: callback stream hash 0x%08X.\n", hash_callback);
+    if ((hash_blocking != hash_async) || (hash_blocking != hash_callback))
+    {
+        st7789_interface_debug_print("st7789: async stream check failed.\n");
+        
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: async stream check passed.\n");
+    
+    /* finish async test */
+    st7789_interface_debug_print("st7789: finish async test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,1184 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_st7789_benchmark_test.c
+ * @brief     driver st7789 benchmark test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2023-04-15
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2023/04/15  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_st7789_benchmark_test.h"
+
+/**
+ * @brief benchmark test definition
+ */
+#define ST7789_BENCHMARK_TIME_MS            100          /**< minimum time of one case */
+#define ST7789_BENCHMARK_IMAGE_SIZE         64           /**< max test image width and height */
+#define ST7789_BENCHMARK_POLYLINE_SIZE      240          /**< max polyline segments */
+#define ST7789_BENCHMARK_BDF_SIZE           16384        /**< max bdf file length */
+#define ST7789_BENCHMARK_GLYPH_NUM          16           /**< max glyph cache entries */
+#define ST7789_BENCHMARK_COMPRESSED_SIZE    8192         /**< max compressed picture length */
+#define ST7789_BENCHMARK_COMPRESSED_BLOCK   2040         /**< compressed block length */
+
+static st7789_handle_t gs_handle;                                                                     /**< st7789 handle */
+static uint16_t gs_image16[ST7789_BENCHMARK_IMAGE_SIZE * ST7789_BENCHMARK_IMAGE_SIZE];                /**< 12 and 16 bits image */
+static uint32_t gs_image32[ST7789_BENCHMARK_IMAGE_SIZE * ST7789_BENCHMARK_IMAGE_SIZE];                /**< 18 bits image */
+static uint32_t gs_mock_bytes;                                                                        /**< bytes sent */
+static uint32_t gs_mock_transactions;                                                                 /**< spi writes */
+static uint32_t gs_mock_dc_writes;                                                                    /**< command data gpio writes */
+static st7789_control_interface_color_format_t gs_format;                                             /**< current format */
+static char gs_str[] = "libdriver st7789";                                                           /**< test string */
+static char gs_digits[] = "12:34";                                                                    /**< test digits */
+static st7789_point_t gs_points[ST7789_BENCHMARK_POLYLINE_SIZE + 1];                                  /**< polyline points */
+static char gs_bdf_file[ST7789_BENCHMARK_BDF_SIZE];                                                   /**< bdf file */
+static st7789_glyph_t gs_glyph[ST7789_BENCHMARK_GLYPH_NUM];                                           /**< glyph cache */
+static st7789_bdf_t gs_bdf;                                                                           /**< bdf font */
+static st7789_glyph_slot_t gs_glyph_slot[ST7789_BENCHMARK_GLYPH_NUM];                                 /**< wire format glyph cache */
+static uint8_t gs_compressed[ST7789_BENCHMARK_COMPRESSED_SIZE];                                       /**< compressed picture */
+static uint32_t gs_compressed_len;                                                                    /**< compressed picture length */
+static st7789_jpeg_t gs_jpeg;                                                                         /**< jpeg decoder */
+static st7789_jpeg_scale_t gs_jpeg_scale;                                                             /**< jpeg scale */
+static const uint8_t gsc_jpeg[] =                                                                     /**< 64x48 4:2:0 baseline jpeg */
+{
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E,
+    0x0F, 0x0C, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A,
+    0x1B, 0x23, 0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F,
+    0x2D, 0x30, 0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07,
+    0x07, 0x0A, 0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x30, 0x00, 0x40, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x1B, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x02, 0x04, 0x06, 0x00, 0x07, 0x08, 0xFF, 0xC4,
+    0x00, 0x20, 0x10, 0x00, 0x01, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x04, 0x31, 0x03, 0x21, 0x05, 0x11, 0x12, 0x41, 0x22, 0x14,
+    0xFF, 0xC4, 0x00, 0x1A, 0x01, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x05, 0x01, 0x03, 0x08, 0x07, 0xFF, 0xC4, 0x00, 0x20,
+    0x11, 0x00, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x03, 0x04, 0x05, 0x02, 0x11, 0x13, 0x21, 0x06, 0x12, 0x22, 0x51, 0xFF, 0xDA,
+    0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9, 0xC6, 0x24, 0x1F,
+    0x44, 0x69, 0x3E, 0x87, 0xC7, 0x80, 0x06, 0x95, 0xCE, 0x3E, 0x0D, 0x69, 0x39, 0x64, 0x6F, 0x2D,
+    0xA4, 0xFA, 0x92, 0x36, 0x0D, 0x35, 0xCE, 0xE2, 0x82, 0xCC, 0xE2, 0x4E, 0x81, 0x4B, 0x31, 0xC6,
+    0x0C, 0x14, 0x8E, 0xC6, 0x01, 0xF1, 0x59, 0x76, 0x23, 0xDD, 0x29, 0xE2, 0x8C, 0xE7, 0x1A, 0x55,
+    0xB6, 0x7E, 0x58, 0x5B, 0xCC, 0xB6, 0xCA, 0x4B, 0x09, 0xDD, 0xF6, 0x4A, 0xEC, 0x0C, 0x05, 0x33,
+    0x8F, 0x1C, 0x3B, 0xE2, 0x0E, 0x18, 0xCE, 0x1F, 0x13, 0x48, 0x78, 0x88, 0x23, 0xB0, 0xA0, 0x45,
+    0xF2, 0xEC, 0xB2, 0xCF, 0xD1, 0xE4, 0x9A, 0x3B, 0xBD, 0x74, 0x50, 0xBF, 0x80, 0x38, 0x52, 0x19,
+    0x81, 0xE4, 0xD2, 0xD3, 0x45, 0x8D, 0xE9, 0xA3, 0x48, 0xB9, 0x60, 0xEA, 0x96, 0x6F, 0x98, 0x6E,
+    0x4B, 0x1C, 0xCD, 0xA4, 0x50, 0x26, 0x9C, 0x4E, 0x89, 0x58, 0x98, 0x10, 0xFF, 0x00, 0x23, 0x4A,
+    0xE6, 0x48, 0xDD, 0x0A, 0x4D, 0x20, 0x45, 0xFC, 0x8D, 0x2B, 0x79, 0x61, 0xF6, 0x29, 0x59, 0xBD,
+    0x24, 0x8A, 0xEF, 0x8F, 0xC5, 0xCD, 0x31, 0x25, 0xFD, 0xAC, 0xD3, 0x22, 0xFA, 0x7D, 0x26, 0xF0,
+    0xB8, 0xE0, 0xE0, 0x34, 0xAC, 0x63, 0x89, 0xD3, 0xE9, 0x3A, 0x83, 0x88, 0x00, 0x34, 0xBC, 0xFE,
+    0xAD, 0xF6, 0x72, 0x92, 0x79, 0xD2, 0xD6, 0x25, 0x9D, 0x0D, 0x25, 0x87, 0x8D, 0x01, 0xB4, 0xBB,
+    0x14, 0x4F, 0x2E, 0xA5, 0xA1, 0x76, 0x20, 0x5B, 0x4A, 0x38, 0xE2, 0xFA, 0x7D, 0x28, 0xDE, 0x40,
+    0xF3, 0x18, 0xBC, 0x38, 0x12, 0x48, 0x12, 0xCE, 0xBB, 0x51, 0xE3, 0xE3, 0x76, 0x06, 0x93, 0x37,
+    0x43, 0xED, 0xB4, 0xAE, 0x71, 0xD0, 0xFA, 0x03, 0x49, 0x9B, 0xA2, 0xF4, 0xDA, 0x48, 0xE3, 0x49,
+    0x26, 0xBC, 0xFB, 0xFE, 0x2B, 0xD8, 0xF2, 0xFE, 0xD7, 0x9E, 0xF1, 0xF8, 0x34, 0x34, 0x9B, 0xB6,
+    0x1F, 0xA6, 0xD2, 0x84, 0x3C, 0x1E, 0x48, 0xD2, 0x7F, 0x13, 0x08, 0x70, 0x1A, 0x5A, 0x69, 0x6E,
+    0x1B, 0x90, 0xC7, 0x06, 0x65, 0x73, 0x6B, 0x32, 0x48, 0x3B, 0x0B, 0x3E, 0xEE, 0x3C, 0x83, 0x48,
+    0xB8, 0x62, 0x39, 0xBF, 0x16, 0xAD, 0x90, 0x43, 0x85, 0x22, 0xB3, 0x8C, 0x07, 0xE2, 0xA4, 0xB3,
+    0xA5, 0x70, 0xB8, 0x5C, 0x64, 0xA4, 0xF0, 0xAC, 0x46, 0x80, 0x2B, 0x37, 0x8A, 0x2B, 0x8F, 0xC4,
+    0xCE, 0x1F, 0x1E, 0x49, 0x1A, 0x4F, 0x70, 0x71, 0x7B, 0xA4, 0xD2, 0x34, 0x00, 0xDE, 0xB4, 0xAB,
+    0xE2, 0xD2, 0x3A, 0x5C, 0x19, 0xBC, 0x52, 0x58, 0xF6, 0x23, 0x5D, 0x25, 0x91, 0x21, 0x79, 0x68,
+    0xD2, 0x3E, 0x58, 0xFA, 0xA4, 0xE0, 0x60, 0x0D, 0x14, 0x86, 0xEC, 0x3E, 0x8D, 0x29, 0x77, 0x96,
+    0xCD, 0xC3, 0x8F, 0xC3, 0x81, 0x48, 0x60, 0xC9, 0x39, 0x1D, 0x95, 0xFF, 0xD9,
+};
+
+/**
+ * @brief  mock init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_mock_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     mock spi bus write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_spi_write_cmd(uint8_t *buf, uint32_t len)
+{
+    (void)buf;
+    
+    gs_mock_bytes += len;
+    gs_mock_transactions++;
+    
+    return 0;
+}
+
+/**
+ * @brief     mock command data gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_cmd_data_gpio_write(uint8_t value)
+{
+    (void)value;
+    
+    gs_mock_dc_writes++;
+    
+    return 0;
+}
+
+/**
+ * @brief     mock reset gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_reset_gpio_write(uint8_t value)
+{
+    (void)value;
+    
+    return 0;
+}
+
+/**
+ * @brief     benchmark clear
+ * @param[in] width unused
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_clear(uint16_t width, uint16_t height)
+{
+    (void)width;
+    (void)height;
+    
+    return st7789_clear(&gs_handle);
+}
+
+/**
+ * @brief     benchmark fill rect
+ * @param[in] width rect width
+ * @param[in] height rect height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_fill_rect(uint16_t width, uint16_t height)
+{
+    return st7789_fill_rect(&gs_handle, 0, 0, width - 1, height - 1, 0xF81F);
+}
+
+/**
+ * @brief     benchmark draw point
+ * @param[in] width points width
+ * @param[in] height points height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_point(uint16_t width, uint16_t height)
+{
+    uint16_t x;
+    uint16_t y;
+    
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            if (st7789_draw_point(&gs_handle, x, y, 0x07E0) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     benchmark draw line
+ * @param[in] width line width
+ * @param[in] height line height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_line(uint16_t width, uint16_t height)
+{
+    return st7789_draw_line(&gs_handle, 0, 0, width - 1, height - 1, 0xFFE0);
+}
+
+/**
+ * @brief     benchmark draw line aa
+ * @param[in] width line width
+ * @param[in] height line height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_line_aa(uint16_t width, uint16_t height)
+{
+    return st7789_draw_line_aa(&gs_handle, 0, 0, width - 1, height - 1, 0xFFE0, 0x0000);
+}
+
+/**
+ * @brief     benchmark draw polyline
+ * @param[in] width segments
+ * @param[in] height chart height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the chart zigzags across the screen
+ */
+static uint8_t a_st7789_benchmark_draw_polyline(uint16_t width, uint16_t height)
+{
+    uint16_t i;
+    
+    for (i = 0; i <= width; i++)
+    {
+        gs_points[i].x = (uint16_t)((uint32_t)i * 239 / width);
+        gs_points[i].y = (uint16_t)((i * 37) % height);
+    }
+    
+    return st7789_draw_polyline(&gs_handle, gs_points, width + 1, 0x07FF);
+}
+
+/**
+ * @brief     benchmark draw circle
+ * @param[in] width circle diameter
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_circle(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_draw_circle(&gs_handle, 119, 159, (width - 1) / 2, 0xFFFF);
+}
+
+/**
+ * @brief     benchmark fill circle
+ * @param[in] width circle diameter
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_fill_circle(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_fill_circle(&gs_handle, 119, 159, (width - 1) / 2, 0xF81F);
+}
+
+/**
+ * @brief     benchmark draw arc
+ * @param[in] width arc diameter
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the arc is a 270 degrees gauge
+ */
+static uint8_t a_st7789_benchmark_draw_arc(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_draw_arc(&gs_handle, 119, 159, (width - 1) / 2, 135, 405, 0x07E0);
+}
+
+/**
+ * @brief     benchmark draw round rect
+ * @param[in] width rect width
+ * @param[in] height rect height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_round_rect(uint16_t width, uint16_t height)
+{
+    return st7789_draw_round_rect(&gs_handle, 0, 0, width - 1, height - 1, 16, 0x001F);
+}
+
+/**
+ * @brief     benchmark fill round rect
+ * @param[in] width rect width
+ * @param[in] height rect height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_fill_round_rect(uint16_t width, uint16_t height)
+{
+    return st7789_fill_round_rect(&gs_handle, 0, 0, width - 1, height - 1, 16, 0xFD20);
+}
+
+/**
+ * @brief     benchmark fill triangle
+ * @param[in] width triangle width
+ * @param[in] height triangle height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_fill_triangle(uint16_t width, uint16_t height)
+{
+    return st7789_fill_triangle(&gs_handle, width / 2, 0, width - 1, height - 1, 0, height * 2 / 3, 0x07E0);
+}
+
+/**
+ * @brief     benchmark fill polygon
+ * @param[in] width star width
+ * @param[in] height star height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the star is a concave polygon of ten points
+ */
+static uint8_t a_st7789_benchmark_fill_polygon(uint16_t width, uint16_t height)
+{
+    uint8_t i;
+    const uint8_t star[10][2] = {{50, 0}, {61, 35}, {98, 35}, {68, 57}, {79, 91},
+                                 {50, 70}, {21, 91}, {32, 57}, {2, 35}, {39, 35}};
+    
+    for (i = 0; i < 10; i++)
+    {
+        gs_points[i].x = (uint16_t)((uint32_t)star[i][0] * (width - 1) / 100);
+        gs_points[i].y = (uint16_t)((uint32_t)star[i][1] * (height - 1) / 100);
+    }
+    
+    return st7789_fill_polygon(&gs_handle, gs_points, 10, 0xF800);
+}
+
+/**
+ * @brief     benchmark write string
+ * @param[in] width font
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_write_string(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_write_string(&gs_handle, 0, 0, gs_str, (uint16_t)strlen(gs_str), 0xFFFF, (st7789_font_t)width);
+}
+
+/**
+ * @brief     benchmark write string with background
+ * @param[in] width font
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_write_string_with_background(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_write_string_with_background(&gs_handle, 0, 0, gs_str, (uint16_t)strlen(gs_str),
+                                               0xFFFF, 0x001F, (st7789_font_t)width);
+}
+
+/**
+ * @brief     benchmark write string aa
+ * @param[in] width font
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_write_string_aa(uint16_t width, uint16_t height)
+{
+    (void)height;
+    
+    return st7789_write_string_aa(&gs_handle, 0, 0, gs_str, (uint16_t)strlen(gs_str),
+                                  0xFFFF, 0x001F, (st7789_font_t)width);
+}
+
+/**
+ * @brief     benchmark write string scaled
+ * @param[in] width font
+ * @param[in] height scale
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_write_string_scaled(uint16_t width, uint16_t height)
+{
+    return st7789_write_string_scaled(&gs_handle, 0, 0, gs_digits, (uint16_t)strlen(gs_digits),
+                                      0xFFFF, 0x001F, (st7789_font_t)width, (uint8_t)height);
+}
+
+/**
+ * @brief     benchmark write utf8
+ * @param[in] width glyph cache entries
+ * @param[in] height unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the string has 13 different chars, a smaller cache misses on every char
+ */
+static uint8_t a_st7789_benchmark_write_utf8(uint16_t width, uint16_t height)
+{
+    (void)width;
+    (void)height;
+    
+    return st7789_write_utf8(&gs_handle, 0, 0, gs_str, (uint16_t)strlen(gs_str), 0xFFFF, &gs_bdf);
+}
+
+/**
+ * @brief  make the benchmark bdf font
+ * @return bdf file length
+ * @note   the printable ascii chars have 8x16 glyphs with a pattern bitmap
+ */
+static uint32_t a_st7789_benchmark_make_bdf(void)
+{
+    uint32_t len;
+    uint8_t c;
+    uint8_t r;
+    
+    len = (uint32_t)sprintf(gs_bdf_file, "STARTFONT 2.1\nFONTBOUNDINGBOX 8 16 0 -4\n"
+                            "FONT_ASCENT 12\nFONT_DESCENT 4\nDEFAULT_CHAR 63\nCHARS 95\n");
+    for (c = ' '; c <= '~'; c++)
+    {
+        len += (uint32_t)sprintf(&gs_bdf_file[len], "STARTCHAR c%u\nENCODING %u\nDWIDTH 8 0\nBBX 8 16 0 -4\nBITMAP\n",
+                                 (unsigned int)c, (unsigned int)c);
+        for (r = 0; r < 16; r++)
+        {
+            len += (uint32_t)sprintf(&gs_bdf_file[len], "%02X\n", (unsigned int)((c * 37 + r * 11) & 0xFF));
+        }
+        len += (uint32_t)sprintf(&gs_bdf_file[len], "ENDCHAR\n");
+    }
+    len += (uint32_t)sprintf(&gs_bdf_file[len], "ENDFONT\n");
+    
+    return len;
+}
+
+/**
+ * @brief     benchmark draw picture
+ * @param[in] width picture width
+ * @param[in] height picture height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the picture function matches the current format
+ */
+static uint8_t a_st7789_benchmark_draw_picture(uint16_t width, uint16_t height)
+{
+    if (gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT)
+    {
+        return st7789_draw_picture_12bits(&gs_handle, 0, 0, width - 1, height - 1, gs_image16);
+    }
+    else if (gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT)
+    {
+        return st7789_draw_picture_16bits(&gs_handle, 0, 0, width - 1, height - 1, gs_image16);
+    }
+    else
+    {
+        return st7789_draw_picture_18bits(&gs_handle, 0, 0, width - 1, height - 1, gs_image32);
+    }
+}
+
+/**
+ * @brief  make the benchmark compressed picture
+ * @return compressed picture length
+ * @note   the full screen picture has 4 flat bands of 80 rows in rle blocks
+ */
+static uint32_t a_st7789_benchmark_make_compressed(void)
+{
+    uint8_t unit;
+    uint8_t band;
+    uint32_t o;
+    uint32_t p;
+    uint32_t k;
+    uint32_t n;
+    uint32_t u;
+    uint32_t run;
+    uint32_t band_units;
+    uint32_t total;
+    
+    if (gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT)
+    {
+        unit = 3;
+        band_units = 120 * 80;
+    }
+    else if (gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT)
+    {
+        unit = 2;
+        band_units = 240 * 80;
+    }
+    else
+    {
+        unit = 3;
+        band_units = 240 * 80;
+    }
+    total = band_units * 4;
+    gs_compressed[0] = 'Z';
+    gs_compressed[1] = (gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT) ? 12 :
+                       ((gs_format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT) ? 16 : 18);
+    o = 2;
+    for (u = 0; u < total; u += n)
+    {
+        n = ST7789_BENCHMARK_COMPRESSED_BLOCK / unit;
+        n = ((total - u) > n) ? n : (total - u);
+        p = o + 5;
+        for (k = 0; k < n; k += run)
+        {
+            band = (uint8_t)((u + k) / band_units);
+            run = (band + 1) * band_units - (u + k);
+            run = (run > (n - k)) ? (n - k) : run;
+            run = (run > 129) ? 129 : run;
+            gs_compressed[p] = (run >= 2) ? (uint8_t)(run + 126) : 0;
+            gs_compressed[p + 1] = (uint8_t)(0x11 * (band + 1));
+            gs_compressed[p + 2] = (uint8_t)(0x22 * (band + 1));
+            if (unit == 3)
+            {
+                gs_compressed[p + 3] = (uint8_t)(0x33 * (band + 1));
+            }
+            p += 1 + unit;
+        }
+        gs_compressed[o] = 1;
+        gs_compressed[o + 1] = (uint8_t)((n * unit) & 0xFF);
+        gs_compressed[o + 2] = (uint8_t)((n * unit) >> 8);
+        gs_compressed[o + 3] = (uint8_t)((p - o - 5) & 0xFF);
+        gs_compressed[o + 4] = (uint8_t)((p - o - 5) >> 8);
+        o = p;
+    }
+    
+    return o;
+}
+
+/**
+ * @brief     benchmark draw compressed
+ * @param[in] width picture width
+ * @param[in] height picture height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_st7789_benchmark_draw_compressed(uint16_t width, uint16_t height)
+{
+    return st7789_draw_compressed(&gs_handle, 0, 0, width - 1, height - 1, gs_compressed, gs_compressed_len);
+}
+
+/**
+ * @brief     benchmark draw jpeg
+ * @param[in] width picture width
+ * @param[in] height picture height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the scale is set by gs_jpeg_scale
+ */
+static uint8_t a_st7789_benchmark_draw_jpeg(uint16_t width, uint16_t height)
+{
+    (void)width;
+    (void)height;
+    
+    return st7789_draw_jpeg(&gs_handle, 0, 0, &gs_jpeg, gs_jpeg_scale);
+}
+
+/**
+ * @brief     run one benchmark case
+ * @param[in] *name pointer to a case name
+ * @param[in] *format_name pointer to a format name
+ * @param[in] width case width
+ * @param[in] height case height
+ * @param[in] *func pointer to a case function
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the calls repeat until ST7789_BENCHMARK_TIME_MS is over, one csv line is printed for each case
+ */
+static uint8_t a_st7789_benchmark_run(char *name, char *format_name, uint16_t width, uint16_t height,
+                                      uint8_t (*func)(uint16_t width, uint16_t height))
+{
+    uint32_t bytes;
+    uint32_t transactions;
+    uint32_t dc_writes;
+    uint32_t iterations;
+    uint32_t start;
+    uint32_t elapsed;
+    
+    /* count one call */
+    gs_mock_bytes = 0;
+    gs_mock_transactions = 0;
+    gs_mock_dc_writes = 0;
+    if (func(width, height) != 0)
+    {
+        st7789_interface_debug_print("st7789: %s failed.\n", name);
+        
+        return 1;
+    }
+    bytes = gs_mock_bytes;
+    transactions = gs_mock_transactions;
+    dc_writes = gs_mock_dc_writes;
+    
+    /* time the calls */
+    iterations = 0;
+    start = st7789_interface_get_time_ms();
+    do
+    {
+        if (func(width, height) != 0)
+        {
+            st7789_interface_debug_print("st7789: %s failed.\n", name);
+            
+            return 1;
+        }
+        iterations++;
+        elapsed = st7789_interface_get_time_ms() - start;
+    } while (elapsed < ST7789_BENCHMARK_TIME_MS);
+    
+    /* output */
+    st7789_interface_debug_print("st7789: %s,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+                                 name, format_name, (unsigned int)width, (unsigned int)height,
+                                 (unsigned int)iterations, (unsigned int)bytes, (unsigned int)transactions,
+                                 (unsigned int)dc_writes, (unsigned int)elapsed,
+                                 (unsigned int)((uint64_t)elapsed * 1000000 / iterations),
+                                 (elapsed != 0) ? (unsigned int)((uint64_t)bytes * iterations / elapsed) : 0U);
+                                 
+    return 0;
+}
+
+/**
+ * @brief     print one boot step
+ * @param[in] *mode boot mode
+ * @param[in] *step step name
+ * @param[in] start step start time
+ * @param[in] boot boot start time
+ * @param[in] polls poll calls in the step
+ * @note      one csv line is printed
+ */
+static void a_st7789_benchmark_boot_step(char *mode, char *step, uint32_t start, uint32_t boot, uint32_t polls)
+{
+    uint32_t now;
+    
+    now = st7789_interface_get_time_ms();
+    st7789_interface_debug_print("st7789: boot,%s,%s,%u,%u,%u\n", mode, step, (unsigned int)(start - boot),
+                                 (unsigned int)(now - boot), (unsigned int)polls);
+}
+
+/**
+ * @brief      poll the panel until it is ready
+ * @param[out] *polls pointer to a poll calls buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       the main loop could run between the polls
+ */
+static uint8_t a_st7789_benchmark_boot_poll(uint32_t *polls)
+{
+    st7789_bool_t ready;
+    
+    *polls = 0;
+    do
+    {
+        if (st7789_poll(&gs_handle, &ready) != 0)
+        {
+            st7789_interface_debug_print("st7789: poll failed.\n");
+            
+            return 1;
+        }
+        (*polls)++;
+    } while (ready == ST7789_BOOL_FALSE);
+    
+    return 0;
+}
+
+/**
+ * @brief  profile the boot timeline
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   one csv line is printed for each step of the blocking and the non-blocking boot
+ */
+static uint8_t a_st7789_benchmark_boot(void)
+{
+    uint8_t res;
+    uint32_t boot;
+    uint32_t start;
+    uint32_t polls;
+    
+    st7789_interface_debug_print("st7789: boot,mode,step,start_ms,end_ms,polls\n");
+    
+    /* blocking boot */
+    boot = st7789_interface_get_time_ms();
+    start = boot;
+    res = st7789_init(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init failed.\n");
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("blocking", "init", start, boot, 0);
+    start = st7789_interface_get_time_ms();
+    res = st7789_sleep_out(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: sleep out failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("blocking", "sleep_out", start, boot, 0);
+    start = st7789_interface_get_time_ms();
+    res = st7789_display_on(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: display on failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("blocking", "display_on", start, boot, 0);
+    (void)st7789_deinit(&gs_handle);
+    
+    /* non-blocking boot */
+    boot = st7789_interface_get_time_ms();
+    start = boot;
+    res = st7789_init_start(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init start failed.\n");
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("non-blocking", "init_start", start, boot, 0);
+    start = st7789_interface_get_time_ms();
+    if (a_st7789_benchmark_boot_poll(&polls) != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("non-blocking", "reset_wait", start, boot, polls);
+    start = st7789_interface_get_time_ms();
+    res = st7789_sleep_out_start(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: sleep out start failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("non-blocking", "sleep_out_start", start, boot, 0);
+    start = st7789_interface_get_time_ms();
+    if (a_st7789_benchmark_boot_poll(&polls) != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("non-blocking", "sleep_out_wait", start, boot, polls);
+    start = st7789_interface_get_time_ms();
+    res = st7789_display_on(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: display on failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_st7789_benchmark_boot_step("non-blocking", "display_on", start, boot, 0);
+    (void)st7789_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief  benchmark test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the spi bus is replaced by an in-memory mock, no panel is needed
+ */
+uint8_t st7789_benchmark_test(void)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    uint32_t k;
+    st7789_control_interface_color_format_t format[3] = {ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_18_BIT};
+    char *format_name[3] = {"rgb444", "rgb565", "rgb666"};
+    uint16_t rect[3][2] = {{8, 8}, {64, 64}, {240, 320}};
+    uint16_t picture[3] = {8, 32, ST7789_BENCHMARK_IMAGE_SIZE};
+    uint16_t point[2] = {8, 32};
+    uint16_t line[3][2] = {{240, 1}, {240, 32}, {240, 320}};
+    uint16_t polyline[2] = {24, ST7789_BENCHMARK_POLYLINE_SIZE};
+    uint16_t circle[2] = {32, 239};
+    uint16_t round_rect[2][2] = {{64, 64}, {240, 320}};
+    uint16_t polygon[2][2] = {{64, 64}, {240, 320}};
+    uint16_t glyph[2] = {4, ST7789_BENCHMARK_GLYPH_NUM};
+    uint32_t bdf_len;
+    st7789_font_t font[3] = {ST7789_FONT_12, ST7789_FONT_16, ST7789_FONT_24};
+    
+    /* link functions */
+    DRIVER_ST7789_LINK_INIT(&gs_handle, st7789_handle_t);
+    DRIVER_ST7789_LINK_SPI_INIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_SPI_DEINIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(&gs_handle, a_mock_spi_write_cmd);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, a_mock_cmd_data_gpio_write);
+    DRIVER_ST7789_LINK_RESET_GPIO_INIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_DEINIT(&gs_handle, a_mock_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_WRITE(&gs_handle, a_mock_reset_gpio_write);
+    DRIVER_ST7789_LINK_DELAY_MS(&gs_handle, st7789_interface_delay_ms);
+    DRIVER_ST7789_LINK_GET_TIME_MS(&gs_handle, st7789_interface_get_time_ms);
+    DRIVER_ST7789_LINK_DEBUG_PRINT(&gs_handle, st7789_interface_debug_print);
+    
+    /* start benchmark test */
+    st7789_interface_debug_print("st7789: start benchmark test.\n");
+    
+    /* make the images */
+    for (k = 0; k < ST7789_BENCHMARK_IMAGE_SIZE * ST7789_BENCHMARK_IMAGE_SIZE; k++)
+    {
+        gs_image16[k] = (uint16_t)(k * 37);
+        gs_image32[k] = (k * 2654435761U) & 0x3FFFF;
+    }
+    bdf_len = a_st7789_benchmark_make_bdf();
+    
+    /* boot timeline */
+    if (a_st7789_benchmark_boot() != 0)
+    {
+        return 1;
+    }
+    
+    /* st7789 init */
+    res = st7789_init(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_column(&gs_handle, 240);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set column failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_set_row(&gs_handle, 320);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set row failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_ROW_MAJOR);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set image layout failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* csv header */
+    st7789_interface_debug_print("st7789: primitive,format,width,height,iterations,bytes_per_call,"
+                                 "transactions_per_call,dc_writes_per_call,elapsed_ms,ns_per_call,bytes_per_ms\n");
+    for (i = 0; i < 3; i++)
+    {
+        gs_format = format[i];
+        res = st7789_set_interface_pixel_format(&gs_handle, ST7789_RGB_INTERFACE_COLOR_FORMAT_262K, format[i]);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (a_st7789_benchmark_run("clear", format_name[i], 240, 320, a_st7789_benchmark_clear) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (j = 0; j < 3; j++)
+        {
+            if (a_st7789_benchmark_run("fill_rect", format_name[i], rect[j][0], rect[j][1],
+                                       a_st7789_benchmark_fill_rect) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            if (a_st7789_benchmark_run("draw_point", format_name[i], point[j], point[j],
+                                       a_st7789_benchmark_draw_point) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 3; j++)
+        {
+            if (a_st7789_benchmark_run("draw_line", format_name[i], line[j][0], line[j][1],
+                                       a_st7789_benchmark_draw_line) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("draw_line_aa", format_name[i], line[j][0], line[j][1],
+                                       a_st7789_benchmark_draw_line_aa) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            if (a_st7789_benchmark_run("draw_polyline", format_name[i], polyline[j], 320,
+                                       a_st7789_benchmark_draw_polyline) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            if (a_st7789_benchmark_run("draw_circle", format_name[i], circle[j], circle[j],
+                                       a_st7789_benchmark_draw_circle) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("fill_circle", format_name[i], circle[j], circle[j],
+                                       a_st7789_benchmark_fill_circle) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("draw_arc", format_name[i], circle[j], circle[j],
+                                       a_st7789_benchmark_draw_arc) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            if (a_st7789_benchmark_run("draw_round_rect", format_name[i], round_rect[j][0], round_rect[j][1],
+                                       a_st7789_benchmark_draw_round_rect) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("fill_round_rect", format_name[i], round_rect[j][0], round_rect[j][1],
+                                       a_st7789_benchmark_fill_round_rect) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            if (a_st7789_benchmark_run("fill_triangle", format_name[i], polygon[j][0], polygon[j][1],
+                                       a_st7789_benchmark_fill_triangle) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("fill_polygon", format_name[i], polygon[j][0], polygon[j][1],
+                                       a_st7789_benchmark_fill_polygon) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 3; j++)
+        {
+            if (a_st7789_benchmark_run("write_string", format_name[i], font[j], (uint16_t)strlen(gs_str),
+                                       a_st7789_benchmark_write_string) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("write_string_with_background", format_name[i], font[j], (uint16_t)strlen(gs_str),
+                                       a_st7789_benchmark_write_string_with_background) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            res = st7789_set_glyph_cache(&gs_handle, gs_glyph_slot, ST7789_BENCHMARK_GLYPH_NUM);
+            if (res != 0)
+            {
+                st7789_interface_debug_print("st7789: set glyph cache failed.\n");
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if ((a_st7789_benchmark_write_string_with_background(font[j], 0) != 0) ||
+                (a_st7789_benchmark_run("write_string_glyph_cache", format_name[i], font[j], (uint16_t)strlen(gs_str),
+                                        a_st7789_benchmark_write_string_with_background) != 0))
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            st7789_interface_debug_print("st7789: glyph slots,%s,%u,%u,%u\n", format_name[i], (unsigned int)font[j],
+                                         (unsigned int)gs_handle.glyph_hits, (unsigned int)gs_handle.glyph_misses);
+            res = st7789_set_glyph_cache(&gs_handle, NULL, 0);
+            if (res != 0)
+            {
+                st7789_interface_debug_print("st7789: set glyph cache failed.\n");
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if ((font[j] != ST7789_FONT_24) &&
+                (a_st7789_benchmark_run("write_string_aa", format_name[i], font[j], (uint16_t)strlen(gs_str),
+                                        a_st7789_benchmark_write_string_aa) != 0))
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 1; j <= 4; j++)
+        {
+            if (a_st7789_benchmark_run("write_string_scaled", format_name[i], ST7789_FONT_24, j,
+                                       a_st7789_benchmark_write_string_scaled) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (j = 0; j < 2; j++)
+        {
+            res = st7789_bdf_init(&gs_bdf, gs_bdf_file, bdf_len, gs_glyph, glyph[j]);
+            if (res != 0)
+            {
+                st7789_interface_debug_print("st7789: bdf init failed.\n");
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (a_st7789_benchmark_run("write_utf8", format_name[i], glyph[j], (uint16_t)strlen(gs_str),
+                                       a_st7789_benchmark_write_utf8) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+            st7789_interface_debug_print("st7789: glyph cache,%s,%u,%u,%u\n", format_name[i], (unsigned int)glyph[j],
+                                         (unsigned int)gs_bdf.hits, (unsigned int)gs_bdf.misses);
+        }
+        for (j = 0; j < 3; j++)
+        {
+            if (a_st7789_benchmark_run("draw_picture", format_name[i], picture[j], picture[j],
+                                       a_st7789_benchmark_draw_picture) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        gs_compressed_len = a_st7789_benchmark_make_compressed();
+        if (a_st7789_benchmark_run("draw_compressed", format_name[i], 240, 320, a_st7789_benchmark_draw_compressed) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: compressed picture,%s,%u\n", format_name[i], (unsigned int)gs_compressed_len);
+        if (st7789_jpeg_init(&gs_jpeg, gsc_jpeg, sizeof(gsc_jpeg)) != 0)
+        {
+            st7789_interface_debug_print("st7789: jpeg init failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (j = 0; j < 4; j++)
+        {
+            gs_jpeg_scale = (st7789_jpeg_scale_t)j;
+            if (a_st7789_benchmark_run("draw_jpeg", format_name[i], (uint16_t)(64 >> j), (uint16_t)(48 >> j),
+                                       a_st7789_benchmark_draw_jpeg) != 0)
+            {
+                (void)st7789_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* finish benchmark test */
+    (void)st7789_deinit(&gs_handle);
+    st7789_interface_debug_print("st7789: finish benchmark test.\n");
+    
+    return 0;
+}
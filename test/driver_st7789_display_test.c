@@ -66,6 +66,8 @@ uint8_t st7789_display_test(void)
     DRIVER_ST7789_LINK_SPI_INIT(&gs_handle, st7789_interface_spi_init);
     DRIVER_ST7789_LINK_SPI_DEINIT(&gs_handle, st7789_interface_spi_deinit);
     DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(&gs_handle, st7789_interface_spi_write_cmd);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_ASYNC(&gs_handle, st7789_interface_spi_write_cmd_async);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND_BUSY(&gs_handle, st7789_interface_spi_write_cmd_busy);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, st7789_interface_cmd_data_gpio_init);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, st7789_interface_cmd_data_gpio_deinit);
     DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, st7789_interface_cmd_data_gpio_write);
@@ -75,6 +77,9 @@ uint8_t st7789_display_test(void)
     DRIVER_ST7789_LINK_DELAY_MS(&gs_handle, st7789_interface_delay_ms);
     DRIVER_ST7789_LINK_DEBUG_PRINT(&gs_handle, st7789_interface_debug_print);
     
+    /* report the async write end to the handle */
+    st7789_interface_spi_async_attach(&gs_handle);
+    
     /* st7789 info */
     res = st7789_info(&info);
     if (res != 0)
@@ -842,6 +847,52 @@ uint8_t st7789_display_test(void)
         return 1;
     }
     
+    /* background string test */
+    st7789_interface_debug_print("st7789: background string test.\n");
+    
+    /* write string with background */
+    res = st7789_write_string_with_background(&gs_handle, 0, 0, test_str1, (uint16_t)strlen(test_str1), 0xF800U, 0x001FU, ST7789_FONT_12);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string with background failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* write string with background */
+    res = st7789_write_string_with_background(&gs_handle, 0, 50, test_str2, (uint16_t)strlen(test_str2), 0x07E0U, 0xF800U, ST7789_FONT_16);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string with background failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* write string with background */
+    res = st7789_write_string_with_background(&gs_handle, 0, 150, test_str4, (uint16_t)strlen(test_str4), 0x0000U, 0xFFFFU, ST7789_FONT_24);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string with background failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 1000ms */
+    st7789_interface_delay_ms(1000);
+    
+    /* clear */
+    res = st7789_clear(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: clear failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* rectangle test */
     st7789_interface_debug_print("st7789: rectangle test.\n");
     
@@ -0,0 +1,640 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_st7789_emulator.c
+ * @brief     driver st7789 emulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2023-04-15
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2023/04/15  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_st7789_emulator.h"
+
+/**
+ * @brief modelled command definition
+ */
+#define ST7789_CMD_SWRESET         0x01        /**< software reset command */
+#define ST7789_CMD_SLPIN           0x10        /**< sleep in command */
+#define ST7789_CMD_SLPOUT          0x11        /**< sleep out command */
+#define ST7789_CMD_INVOFF          0x20        /**< display inversion off command */
+#define ST7789_CMD_INVON           0x21        /**< display inversion on command */
+#define ST7789_CMD_DISPOFF         0x28        /**< display off command */
+#define ST7789_CMD_DISPON          0x29        /**< display on command */
+#define ST7789_CMD_CASET           0x2A        /**< column address set command */
+#define ST7789_CMD_RASET           0x2B        /**< row address set command */
+#define ST7789_CMD_RAMWR           0x2C        /**< memory write command */
+#define ST7789_CMD_VSCRDEF         0x33        /**< vertical scrolling definition command */
+#define ST7789_CMD_MADCTL          0x36        /**< memory data access control command */
+#define ST7789_CMD_VSCRSADD        0x37        /**< vertical scrolling start address command */
+#define ST7789_CMD_COLMOD          0x3A        /**< interface pixel format command */
+#define ST7789_CMD_RAMWRC          0x3C        /**< memory write continue command */
+
+/**
+ * @brief emulator state structure definition
+ */
+typedef struct st7789_emulator_s
+{
+    uint8_t dc;                      /**< command data level */
+    uint8_t reset;                   /**< reset level */
+    uint8_t cmd;                     /**< current command */
+    uint8_t param[8];                /**< command parameters */
+    uint8_t param_num;               /**< command parameter number */
+    uint8_t colmod;                  /**< interface pixel format */
+    uint8_t madctl;                  /**< memory data access control */
+    uint8_t invert;                  /**< inversion on */
+    uint8_t display;                 /**< display on */
+    uint8_t sleep;                   /**< sleep in */
+    uint16_t xs;                     /**< start column */
+    uint16_t xe;                     /**< end column */
+    uint16_t ys;                     /**< start row */
+    uint16_t ye;                     /**< end row */
+    uint16_t x;                      /**< column counter */
+    uint16_t y;                      /**< row counter */
+    uint16_t tfa;                    /**< top fixed area */
+    uint16_t vsa;                    /**< vertical scrolling area */
+    uint16_t vsp;                    /**< vertical scrolling start address */
+    uint32_t acc;                    /**< pixel bits */
+    uint8_t acc_bits;                /**< pixel bits number */
+} st7789_emulator_t;
+
+static st7789_emulator_t gs_emulator;                                                          /**< emulator state */
+static st7789_emulator_stats_t gs_stats;                                                       /**< emulator statistics */
+static uint8_t gs_memory[ST7789_EMULATOR_ROW][ST7789_EMULATOR_COLUMN][3];                      /**< frame memory in rgb666 */
+
+/**
+ * @brief  emulator panel reset
+ * @note   the memory is kept as the real panel does
+ */
+static void a_st7789_emulator_panel_reset(void)
+{
+    uint8_t dc;
+    uint8_t reset;
+    
+    dc = gs_emulator.dc;
+    reset = gs_emulator.reset;
+    memset(&gs_emulator, 0, sizeof(st7789_emulator_t));
+    gs_emulator.dc = dc;
+    gs_emulator.reset = reset;
+    gs_emulator.colmod = 0x66;
+    gs_emulator.sleep = 1;
+    gs_emulator.xe = ST7789_EMULATOR_COLUMN - 1;
+    gs_emulator.ye = ST7789_EMULATOR_ROW - 1;
+    gs_emulator.vsa = ST7789_EMULATOR_ROW;
+}
+
+/**
+ * @brief     emulator put a pixel at the address counter
+ * @param[in] r red in 6 bits
+ * @param[in] g green in 6 bits
+ * @param[in] b blue in 6 bits
+ * @note      the madctl exchange and mirror are applied here
+ */
+static void a_st7789_emulator_put(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint16_t px;
+    uint16_t py;
+    uint8_t *p;
+    
+    /* row column exchange */
+    if ((gs_emulator.madctl & 0x20) != 0)
+    {
+        px = gs_emulator.y;
+        py = gs_emulator.x;
+    }
+    else
+    {
+        px = gs_emulator.x;
+        py = gs_emulator.y;
+    }
+    
+    gs_stats.pixels++;
+    if ((px >= ST7789_EMULATOR_COLUMN) || (py >= ST7789_EMULATOR_ROW))
+    {
+        gs_stats.dropped_pixels++;
+    }
+    else
+    {
+        /* column and row address order */
+        if ((gs_emulator.madctl & 0x40) != 0)
+        {
+            px = ST7789_EMULATOR_COLUMN - 1 - px;
+        }
+        if ((gs_emulator.madctl & 0x80) != 0)
+        {
+            py = ST7789_EMULATOR_ROW - 1 - py;
+        }
+        p = gs_memory[py][px];
+        if ((p[0] == r) && (p[1] == g) && (p[2] == b))
+        {
+            gs_stats.redundant_pixels++;
+        }
+        p[0] = r;
+        p[1] = g;
+        p[2] = b;
+    }
+    
+    /* next address, the window wraps around */
+    if (gs_emulator.x >= gs_emulator.xe)
+    {
+        gs_emulator.x = gs_emulator.xs;
+        gs_emulator.y = (gs_emulator.y >= gs_emulator.ye) ? gs_emulator.ys : (gs_emulator.y + 1);
+    }
+    else
+    {
+        gs_emulator.x++;
+    }
+}
+
+/**
+ * @brief     emulator write a memory byte
+ * @param[in] data written byte
+ * @note      none
+ */
+static void a_st7789_emulator_pixel_byte(uint8_t data)
+{
+    uint32_t c;
+    
+    gs_stats.pixel_bytes++;
+    if ((gs_emulator.colmod & 0x07) == 0x03)
+    {
+        /* rgb444, 2 pixels in 3 bytes */
+        gs_emulator.acc = (gs_emulator.acc << 8) | data;
+        gs_emulator.acc_bits += 8;
+        if (gs_emulator.acc_bits >= 12)
+        {
+            gs_emulator.acc_bits -= 12;
+            c = (gs_emulator.acc >> gs_emulator.acc_bits) & 0xFFF;
+            gs_emulator.acc &= (1U << gs_emulator.acc_bits) - 1;
+            a_st7789_emulator_put((uint8_t)((((c >> 8) & 0xF) << 2) | (((c >> 8) & 0xF) >> 2)),
+                                  (uint8_t)((((c >> 4) & 0xF) << 2) | (((c >> 4) & 0xF) >> 2)),
+                                  (uint8_t)((((c >> 0) & 0xF) << 2) | (((c >> 0) & 0xF) >> 2)));
+        }
+    }
+    else if ((gs_emulator.colmod & 0x07) == 0x05)
+    {
+        /* rgb565, 1 pixel in 2 bytes */
+        gs_emulator.acc = (gs_emulator.acc << 8) | data;
+        gs_emulator.acc_bits += 8;
+        if (gs_emulator.acc_bits == 16)
+        {
+            c = gs_emulator.acc & 0xFFFF;
+            gs_emulator.acc = 0;
+            gs_emulator.acc_bits = 0;
+            a_st7789_emulator_put((uint8_t)((((c >> 11) & 0x1F) << 1) | (((c >> 11) & 0x1F) >> 4)),
+                                  (uint8_t)((c >> 5) & 0x3F),
+                                  (uint8_t)((((c >> 0) & 0x1F) << 1) | (((c >> 0) & 0x1F) >> 4)));
+        }
+    }
+    else
+    {
+        /* rgb666, 1 pixel in 3 bytes */
+        gs_emulator.acc = (gs_emulator.acc << 6) | (data >> 2);
+        gs_emulator.acc_bits += 6;
+        if (gs_emulator.acc_bits == 18)
+        {
+            c = gs_emulator.acc & 0x3FFFF;
+            gs_emulator.acc = 0;
+            gs_emulator.acc_bits = 0;
+            a_st7789_emulator_put((uint8_t)((c >> 12) & 0x3F), (uint8_t)((c >> 6) & 0x3F), (uint8_t)(c & 0x3F));
+        }
+    }
+}
+
+/**
+ * @brief     emulator write a command
+ * @param[in] cmd written command
+ * @note      none
+ */
+static void a_st7789_emulator_command(uint8_t cmd)
+{
+    gs_stats.command_bytes++;
+    gs_emulator.cmd = cmd;
+    gs_emulator.param_num = 0;
+    switch (cmd)
+    {
+        case ST7789_CMD_SWRESET :
+        {
+            a_st7789_emulator_panel_reset();
+            
+            break;
+        }
+        case ST7789_CMD_SLPIN :
+        {
+            gs_emulator.sleep = 1;
+            
+            break;
+        }
+        case ST7789_CMD_SLPOUT :
+        {
+            gs_emulator.sleep = 0;
+            
+            break;
+        }
+        case ST7789_CMD_INVOFF :
+        {
+            gs_emulator.invert = 0;
+            
+            break;
+        }
+        case ST7789_CMD_INVON :
+        {
+            gs_emulator.invert = 1;
+            
+            break;
+        }
+        case ST7789_CMD_DISPOFF :
+        {
+            gs_emulator.display = 0;
+            
+            break;
+        }
+        case ST7789_CMD_DISPON :
+        {
+            gs_emulator.display = 1;
+            
+            break;
+        }
+        case ST7789_CMD_RAMWR :
+        {
+            gs_emulator.x = gs_emulator.xs;
+            gs_emulator.y = gs_emulator.ys;
+            gs_emulator.acc = 0;
+            gs_emulator.acc_bits = 0;
+            
+            break;
+        }
+        case ST7789_CMD_RAMWRC :
+        {
+            gs_emulator.acc = 0;
+            gs_emulator.acc_bits = 0;
+            
+            break;
+        }
+        case ST7789_CMD_CASET :
+        case ST7789_CMD_RASET :
+        case ST7789_CMD_VSCRDEF :
+        case ST7789_CMD_MADCTL :
+        case ST7789_CMD_VSCRSADD :
+        case ST7789_CMD_COLMOD :
+        {
+            break;
+        }
+        default :
+        {
+            /* the parameters are counted but not modelled */
+            gs_stats.unknown_commands++;
+            
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     emulator write a parameter
+ * @param[in] data written parameter
+ * @note      none
+ */
+static void a_st7789_emulator_parameter(uint8_t data)
+{
+    if ((gs_emulator.cmd == ST7789_CMD_RAMWR) || (gs_emulator.cmd == ST7789_CMD_RAMWRC))
+    {
+        a_st7789_emulator_pixel_byte(data);
+        
+        return;
+    }
+    
+    gs_stats.parameter_bytes++;
+    if (gs_emulator.param_num < 8)
+    {
+        gs_emulator.param[gs_emulator.param_num] = data;
+    }
+    gs_emulator.param_num++;
+    switch (gs_emulator.cmd)
+    {
+        case ST7789_CMD_CASET :
+        {
+            if (gs_emulator.param_num == 4)
+            {
+                gs_emulator.xs = ((uint16_t)gs_emulator.param[0] << 8) | gs_emulator.param[1];
+                gs_emulator.xe = ((uint16_t)gs_emulator.param[2] << 8) | gs_emulator.param[3];
+            }
+            
+            break;
+        }
+        case ST7789_CMD_RASET :
+        {
+            if (gs_emulator.param_num == 4)
+            {
+                gs_emulator.ys = ((uint16_t)gs_emulator.param[0] << 8) | gs_emulator.param[1];
+                gs_emulator.ye = ((uint16_t)gs_emulator.param[2] << 8) | gs_emulator.param[3];
+            }
+            
+            break;
+        }
+        case ST7789_CMD_VSCRDEF :
+        {
+            if (gs_emulator.param_num == 6)
+            {
+                gs_emulator.tfa = ((uint16_t)gs_emulator.param[0] << 8) | gs_emulator.param[1];
+                gs_emulator.vsa = ((uint16_t)gs_emulator.param[2] << 8) | gs_emulator.param[3];
+            }
+            
+            break;
+        }
+        case ST7789_CMD_MADCTL :
+        {
+            if (gs_emulator.param_num == 1)
+            {
+                gs_emulator.madctl = data;
+            }
+            
+            break;
+        }
+        case ST7789_CMD_VSCRSADD :
+        {
+            if (gs_emulator.param_num == 2)
+            {
+                gs_emulator.vsp = ((uint16_t)gs_emulator.param[0] << 8) | gs_emulator.param[1];
+            }
+            
+            break;
+        }
+        case ST7789_CMD_COLMOD :
+        {
+            if (gs_emulator.param_num == 1)
+            {
+                gs_emulator.colmod = data;
+            }
+            
+            break;
+        }
+        default :
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     emulator get the memory row shown at a screen row
+ * @param[in] y screen row
+ * @return    memory row
+ * @note      the scrolling area shows the memory from the start address
+ */
+static uint16_t a_st7789_emulator_screen_row(uint16_t y)
+{
+    if ((gs_emulator.vsa != 0) && (y >= gs_emulator.tfa) && (y < gs_emulator.tfa + gs_emulator.vsa) &&
+        (gs_emulator.vsp >= gs_emulator.tfa) && (gs_emulator.vsp < gs_emulator.tfa + gs_emulator.vsa))
+    {
+        return gs_emulator.tfa + (y - gs_emulator.tfa + gs_emulator.vsp - gs_emulator.tfa) % gs_emulator.vsa;
+    }
+    
+    return y;
+}
+
+/**
+ * @brief  emulator reset
+ * @note   the panel goes back to the power on state and the statistics are cleared
+ */
+void st7789_emulator_reset(void)
+{
+    memset(gs_memory, 0, sizeof(gs_memory));
+    memset(&gs_stats, 0, sizeof(st7789_emulator_stats_t));
+    gs_emulator.dc = 0;
+    gs_emulator.reset = 1;
+    a_st7789_emulator_panel_reset();
+}
+
+/**
+ * @brief  emulator bus init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   link it to spi_init, spi_deinit and the gpio init and deinit
+ */
+uint8_t st7789_emulator_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     emulator spi bus write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t st7789_emulator_spi_write_cmd(uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    
+    gs_stats.spi_writes++;
+    for (i = 0; i < len; i++)
+    {
+        if (gs_emulator.dc == 0)
+        {
+            a_st7789_emulator_command(buf[i]);
+        }
+        else
+        {
+            a_st7789_emulator_parameter(buf[i]);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     emulator command data gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t st7789_emulator_cmd_data_gpio_write(uint8_t value)
+{
+    gs_emulator.dc = (value != 0) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     emulator reset gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      a falling edge resets the panel but keeps the statistics
+ */
+uint8_t st7789_emulator_reset_gpio_write(uint8_t value)
+{
+    if ((gs_emulator.reset != 0) && (value == 0))
+    {
+        a_st7789_emulator_panel_reset();
+    }
+    gs_emulator.reset = (value != 0) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      emulator read the memory
+ * @param[in]  x memory column
+ * @param[in]  y memory row
+ * @param[out] *rgb pointer to an rgb666 buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 x or y is over the memory
+ * @note       none
+ */
+uint8_t st7789_emulator_read_memory(uint16_t x, uint16_t y, uint32_t *rgb)
+{
+    if ((x >= ST7789_EMULATOR_COLUMN) || (y >= ST7789_EMULATOR_ROW))
+    {
+        return 1;
+    }
+    *rgb = ((uint32_t)gs_memory[y][x][0] << 12) | ((uint32_t)gs_memory[y][x][1] << 6) | gs_memory[y][x][2];
+    
+    return 0;
+}
+
+/**
+ * @brief  emulator get the memory hash
+ * @return memory hash
+ * @note   equal memories give equal hashes
+ */
+uint32_t st7789_emulator_get_hash(void)
+{
+    uint32_t i;
+    uint32_t hash;
+    uint8_t *p;
+    
+    p = &gs_memory[0][0][0];
+    hash = 2166136261U;
+    for (i = 0; i < sizeof(gs_memory); i++)
+    {
+        hash = (hash ^ p[i]) * 16777619U;
+    }
+    
+    return hash;
+}
+
+/**
+ * @brief  emulator get the screen hash
+ * @return screen hash
+ * @note   the rows are hashed in the order the scrolling shows them
+ */
+uint32_t st7789_emulator_get_screen_hash(void)
+{
+    uint16_t y;
+    uint32_t i;
+    uint32_t hash;
+    uint8_t *p;
+    
+    hash = 2166136261U;
+    for (y = 0; y < ST7789_EMULATOR_ROW; y++)
+    {
+        p = &gs_memory[a_st7789_emulator_screen_row(y)][0][0];
+        for (i = 0; i < ST7789_EMULATOR_COLUMN * 3; i++)
+        {
+            hash = (hash ^ p[i]) * 16777619U;
+        }
+    }
+    
+    return hash;
+}
+
+/**
+ * @brief      emulator get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void st7789_emulator_get_stats(st7789_emulator_stats_t *stats)
+{
+    memcpy(stats, &gs_stats, sizeof(st7789_emulator_stats_t));
+}
+
+/**
+ * @brief  emulator clear the statistics
+ * @note   none
+ */
+void st7789_emulator_clear_stats(void)
+{
+    memset(&gs_stats, 0, sizeof(st7789_emulator_stats_t));
+}
+
+/**
+ * @brief     emulator dump the screen as a ppm image
+ * @param[in] *write pointer to a write function
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the screen applies the scrolling, inversion, bgr order and display off state
+ */
+uint8_t st7789_emulator_dump_ppm(uint8_t (*write)(uint8_t *buf, uint32_t len))
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t row;
+    uint8_t i;
+    uint8_t c[3];
+    uint8_t line[ST7789_EMULATOR_COLUMN * 3];
+    char header[32];
+    
+    (void)snprintf(header, 32, "P6\n%d %d\n255\n", ST7789_EMULATOR_COLUMN, ST7789_EMULATOR_ROW);
+    if (write((uint8_t *)header, (uint32_t)strlen(header)) != 0)
+    {
+        return 1;
+    }
+    for (y = 0; y < ST7789_EMULATOR_ROW; y++)
+    {
+        row = a_st7789_emulator_screen_row(y);
+        for (x = 0; x < ST7789_EMULATOR_COLUMN; x++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                c[i] = gs_memory[row][x][((gs_emulator.madctl & 0x08) != 0) ? (2 - i) : i];
+                if (gs_emulator.invert != 0)
+                {
+                    c[i] = (~c[i]) & 0x3F;
+                }
+                if ((gs_emulator.display == 0) || (gs_emulator.sleep != 0))
+                {
+                    c[i] = 0;
+                }
+                line[x * 3 + i] = (uint8_t)((c[i] << 2) | (c[i] >> 4));
+            }
+        }
+        if (write(line, ST7789_EMULATOR_COLUMN * 3) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
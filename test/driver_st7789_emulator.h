@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_st7789_emulator.h
+ * @brief     driver st7789 emulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2023-04-15
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2023/04/15  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_ST7789_EMULATOR_H
+#define DRIVER_ST7789_EMULATOR_H
+
+#include "driver_st7789_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup st7789_test_driver
+ * @{
+ */
+
+/**
+ * @brief st7789 emulator memory column definition
+ */
+#ifndef ST7789_EMULATOR_COLUMN
+    #define ST7789_EMULATOR_COLUMN 240        /**< memory column */
+#endif
+
+/**
+ * @brief st7789 emulator memory row definition
+ */
+#ifndef ST7789_EMULATOR_ROW
+    #define ST7789_EMULATOR_ROW 320           /**< memory row */
+#endif
+
+/**
+ * @brief st7789 emulator statistics structure definition
+ */
+typedef struct st7789_emulator_stats_s
+{
+    uint32_t spi_writes;              /**< spi write calls */
+    uint32_t command_bytes;           /**< command bytes */
+    uint32_t parameter_bytes;         /**< command parameter bytes */
+    uint32_t pixel_bytes;             /**< memory write bytes */
+    uint32_t pixels;                  /**< pixels written */
+    uint32_t redundant_pixels;        /**< pixels written with the value already in memory */
+    uint32_t dropped_pixels;          /**< pixels written outside the memory */
+    uint32_t unknown_commands;        /**< commands the emulator does not model */
+} st7789_emulator_stats_t;
+
+/**
+ * @brief  emulator reset
+ * @note   the panel goes back to the power on state and the statistics are cleared
+ */
+void st7789_emulator_reset(void);
+
+/**
+ * @brief  emulator bus init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   link it to spi_init, spi_deinit and the gpio init and deinit
+ */
+uint8_t st7789_emulator_init(void);
+
+/**
+ * @brief     emulator spi bus write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t st7789_emulator_spi_write_cmd(uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     emulator command data gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t st7789_emulator_cmd_data_gpio_write(uint8_t value);
+
+/**
+ * @brief     emulator reset gpio write
+ * @param[in] value written value
+ * @return    status code
+ *            - 0 success
+ * @note      a falling edge resets the panel but keeps the statistics
+ */
+uint8_t st7789_emulator_reset_gpio_write(uint8_t value);
+
+/**
+ * @brief      emulator read the memory
+ * @param[in]  x memory column
+ * @param[in]  y memory row
+ * @param[out] *rgb pointer to an rgb666 buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 x or y is over the memory
+ * @note       none
+ */
+uint8_t st7789_emulator_read_memory(uint16_t x, uint16_t y, uint32_t *rgb);
+
+/**
+ * @brief  emulator get the memory hash
+ * @return memory hash
+ * @note   equal memories give equal hashes
+ */
+uint32_t st7789_emulator_get_hash(void);
+
+/**
+ * @brief  emulator get the screen hash
+ * @return screen hash
+ * @note   the rows are hashed in the order the scrolling shows them
+ */
+uint32_t st7789_emulator_get_screen_hash(void);
+
+/**
+ * @brief      emulator get the statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void st7789_emulator_get_stats(st7789_emulator_stats_t *stats);
+
+/**
+ * @brief  emulator clear the statistics
+ * @note   none
+ */
+void st7789_emulator_clear_stats(void);
+
+/**
+ * @brief     emulator dump the screen as a ppm image
+ * @param[in] *write pointer to a write function
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the screen applies the scrolling, inversion, bgr order and display off state
+ */
+uint8_t st7789_emulator_dump_ppm(uint8_t (*write)(uint8_t *buf, uint32_t len));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1990 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_st7789_emulator_test.c
+ * @brief     driver st7789 emulator test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2023-04-15
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2023/04/15  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_st7789_emulator_test.h"
+#include "driver_st7789_emulator.h"
+
+/**
+ * @brief emulator test image definition
+ */
+#define ST7789_EMULATOR_TEST_IMAGE_WIDTH   40        /**< test image width */
+#define ST7789_EMULATOR_TEST_IMAGE_HEIGHT  30        /**< test image height */
+
+/**
+ * @brief emulator test transfer buffer definition
+ */
+#define ST7789_EMULATOR_TEST_BUFFER_SIZE   41        /**< odd size that splits the points */
+
+static st7789_handle_t gs_handle;                                                                              /**< st7789 handle */
+static uint16_t gs_image16[ST7789_EMULATOR_TEST_IMAGE_WIDTH * ST7789_EMULATOR_TEST_IMAGE_HEIGHT];              /**< 12 and 16 bits image */
+static uint32_t gs_image32[ST7789_EMULATOR_TEST_IMAGE_WIDTH * ST7789_EMULATOR_TEST_IMAGE_HEIGHT];              /**< 18 bits image */
+static uint8_t gs_framebuffer[ST7789_EMULATOR_COLUMN * ST7789_EMULATOR_ROW * 3];                               /**< framebuffer */
+static uint32_t gs_time_ms;                                                                                    /**< test clock */
+static uint8_t gs_buffer[ST7789_EMULATOR_TEST_BUFFER_SIZE];                                                    /**< small transfer buffer */
+static st7789_glyph_t gs_glyph[2];                                                                             /**< small glyph cache */
+static st7789_bdf_t gs_bdf;                                                                                    /**< bdf font */
+static st7789_glyph_slot_t gs_glyph_slot[4];                                                                   /**< small wire format glyph cache */
+static uint8_t gs_wire[ST7789_EMULATOR_TEST_IMAGE_WIDTH * ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 3];              /**< wire format picture */
+static uint8_t gs_compressed[ST7789_EMULATOR_TEST_IMAGE_WIDTH * ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 6];        /**< compressed picture */
+static st7789_jpeg_t gs_jpeg;                                                                                  /**< jpeg decoder */
+static const st7789_point_t gsc_polyline[] =                                                                   /**< polyline */
+{
+    {0, 315}, {30, 300}, {60, 315}, {90, 300}, {120, 315}, {120, 315}, {121, 290}
+};
+static const st7789_point_t gsc_polygon[] =                                                                    /**< concave polygon */
+{
+    {180, 130}, {192, 160}, {225, 160}, {198, 180}, {210, 215}, {180, 192}, {150, 215}, {162, 180}, {135, 160}, {168, 160}
+};
+static const char gsc_bdf[] =                                                                                  /**< bdf font */
+    "STARTFONT 2.1\n"
+    "FONT -test-fixed-medium-r-normal--16-160-75-75-c-80-iso10646-1\n"
+    "SIZE 16 75 75\n"
+    "FONTBOUNDINGBOX 16 16 0 -2\n"
+    "STARTPROPERTIES 3\n"
+    "FONT_ASCENT 14\n"
+    "FONT_DESCENT 2\n"
+    "DEFAULT_CHAR 65\n"
+    "ENDPROPERTIES\n"
+    "CHARS 3\n"
+    "STARTCHAR A\n"
+    "ENCODING 65\n"
+    "SWIDTH 500 0\n"
+    "DWIDTH 8 0\n"
+    "BBX 7 9 0 0\n"
+    "BITMAP\n"
+    "10\n28\n28\n44\n44\n7C\n82\n82\n82\n"
+    "ENDCHAR\n"
+    "STARTCHAR eacute\n"
+    "ENCODING 233\n"
+    "SWIDTH 500 0\n"
+    "DWIDTH 8 0\n"
+    "BBX 6 10 1 0\n"
+    "BITMAP\n"
+    "08\n10\n00\n78\n84\nFC\n80\n80\n84\n78\n"
+    "ENDCHAR\n"
+    "STARTCHAR uni4E2D\n"
+    "ENCODING 20013\n"
+    "SWIDTH 1000 0\n"
+    "DWIDTH 16 0\n"
+    "BBX 15 16 0 -2\n"
+    "BITMAP\n"
+    "0100\n0100\n0100\n7FFC\n4104\n4104\n4104\n4104\n"
+    "7FFC\n4104\n0100\n0100\n0100\n0100\n0100\n0100\n"
+    "ENDCHAR\n"
+    "ENDFONT\n";
+static const char gsc_bdf_overflow[] =                                                                         /**< bdf font with an overflowing box */
+    "STARTFONT 2.1\n"
+    "FONTBOUNDINGBOX 16 99999999999999999999 0 -2\n"
+    "CHARS 0\n"
+    "ENDFONT\n";
+static const uint8_t gsc_script[] =                                                                            /**< init script */
+{
+    0x01, ST7789_SCRIPT_DELAY, 5,
+    0x11, ST7789_SCRIPT_DELAY, 5,
+    0x3A, 1, 0x55,
+    0x36, 1, 0x00,
+    0x20, 0,
+    0x29, 0,
+    0x51, 1, 0x80,
+};
+static const uint8_t gsc_jpeg[] =                                                                              /**< 24x16 4:2:0 baseline jpeg with restart markers */
+{
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0B, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x06, 0x08,
+    0x0B, 0x0C, 0x0B, 0x0A, 0x0C, 0x09, 0x0A, 0x0A, 0x0A, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0A, 0x07, 0x06, 0x07, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x10, 0x00, 0x18, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x17, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0xFF, 0xC4, 0x00, 0x1E, 0x10, 0x00,
+    0x01, 0x04, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x06, 0x08, 0x22, 0x25, 0x92, 0x11, 0x24, 0xA2, 0x82, 0xFF, 0xC4, 0x00, 0x16, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x06, 0x09, 0xFF, 0xC4, 0x00, 0x22, 0x11, 0x00, 0x00, 0x05, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x23, 0xA1, 0x01, 0x02, 0x05, 0x06,
+    0x11, 0x25, 0x31, 0x33, 0x41, 0x51, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x0C,
+    0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xCD, 0xE6, 0x44, 0x5F, 0x14, 0xE8,
+    0x1D, 0x13, 0x81, 0x93, 0x17, 0x85, 0x31, 0xDC, 0xFC, 0x2A, 0xE9, 0x91, 0x17, 0x8D, 0x31, 0xA3,
+    0x44, 0xE0, 0x64, 0x45, 0xE3, 0x4C, 0x6F, 0x85, 0x71, 0x7F, 0xAB, 0x7B, 0xB9, 0x20, 0xBD, 0x24,
+    0x5C, 0xB8, 0xDD, 0xF3, 0xB1, 0x22, 0x32, 0x22, 0xF0, 0xA6, 0x34, 0xE8, 0x85, 0xA3, 0x6C, 0x88,
+    0xBE, 0x69, 0xD0, 0xF0, 0x84, 0x46, 0x79, 0x5A, 0xCC, 0xC5, 0x5C, 0x91, 0xA2, 0x78, 0x59, 0x72,
+    0xD2, 0x6C, 0x3B, 0x23, 0xFF, 0xD9,
+};
+
+/**
+ * @brief     draw the test picture in the current format
+ * @param[in] format control interface color format
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw failed
+ * @note      none
+ */
+static uint8_t a_st7789_emulator_test_draw_picture(st7789_control_interface_color_format_t format,
+                                                   uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT)
+    {
+        return st7789_draw_picture_12bits(&gs_handle, left, top, right, bottom, gs_image16);
+    }
+    else if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT)
+    {
+        return st7789_draw_picture_16bits(&gs_handle, left, top, right, bottom, gs_image16);
+    }
+    else
+    {
+        return st7789_draw_picture_18bits(&gs_handle, left, top, right, bottom, gs_image32);
+    }
+}
+
+/**
+ * @brief     draw the test scene
+ * @param[in] format control interface color format
+ * @param[in] framebuffer use the framebuffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw failed
+ * @note      none
+ */
+static uint8_t a_st7789_emulator_test_scene(st7789_control_interface_color_format_t format, uint8_t framebuffer)
+{
+    uint8_t res;
+    uint16_t i;
+    char str[] = "libdriver";
+    
+    if (framebuffer != 0)
+    {
+        res = st7789_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            
+            return 1;
+        }
+    }
+    res = st7789_clear(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: clear failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_rect(&gs_handle, 10, 10, 229, 109, 0xF81F);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_rect(&gs_handle, 3, 150, 7, 152, 0x07E0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_ROW_MAJOR);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set image layout failed.\n");
+        
+        return 1;
+    }
+    res = a_st7789_emulator_test_draw_picture(format, 20, 120, 20 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                                              120 + ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw picture failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_image_layout(&gs_handle, ST7789_IMAGE_LAYOUT_COLUMN_MAJOR);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set image layout failed.\n");
+        
+        return 1;
+    }
+    res = a_st7789_emulator_test_draw_picture(format, 100, 120, 100 + ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1,
+                                              120 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw picture failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string(&gs_handle, 0, 200, str, (uint16_t)strlen(str), 0xFFFF, ST7789_FONT_16);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string_with_background(&gs_handle, 0, 230, str, (uint16_t)strlen(str),
+                                              0xFFE0, 0x001F, ST7789_FONT_24);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string with background failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_hline(&gs_handle, 0, 239, 115, 0xFFFF);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw hline failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_vline(&gs_handle, 235, 0, 319, 0x001F);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw vline failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_line(&gs_handle, 239, 180, 0, 319, 0xF800);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw line failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_line(&gs_handle, 150, 0, 170, 319, 0x07E0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw line failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_polyline(&gs_handle, gsc_polyline, sizeof(gsc_polyline) / sizeof(gsc_polyline[0]), 0xFFE0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw polyline failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_circle(&gs_handle, 60, 260, 40, 0xF81F);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill circle failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_circle(&gs_handle, 60, 260, 52, 0xFFFF);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw circle failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_arc(&gs_handle, 200, 40, 60, 135, 405, 0x07E0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw arc failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_round_rect(&gs_handle, 130, 200, 200, 250, 12, 0x001F);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill round rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_round_rect(&gs_handle, 125, 195, 205, 255, 16, 0xFFE0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw round rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_triangle(&gs_handle, 20, 130, 110, 150, 40, 230, 0x07FF);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill triangle failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_polygon(&gs_handle, gsc_polygon, sizeof(gsc_polygon) / sizeof(gsc_polygon[0]), 0xF800);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill polygon failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_line_aa(&gs_handle, 5, 120, 110, 190, 0xFFFF, 0x0000);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw line aa failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_line_aa(&gs_handle, 228, 60, 215, 300, 0xFFE0, 0x0000);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw line aa failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string_aa(&gs_handle, 0, 96, "Smooth 1206", 11, 0xFFFF, 0x001F, ST7789_FONT_12);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string aa failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string_aa(&gs_handle, 100, 96, "AA 1608", 7, 0xF800, 0x0000, ST7789_FONT_16);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string aa failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string_scaled(&gs_handle, 120, 200, "42", 2, 0xFFFF, 0x0000, ST7789_FONT_12, 3);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string scaled failed.\n");
+        
+        return 1;
+    }
+    res = st7789_bdf_init(&gs_bdf, gsc_bdf_overflow, sizeof(gsc_bdf_overflow) - 1, gs_glyph,
+                          sizeof(gs_glyph) / sizeof(gs_glyph[0]));
+    if (res != 1)
+    {
+        st7789_interface_debug_print("st7789: the bdf font with an overflowing box is loaded.\n");
+        
+        return 1;
+    }
+    res = st7789_bdf_init(&gs_bdf, gsc_bdf, sizeof(gsc_bdf) - 1, gs_glyph, sizeof(gs_glyph) / sizeof(gs_glyph[0]));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: bdf init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_utf8(&gs_handle, 0, 240, "A\xC3\xA9\xE4\xB8\xAD?\xC3" "A\n\xE4\xB8\xAD", 13, 0xFFE0, &gs_bdf);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write utf8 failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_utf8_with_background(&gs_handle, 200, 240, "\xE4\xB8\xAD\xC3\xA9" "A", 6, 0x001F, 0xFFFF, &gs_bdf);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write utf8 with background failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 40; i++)
+    {
+        res = st7789_draw_point(&gs_handle, 180 + i, 260 + i, 0x07FF);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: draw point failed.\n");
+            
+            return 1;
+        }
+    }
+    if (framebuffer != 0)
+    {
+        res = st7789_flush(&gs_handle);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: flush failed.\n");
+            
+            return 1;
+        }
+        res = st7789_set_framebuffer(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the register shadow test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   repeated settings must not reach the bus until the cache is invalidated
+ */
+static uint8_t a_st7789_emulator_test_shadow(void)
+{
+    uint8_t res;
+    uint8_t i;
+    st7789_emulator_stats_t stats;
+    
+    st7789_emulator_clear_stats();
+    for (i = 0; i < 3; i++)
+    {
+        res = st7789_set_display_brightness(&gs_handle, 0x80);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set display brightness failed.\n");
+            
+            return 1;
+        }
+        res = st7789_set_frame_rate(&gs_handle, ST7789_INVERSION_SELECTION_DOT, ST7789_FRAME_RATE_60_HZ);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set frame rate failed.\n");
+            
+            return 1;
+        }
+    }
+    st7789_emulator_get_stats(&stats);
+    if (stats.command_bytes != 2)
+    {
+        st7789_interface_debug_print("st7789: repeated settings sent %d commands.\n", stats.command_bytes);
+        
+        return 1;
+    }
+    res = st7789_invalidate_cache(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: invalidate cache failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_display_brightness(&gs_handle, 0x80);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set display brightness failed.\n");
+        
+        return 1;
+    }
+    st7789_emulator_get_stats(&stats);
+    if (stats.command_bytes != 3)
+    {
+        st7789_interface_debug_print("st7789: invalidated setting is not sent.\n");
+        
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: repeated settings are skipped.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     check the color of the first point
+ * @param[in] color sent rgb565 color
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+static uint8_t a_st7789_emulator_test_check_point(uint16_t color)
+{
+    uint8_t res;
+    uint32_t rgb;
+    uint32_t expect;
+    
+    res = st7789_fill_rect(&gs_handle, 0, 0, 7, 7, color);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_emulator_read_memory(3, 3, &rgb);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: read memory failed.\n");
+        
+        return 1;
+    }
+    expect = ((uint32_t)((color >> 11) & 0x1F) << 13) | ((uint32_t)((color >> 5) & 0x3F) << 6) | ((color & 0x1F) << 1);
+    if ((rgb & 0x3EFFE) != expect)
+    {
+        st7789_interface_debug_print("st7789: point is 0x%05X, not 0x%05X.\n", rgb, expect);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the init script test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the script must take one command and one data transfer per entry with params and the driver
+ *         must follow the registers it writes
+ */
+static uint8_t a_st7789_emulator_test_script(void)
+{
+    uint8_t res;
+    uint8_t stripped[sizeof(gsc_script)];
+    uint32_t len;
+    st7789_emulator_stats_t stats;
+    
+    st7789_emulator_clear_stats();
+    res = st7789_run_script(&gs_handle, gsc_script, sizeof(gsc_script));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: run script failed.\n");
+        
+        return 1;
+    }
+    st7789_emulator_get_stats(&stats);
+    if ((stats.spi_writes != 8) || (stats.command_bytes != 7) || (stats.parameter_bytes != 3))
+    {
+        st7789_interface_debug_print("st7789: script sent %d spi writes, %d command bytes, %d parameter bytes.\n",
+                                     stats.spi_writes, stats.command_bytes, stats.parameter_bytes);
+        
+        return 1;
+    }
+    res = st7789_set_display_brightness(&gs_handle, 0x80);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set display brightness failed.\n");
+        
+        return 1;
+    }
+    st7789_emulator_get_stats(&stats);
+    if (stats.command_bytes != 7)
+    {
+        st7789_interface_debug_print("st7789: script registers are not shadowed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_check_point(0xF81F) != 0)
+    {
+        return 1;
+    }
+    
+    res = st7789_strip_script_defaults(gsc_script, sizeof(gsc_script), stripped, &len);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: strip script defaults failed.\n");
+        
+        return 1;
+    }
+    if (len != sizeof(gsc_script) - 5)
+    {
+        st7789_interface_debug_print("st7789: stripped script length is %d.\n", len);
+        
+        return 1;
+    }
+    res = st7789_run_script(&gs_handle, stripped, len);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: run script failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_check_point(0x07E0) != 0)
+    {
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: init script and stripped script are ok.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     draw one rgb666 point after a software reset
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the driver must be back at the power on rgb666 format
+ */
+static uint8_t a_st7789_emulator_test_reset_point(void)
+{
+    uint8_t res;
+    uint8_t point[3] = {0xFC, 0x00, 0xFC};
+    uint32_t rgb;
+    
+    res = st7789_sleep_out(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: sleep out failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_raw(&gs_handle, 0, 0, 0, 0, point, 3);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw raw returned %d after the reset.\n", res);
+        
+        return 1;
+    }
+    (void)st7789_emulator_read_memory(0, 0, &rgb);
+    if (rgb != 0x3F03F)
+    {
+        st7789_interface_debug_print("st7789: point is 0x%05X after the reset, not 0x3F03F.\n", rgb);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the software reset test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a scripted and a direct software reset both bring the pixel format back to rgb666
+ */
+static uint8_t a_st7789_emulator_test_reset(void)
+{
+    uint8_t res;
+    uint8_t script[3] = {0x01, ST7789_SCRIPT_DELAY, 5};
+    
+    res = st7789_run_script(&gs_handle, script, sizeof(script));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: run script failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_reset_point() != 0)
+    {
+        return 1;
+    }
+    res = st7789_set_interface_pixel_format(&gs_handle, ST7789_RGB_INTERFACE_COLOR_FORMAT_262K,
+                                            ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
+        
+        return 1;
+    }
+    res = st7789_software_reset(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: software reset failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_reset_point() != 0)
+    {
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: software reset restores the pixel format.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief  test clock
+ * @return time in ms
+ * @note   none
+ */
+static uint32_t a_st7789_emulator_test_get_time_ms(void)
+{
+    return gs_time_ms;
+}
+
+/**
+ * @brief     poll the panel and check the ready state
+ * @param[in] time test clock
+ * @param[in] expect expected ready state
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+static uint8_t a_st7789_emulator_test_poll(uint32_t time, st7789_bool_t expect)
+{
+    uint8_t res;
+    st7789_bool_t ready;
+    
+    gs_time_ms = time;
+    res = st7789_poll(&gs_handle, &ready);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: poll failed.\n");
+        
+        return 1;
+    }
+    if (ready != expect)
+    {
+        st7789_interface_debug_print("st7789: panel ready is %d at %d ms.\n", ready, time);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run the non-blocking boot test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the panel must be ready right after the reset and sleep out times and drawing must be
+ *         rejected before
+ */
+static uint8_t a_st7789_emulator_test_boot(void)
+{
+    uint8_t res;
+    st7789_console_t console;
+    
+    res = st7789_deinit(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: deinit failed.\n");
+        
+        return 1;
+    }
+    DRIVER_ST7789_LINK_GET_TIME_MS(&gs_handle, a_st7789_emulator_test_get_time_ms);
+    gs_time_ms = 1000;
+    res = st7789_init_start(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init start failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_rect(&gs_handle, 0, 0, 7, 7, 0xFFFF);
+    if (res != ST7789_STATUS_BUSY)
+    {
+        st7789_interface_debug_print("st7789: fill rect returned %d during the reset.\n", res);
+        
+        return 1;
+    }
+    if ((st7789_draw_raw(&gs_handle, 0, 0, 0, 0, gs_wire, 2) != ST7789_STATUS_BUSY) ||
+        (st7789_draw_compressed(&gs_handle, 0, 0, 0, 0, gs_compressed, 2) != ST7789_STATUS_BUSY) ||
+        (st7789_write_string_with_background(&gs_handle, 0, 0, "a", 1, 0xFFFF, 0x0000,
+                                             ST7789_FONT_12) != ST7789_STATUS_BUSY) ||
+        (st7789_console_deinit(&gs_handle, &console) != ST7789_STATUS_BUSY) ||
+        (st7789_run_script(&gs_handle, gsc_script, sizeof(gsc_script)) != ST7789_STATUS_BUSY))
+    {
+        st7789_interface_debug_print("st7789: a function is not busy during the reset.\n");
+        
+        return 1;
+    }
+    if ((a_st7789_emulator_test_poll(1024, ST7789_BOOL_FALSE) != 0) ||
+        (a_st7789_emulator_test_poll(1025, ST7789_BOOL_FALSE) != 0) ||
+        (a_st7789_emulator_test_poll(1149, ST7789_BOOL_FALSE) != 0) ||
+        (a_st7789_emulator_test_poll(1150, ST7789_BOOL_TRUE) != 0))
+    {
+        return 1;
+    }
+    res = st7789_sleep_out_start(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: sleep out start failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_rect(&gs_handle, 0, 0, 7, 7, 0xFFFF);
+    if (res != ST7789_STATUS_BUSY)
+    {
+        st7789_interface_debug_print("st7789: fill rect returned %d during the sleep out.\n", res);
+        
+        return 1;
+    }
+    if ((a_st7789_emulator_test_poll(1349, ST7789_BOOL_FALSE) != 0) ||
+        (a_st7789_emulator_test_poll(1350, ST7789_BOOL_TRUE) != 0))
+    {
+        return 1;
+    }
+    res = st7789_set_interface_pixel_format(&gs_handle, ST7789_RGB_INTERFACE_COLOR_FORMAT_262K,
+                                            ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_check_point(0xF800) != 0)
+    {
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: non-blocking boot is ok.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief      make the wire format test picture
+ * @param[in]  format control interface color format
+ * @param[out] *wire pointer to a wire bytes buffer
+ * @return     wire length
+ * @note       flat bands for rle, repeated rows for lz4 and noise
+ */
+static uint32_t a_st7789_emulator_test_wire(st7789_control_interface_color_format_t format, uint8_t *wire)
+{
+    uint16_t x;
+    uint16_t y;
+    uint32_t k;
+    uint32_t j;
+    uint32_t color;
+    uint32_t last;
+    
+    j = 0;
+    last = 0;
+    for (y = 0; y < ST7789_EMULATOR_TEST_IMAGE_HEIGHT; y++)
+    {
+        for (x = 0; x < ST7789_EMULATOR_TEST_IMAGE_WIDTH; x++)
+        {
+            k = (uint32_t)y * ST7789_EMULATOR_TEST_IMAGE_WIDTH + x;
+            if (y < 10)
+            {
+                k = (y < 5) ? 1 : 2;
+            }
+            else if (y < 20)
+            {
+                k = (x < 20) ? 3 : k;
+            }
+            else
+            {
+                k = (y % 2) * ST7789_EMULATOR_TEST_IMAGE_WIDTH + x;
+            }
+            if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT)
+            {
+                color = gs_image16[k] & 0xFFF;
+                if ((x % 2) == 0)
+                {
+                    wire[j] = (uint8_t)(color >> 4);
+                    wire[j + 1] = (uint8_t)((color & 0xF) << 4);
+                    last = color;
+                }
+                else
+                {
+                    wire[j + 1] = (uint8_t)(((last & 0xF) << 4) | (color >> 8));
+                    wire[j + 2] = (uint8_t)(color & 0xFF);
+                    j += 3;
+                }
+            }
+            else if (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT)
+            {
+                color = gs_image16[k];
+                wire[j] = (uint8_t)(color >> 8);
+                wire[j + 1] = (uint8_t)(color & 0xFF);
+                j += 2;
+            }
+            else
+            {
+                color = gs_image32[k];
+                wire[j] = (uint8_t)(((color >> 12) & 0x3F) << 2);
+                wire[j + 1] = (uint8_t)(((color >> 6) & 0x3F) << 2);
+                wire[j + 2] = (uint8_t)((color & 0x3F) << 2);
+                j += 3;
+            }
+        }
+    }
+    
+    return j;
+}
+
+/**
+ * @brief      rle encode a block
+ * @param[in]  *src pointer to the block bytes
+ * @param[in]  len block length
+ * @param[in]  unit transfer unit size
+ * @param[out] *dst pointer to the encoded bytes buffer
+ * @return     encoded length
+ * @note       len is whole units
+ */
+static uint32_t a_st7789_emulator_test_rle(const uint8_t *src, uint32_t len, uint8_t unit, uint8_t *dst)
+{
+    uint32_t i;
+    uint32_t o;
+    uint32_t k;
+    
+    i = 0;
+    o = 0;
+    while (i < len)
+    {
+        k = 1;
+        while ((k < 129) && ((i + (k + 1) * unit) <= len) && (memcmp(&src[i], &src[i + k * unit], unit) == 0))
+        {
+            k++;
+        }
+        if (k >= 2)
+        {
+            dst[o] = (uint8_t)(k + 126);
+            memcpy(&dst[o + 1], &src[i], unit);
+            o += 1 + unit;
+            i += k * unit;
+            
+            continue;
+        }
+        while ((k < 128) && ((i + (k + 1) * unit) <= len) &&
+               (((i + (k + 2) * unit) > len) || (memcmp(&src[i + k * unit], &src[i + (k + 1) * unit], unit) != 0)))
+        {
+            k++;
+        }
+        dst[o] = (uint8_t)(k - 1);
+        memcpy(&dst[o + 1], &src[i], k * unit);
+        o += 1 + k * unit;
+        i += k * unit;
+    }
+    
+    return o;
+}
+
+/**
+ * @brief      write an lz4 length
+ * @param[out] *dst pointer to the encoded bytes buffer
+ * @param[in]  n length over 15
+ * @return     written length
+ * @note       none
+ */
+static uint32_t a_st7789_emulator_test_lz4_length(uint8_t *dst, uint32_t n)
+{
+    uint32_t o;
+    
+    o = 0;
+    while (n >= 255)
+    {
+        dst[o++] = 255;
+        n -= 255;
+    }
+    dst[o++] = (uint8_t)n;
+    
+    return o;
+}
+
+/**
+ * @brief      lz4 encode a block
+ * @param[in]  *src pointer to the block bytes
+ * @param[in]  len block length
+ * @param[out] *dst pointer to the encoded bytes buffer
+ * @return     encoded length
+ * @note       greedy search of the longest match, the last 5 bytes are literals
+ */
+static uint32_t a_st7789_emulator_test_lz4(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t m;
+    uint32_t o;
+    uint32_t anchor;
+    uint32_t lit;
+    uint32_t best;
+    uint32_t offset;
+    
+    i = 0;
+    o = 0;
+    anchor = 0;
+    while ((i + 12) <= len)
+    {
+        best = 0;
+        offset = 0;
+        for (j = 0; j < i; j++)
+        {
+            m = 0;
+            while (((i + m + 5) < len) && (src[j + m] == src[i + m]))
+            {
+                m++;
+            }
+            if (m > best)
+            {
+                best = m;
+                offset = i - j;
+            }
+        }
+        if (best < 4)
+        {
+            i++;
+            
+            continue;
+        }
+        lit = i - anchor;
+        dst[o] = (uint8_t)(((lit < 15) ? lit : 15) << 4) | (uint8_t)(((best - 4) < 15) ? (best - 4) : 15);
+        o++;
+        if (lit >= 15)
+        {
+            o += a_st7789_emulator_test_lz4_length(&dst[o], lit - 15);
+        }
+        memcpy(&dst[o], &src[anchor], lit);
+        o += lit;
+        dst[o] = (uint8_t)(offset & 0xFF);
+        dst[o + 1] = (uint8_t)(offset >> 8);
+        o += 2;
+        if ((best - 4) >= 15)
+        {
+            o += a_st7789_emulator_test_lz4_length(&dst[o], best - 4 - 15);
+        }
+        i += best;
+        anchor = i;
+    }
+    lit = len - anchor;
+    dst[o] = (uint8_t)(((lit < 15) ? lit : 15) << 4);
+    o++;
+    if (lit >= 15)
+    {
+        o += a_st7789_emulator_test_lz4_length(&dst[o], lit - 15);
+    }
+    memcpy(&dst[o], &src[anchor], lit);
+    o += lit;
+    
+    return o;
+}
+
+/**
+ * @brief      compress the wire format picture
+ * @param[in]  format control interface color format
+ * @param[in]  *wire pointer to the wire bytes
+ * @param[in]  len wire length
+ * @param[in]  block block length
+ * @param[out] *data pointer to a compressed data buffer
+ * @return     compressed length
+ * @note       the blocks take the stored, rle and lz4 method in turn
+ */
+static uint32_t a_st7789_emulator_test_compress(st7789_control_interface_color_format_t format, const uint8_t *wire,
+                                                uint32_t len, uint32_t block, uint8_t *data)
+{
+    uint32_t i;
+    uint32_t o;
+    uint32_t n;
+    uint32_t m;
+    uint8_t method;
+    
+    data[0] = 'Z';
+    data[1] = (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT) ? 12 :
+              ((format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT) ? 16 : 18);
+    o = 2;
+    method = 0;
+    for (i = 0; i < len; i += n)
+    {
+        n = ((len - i) > block) ? block : (len - i);
+        if (method == 1)
+        {
+            m = a_st7789_emulator_test_rle(&wire[i], n, (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT) ? 2 : 3,
+                                           &data[o + 5]);
+        }
+        else if (method == 2)
+        {
+            m = a_st7789_emulator_test_lz4(&wire[i], n, &data[o + 5]);
+        }
+        else
+        {
+            memcpy(&data[o + 5], &wire[i], n);
+            m = n;
+        }
+        data[o] = method;
+        data[o + 1] = (uint8_t)(n & 0xFF);
+        data[o + 2] = (uint8_t)(n >> 8);
+        data[o + 3] = (uint8_t)(m & 0xFF);
+        data[o + 4] = (uint8_t)(m >> 8);
+        o += 5 + m;
+        method = (method + 1) % 3;
+    }
+    
+    return o;
+}
+
+/**
+ * @brief     draw and check the compressed picture
+ * @param[in] *data pointer to a compressed data buffer
+ * @param[in] len compressed data length
+ * @param[in] framebuffer use the framebuffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the compressed picture is compared with the raw picture on its left
+ */
+static uint8_t a_st7789_emulator_test_compressed_check(uint8_t *data, uint32_t len, uint8_t framebuffer)
+{
+    uint8_t res;
+    uint16_t x;
+    uint16_t y;
+    uint32_t a;
+    uint32_t b;
+    
+    res = st7789_fill_rect(&gs_handle, 100, 0, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                           ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1, 0x0000);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    if (framebuffer != 0)
+    {
+        res = st7789_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            
+            return 1;
+        }
+    }
+    res = st7789_draw_compressed(&gs_handle, 100, 0, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                                 ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1, data, len);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw compressed failed.\n");
+        
+        return 1;
+    }
+    if (framebuffer != 0)
+    {
+        res = st7789_flush(&gs_handle);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: flush failed.\n");
+            
+            return 1;
+        }
+        res = st7789_set_framebuffer(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+            
+            return 1;
+        }
+    }
+    for (y = 0; y < ST7789_EMULATOR_TEST_IMAGE_HEIGHT; y++)
+    {
+        for (x = 0; x < ST7789_EMULATOR_TEST_IMAGE_WIDTH; x++)
+        {
+            (void)st7789_emulator_read_memory(x, y, &a);
+            (void)st7789_emulator_read_memory(100 + x, y, &b);
+            if (a != b)
+            {
+                st7789_interface_debug_print("st7789: compressed point (%d, %d) is 0x%05X, not 0x%05X.\n", x, y, b, a);
+                
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the compressed picture test
+ * @param[in] format control interface color format
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the picture is drawn directly, through the framebuffer and through a small transfer buffer
+ */
+static uint8_t a_st7789_emulator_test_compressed(st7789_control_interface_color_format_t format)
+{
+    uint8_t res;
+    uint16_t x;
+    uint16_t y;
+    uint32_t a;
+    uint32_t b;
+    uint32_t len;
+    uint32_t size;
+    
+    len = a_st7789_emulator_test_wire(format, gs_wire);
+    res = st7789_clear(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: clear failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_raw(&gs_handle, 0, 0, ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1, ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1,
+                          gs_wire, len);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw raw failed.\n");
+        
+        return 1;
+    }
+    
+    /* big blocks */
+    size = a_st7789_emulator_test_compress(format, gs_wire, len, 1200, gs_compressed);
+    st7789_interface_debug_print("st7789: compressed %d bytes to %d bytes in 1200 bytes blocks.\n", len, size);
+    if ((a_st7789_emulator_test_compressed_check(gs_compressed, size, 0) != 0) ||
+        (a_st7789_emulator_test_compressed_check(gs_compressed, size, 1) != 0))
+    {
+        return 1;
+    }
+    
+    /* the blocks must fit the transfer buffer */
+    res = st7789_set_buffer(&gs_handle, gs_buffer, sizeof(gs_buffer));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set buffer failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_compressed(&gs_handle, 100, 0, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                                 ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1, gs_compressed, size);
+    if (res != 11)
+    {
+        st7789_interface_debug_print("st7789: the block over the buffer is drawn.\n");
+        
+        return 1;
+    }
+    
+    /* small blocks */
+    size = a_st7789_emulator_test_compress(format, gs_wire, len, 36, gs_compressed);
+    st7789_interface_debug_print("st7789: compressed %d bytes to %d bytes in 36 bytes blocks.\n", len, size);
+    if (a_st7789_emulator_test_compressed_check(gs_compressed, size, 0) != 0)
+    {
+        return 1;
+    }
+    res = st7789_set_buffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set buffer failed.\n");
+        
+        return 1;
+    }
+    
+    /* corrupt data */
+    res = st7789_draw_compressed(&gs_handle, 100, 0, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                                 ST7789_EMULATOR_TEST_IMAGE_HEIGHT - 1, gs_compressed, size - 1);
+    if (res != 11)
+    {
+        st7789_interface_debug_print("st7789: the truncated data is drawn.\n");
+        
+        return 1;
+    }
+    
+    /* the next window after the corrupt one must not continue its memory write */
+    res = st7789_draw_raw(&gs_handle, 100, ST7789_EMULATOR_TEST_IMAGE_HEIGHT, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                          ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 2 - 1, gs_wire, len);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw raw failed.\n");
+        
+        return 1;
+    }
+    for (y = 0; y < ST7789_EMULATOR_TEST_IMAGE_HEIGHT; y++)
+    {
+        for (x = 0; x < ST7789_EMULATOR_TEST_IMAGE_WIDTH; x++)
+        {
+            (void)st7789_emulator_read_memory(x, y, &a);
+            (void)st7789_emulator_read_memory(100 + x, ST7789_EMULATOR_TEST_IMAGE_HEIGHT + y, &b);
+            if (a != b)
+            {
+                st7789_interface_debug_print("st7789: point (%d, %d) after the corrupt data is 0x%05X, not 0x%05X.\n",
+                                             x, y, b, a);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* the blocks drawn into the framebuffer before the corrupt one must be flushed */
+    res = st7789_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+    
+        return 1;
+    }
+    res = st7789_draw_compressed(&gs_handle, 100, ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 2, 100 + ST7789_EMULATOR_TEST_IMAGE_WIDTH - 1,
+                                 ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 3 - 1, gs_compressed, size - 1);
+    if (res != 11)
+    {
+        st7789_interface_debug_print("st7789: the truncated data is drawn.\n");
+    
+        return 1;
+    }
+    res = st7789_flush(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: flush failed.\n");
+    
+        return 1;
+    }
+    res = st7789_set_framebuffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+    
+        return 1;
+    }
+    for (x = 0; x < ST7789_EMULATOR_TEST_IMAGE_WIDTH; x++)
+    {
+        (void)st7789_emulator_read_memory(x, 0, &a);
+        (void)st7789_emulator_read_memory(100 + x, ST7789_EMULATOR_TEST_IMAGE_HEIGHT * 2, &b);
+        if (a != b)
+        {
+            st7789_interface_debug_print("st7789: point (%d, 0) before the corrupt block is 0x%05X, not 0x%05X.\n",
+                                         x, b, a);
+    
+            return 1;
+        }
+    }
+    st7789_interface_debug_print("st7789: compressed picture is pixel identical.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     check a jpeg picture on the screen
+ * @param[in] x top left coordinate x
+ * @param[in] y top left coordinate y
+ * @param[in] scale scale shift
+ * @param[in] tolerance max channel error
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every point is compared with the source pattern averaged over the scaled area
+ */
+static uint8_t a_st7789_emulator_test_jpeg_check(uint16_t x, uint16_t y, uint8_t scale, uint8_t tolerance)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    uint16_t n;
+    uint8_t c;
+    int32_t d;
+    uint32_t a;
+    uint32_t sum[3];
+    uint32_t expect;
+    
+    n = (uint16_t)(1U << scale);
+    for (j = 0; j < ((16 + n - 1) / n); j++)
+    {
+        for (i = 0; i < ((24 + n - 1) / n); i++)
+        {
+            sum[0] = 0;
+            sum[1] = 0;
+            sum[2] = 0;
+            for (k = 0; k < (n * n); k++)
+            {
+                sum[0] += (uint32_t)(i * n + k % n) * 10;
+                sum[1] += (uint32_t)(j * n + k / n) * 15;
+                sum[2] += 128;
+            }
+            (void)st7789_emulator_read_memory(x + i, y + j, &a);
+            for (c = 0; c < 3; c++)
+            {
+                expect = (sum[c] / (n * n)) >> 2;
+                d = (int32_t)((a >> (12 - c * 6)) & 0x3F) - (int32_t)expect;
+                if ((d > tolerance) || (d < -tolerance))
+                {
+                    st7789_interface_debug_print("st7789: jpeg point (%d, %d) is 0x%05X at scale %d.\n", i, j, a, n);
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the jpeg picture test
+ * @param[in] format control interface color format
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the picture is drawn directly, through the framebuffer, at every scale and through a small transfer buffer
+ */
+static uint8_t a_st7789_emulator_test_jpeg(st7789_control_interface_color_format_t format)
+{
+    uint8_t res;
+    uint8_t scale;
+    uint8_t tolerance;
+    uint16_t x;
+    uint16_t y;
+    uint32_t a;
+    uint32_t b;
+    
+    tolerance = (format == ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT) ? 6 : 4;
+    res = st7789_jpeg_init(&gs_jpeg, gsc_jpeg + 1, sizeof(gsc_jpeg) - 1);
+    if (res != 1)
+    {
+        st7789_interface_debug_print("st7789: the data without soi is a jpeg.\n");
+        
+        return 1;
+    }
+    res = st7789_jpeg_init(&gs_jpeg, gsc_jpeg, sizeof(gsc_jpeg));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: jpeg init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_clear(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: clear failed.\n");
+        
+        return 1;
+    }
+    
+    /* direct and framebuffer drawing */
+    res = st7789_draw_jpeg(&gs_handle, 0, 0, &gs_jpeg, ST7789_JPEG_SCALE_1_1);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw jpeg failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_jpeg_check(0, 0, 0, tolerance) != 0)
+    {
+        return 1;
+    }
+    res = st7789_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_jpeg(&gs_handle, 100, 0, &gs_jpeg, ST7789_JPEG_SCALE_1_1);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw jpeg failed.\n");
+        
+        return 1;
+    }
+    res = st7789_flush(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: flush failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_framebuffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set framebuffer failed.\n");
+        
+        return 1;
+    }
+    for (y = 0; y < 16; y++)
+    {
+        for (x = 0; x < 24; x++)
+        {
+            (void)st7789_emulator_read_memory(x, y, &a);
+            (void)st7789_emulator_read_memory(100 + x, y, &b);
+            if (a != b)
+            {
+                st7789_interface_debug_print("st7789: jpeg point (%d, %d) is 0x%05X, not 0x%05X.\n", x, y, b, a);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* scaled drawing */
+    for (scale = 1; scale < 4; scale++)
+    {
+        res = st7789_draw_jpeg(&gs_handle, 0, 100, &gs_jpeg, (st7789_jpeg_scale_t)scale);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: draw jpeg failed.\n");
+            
+            return 1;
+        }
+        if (a_st7789_emulator_test_jpeg_check(0, 100, scale, tolerance) != 0)
+        {
+            return 1;
+        }
+    }
+    res = st7789_draw_jpeg(&gs_handle, 0, 100, &gs_jpeg, (st7789_jpeg_scale_t)4);
+    if (res != 6)
+    {
+        st7789_interface_debug_print("st7789: the invalid scale is drawn.\n");
+        
+        return 1;
+    }
+    
+    /* the mcu row must fit the transfer buffer */
+    res = st7789_set_buffer(&gs_handle, gs_buffer, sizeof(gs_buffer));
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set buffer failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_jpeg(&gs_handle, 0, 100, &gs_jpeg, ST7789_JPEG_SCALE_1_1);
+    if (res != 7)
+    {
+        st7789_interface_debug_print("st7789: the mcu over the buffer is drawn.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_jpeg(&gs_handle, 0, 100, &gs_jpeg, ST7789_JPEG_SCALE_1_8);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: draw jpeg failed.\n");
+        
+        return 1;
+    }
+    if (a_st7789_emulator_test_jpeg_check(0, 100, 3, tolerance) != 0)
+    {
+        return 1;
+    }
+    res = st7789_set_buffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set buffer failed.\n");
+        
+        return 1;
+    }
+    
+    /* truncated data */
+    res = st7789_jpeg_init(&gs_jpeg, gsc_jpeg, sizeof(gsc_jpeg) - 40);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: jpeg init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_draw_jpeg(&gs_handle, 0, 100, &gs_jpeg, ST7789_JPEG_SCALE_1_1);
+    if (res != 8)
+    {
+        st7789_interface_debug_print("st7789: the truncated jpeg is drawn.\n");
+        
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: jpeg picture matches the source.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief  draw the console test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the scrolled console screen is compared with the same text drawn without scrolling
+ */
+static uint8_t a_st7789_emulator_test_console(void)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t k;
+    uint32_t hash_expect;
+    uint32_t hash_console;
+    char str[] = "st7789 console";
+    char line[] = "line 00\n";
+    st7789_console_t console;
+    st7789_emulator_stats_t stats;
+    
+    /* draw the header and the footer */
+    res = st7789_fill_rect(&gs_handle, 0, 0, ST7789_EMULATOR_COLUMN - 1, 23, 0x001F);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    res = st7789_write_string_with_background(&gs_handle, 0, 4, str, (uint16_t)strlen(str),
+                                              0xFFFF, 0x001F, ST7789_FONT_16);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: write string with background failed.\n");
+        
+        return 1;
+    }
+    res = st7789_fill_rect(&gs_handle, 0, ST7789_EMULATOR_ROW - 16, ST7789_EMULATOR_COLUMN - 1,
+                           ST7789_EMULATOR_ROW - 1, 0x07E0);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: fill rect failed.\n");
+        
+        return 1;
+    }
+    
+    /* draw the expected screen without scrolling */
+    res = st7789_console_init(&gs_handle, &console, 24, 16, ST7789_FONT_16, 0xFFE0, 0x0000);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: console init failed.\n");
+        
+        return 1;
+    }
+    for (k = 0; k < console.lines - 1; k++)
+    {
+        i = 40 - (console.lines - 1) + k;
+        line[5] = (char)('0' + i / 10);
+        line[6] = (char)('0' + i % 10);
+        res = st7789_write_string_with_background(&gs_handle, 0, 24 + k * ST7789_FONT_16, line, 7,
+                                                  0xFFE0, 0x0000, ST7789_FONT_16);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: write string with background failed.\n");
+            
+            return 1;
+        }
+    }
+    hash_expect = st7789_emulator_get_screen_hash();
+    
+    /* write the lines in the console */
+    res = st7789_console_clear(&gs_handle, &console);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: console clear failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 40; i++)
+    {
+        line[5] = (char)('0' + i / 10);
+        line[6] = (char)('0' + i % 10);
+        st7789_emulator_clear_stats();
+        res = st7789_console_write(&gs_handle, &console, line, 8);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: console write failed.\n");
+            
+            return 1;
+        }
+    }
+    st7789_emulator_get_stats(&stats);
+    st7789_interface_debug_print("st7789: console scrolled line spi writes %d, command bytes %d, parameter bytes %d, pixel bytes %d.\n",
+                                 stats.spi_writes, stats.command_bytes, stats.parameter_bytes, stats.pixel_bytes);
+    hash_console = st7789_emulator_get_screen_hash();
+    
+    /* check the screen */
+    if (hash_expect != hash_console)
+    {
+        st7789_interface_debug_print("st7789: console and expected screens differ.\n");
+        
+        return 1;
+    }
+    if (stats.pixels > (uint32_t)(ST7789_EMULATOR_COLUMN + 7 * 8) * ST7789_FONT_16)
+    {
+        st7789_interface_debug_print("st7789: console redraws more than one line.\n");
+        
+        return 1;
+    }
+    st7789_interface_debug_print("st7789: console screens are pixel identical.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     emulator test
+ * @param[in] *write pointer to a ppm write function, NULL means no dump
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the panel is replaced by the emulator, no panel is needed
+ */
+uint8_t st7789_emulator_test(uint8_t (*write)(uint8_t *buf, uint32_t len))
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t k;
+    uint32_t hash_direct;
+    uint32_t hash_framebuffer;
+    uint32_t hash_buffer;
+    uint32_t hash_cache;
+    st7789_emulator_stats_t stats;
+    st7789_control_interface_color_format_t format[3] = {ST7789_CONTROL_INTERFACE_COLOR_FORMAT_12_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_16_BIT,
+                                                         ST7789_CONTROL_INTERFACE_COLOR_FORMAT_18_BIT};
+    char *format_name[3] = {"rgb444", "rgb565", "rgb666"};
+    
+    /* link functions */
+    DRIVER_ST7789_LINK_INIT(&gs_handle, st7789_handle_t);
+    DRIVER_ST7789_LINK_SPI_INIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_SPI_DEINIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_SPI_WRITE_COMMAND(&gs_handle, st7789_emulator_spi_write_cmd);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, st7789_emulator_cmd_data_gpio_write);
+    DRIVER_ST7789_LINK_RESET_GPIO_INIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_DEINIT(&gs_handle, st7789_emulator_init);
+    DRIVER_ST7789_LINK_RESET_GPIO_WRITE(&gs_handle, st7789_emulator_reset_gpio_write);
+    DRIVER_ST7789_LINK_DELAY_MS(&gs_handle, st7789_interface_delay_ms);
+    DRIVER_ST7789_LINK_DEBUG_PRINT(&gs_handle, st7789_interface_debug_print);
+    
+    /* start emulator test */
+    st7789_interface_debug_print("st7789: start emulator test.\n");
+    
+    /* make the images */
+    for (k = 0; k < ST7789_EMULATOR_TEST_IMAGE_WIDTH * ST7789_EMULATOR_TEST_IMAGE_HEIGHT; k++)
+    {
+        gs_image16[k] = (uint16_t)(k * 37 + (k >> 3));
+        gs_image32[k] = (k * 2654435761U) & 0x3FFFF;
+    }
+    
+    /* st7789 init */
+    st7789_emulator_reset();
+    res = st7789_init(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: init failed.\n");
+        
+        return 1;
+    }
+    res = st7789_set_column(&gs_handle, ST7789_EMULATOR_COLUMN);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set column failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_set_row(&gs_handle, ST7789_EMULATOR_ROW);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: set row failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_sleep_out(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: sleep out failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = st7789_display_on(&gs_handle);
+    if (res != 0)
+    {
+        st7789_interface_debug_print("st7789: display on failed.\n");
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < 3; i++)
+    {
+        res = st7789_set_interface_pixel_format(&gs_handle, ST7789_RGB_INTERFACE_COLOR_FORMAT_262K, format[i]);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set interface pixel format failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* direct drawing */
+        st7789_emulator_clear_stats();
+        if (a_st7789_emulator_test_scene(format[i], 0) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hash_direct = st7789_emulator_get_hash();
+        st7789_emulator_get_stats(&stats);
+        st7789_interface_debug_print("st7789: %s direct spi writes %d, command bytes %d, parameter bytes %d, pixel bytes %d.\n",
+                                     format_name[i], stats.spi_writes, stats.command_bytes,
+                                     stats.parameter_bytes, stats.pixel_bytes);
+        st7789_interface_debug_print("st7789: %s direct pixels %d, redundant pixels %d, dropped pixels %d.\n",
+                                     format_name[i], stats.pixels, stats.redundant_pixels, stats.dropped_pixels);
+                                     
+        /* framebuffer drawing */
+        st7789_emulator_clear_stats();
+        if (a_st7789_emulator_test_scene(format[i], 1) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hash_framebuffer = st7789_emulator_get_hash();
+        st7789_emulator_get_stats(&stats);
+        st7789_interface_debug_print("st7789: %s framebuffer spi writes %d, command bytes %d, parameter bytes %d, pixel bytes %d.\n",
+                                     format_name[i], stats.spi_writes, stats.command_bytes,
+                                     stats.parameter_bytes, stats.pixel_bytes);
+        st7789_interface_debug_print("st7789: %s framebuffer pixels %d, redundant pixels %d, dropped pixels %d.\n",
+                                     format_name[i], stats.pixels, stats.redundant_pixels, stats.dropped_pixels);
+                                     
+        /* check the screen */
+        if (hash_direct != hash_framebuffer)
+        {
+            st7789_interface_debug_print("st7789: %s direct and framebuffer screens differ.\n", format_name[i]);
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: %s screens are pixel identical.\n", format_name[i]);
+        
+        /* small transfer buffer drawing */
+        res = st7789_set_buffer(&gs_handle, gs_buffer, sizeof(gs_buffer));
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set buffer failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_emulator_clear_stats();
+        if (a_st7789_emulator_test_scene(format[i], 0) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hash_buffer = st7789_emulator_get_hash();
+        st7789_emulator_get_stats(&stats);
+        st7789_interface_debug_print("st7789: %s small buffer spi writes %d, pixel bytes %d.\n",
+                                     format_name[i], stats.spi_writes, stats.pixel_bytes);
+        res = st7789_set_buffer(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set buffer failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (hash_buffer != hash_direct)
+        {
+            st7789_interface_debug_print("st7789: %s small buffer screen differs.\n", format_name[i]);
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: %s small buffer screen is pixel identical.\n", format_name[i]);
+        
+        /* glyph cache drawing */
+        res = st7789_set_glyph_cache(&gs_handle, gs_glyph_slot, sizeof(gs_glyph_slot) / sizeof(gs_glyph_slot[0]));
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set glyph cache failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_emulator_clear_stats();
+        if (a_st7789_emulator_test_scene(format[i], 0) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hash_cache = st7789_emulator_get_hash();
+        st7789_emulator_get_stats(&stats);
+        st7789_interface_debug_print("st7789: %s glyph cache spi writes %d, pixel bytes %d, hits %d, misses %d.\n",
+                                     format_name[i], stats.spi_writes, stats.pixel_bytes,
+                                     gs_handle.glyph_hits, gs_handle.glyph_misses);
+        res = st7789_set_glyph_cache(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            st7789_interface_debug_print("st7789: set glyph cache failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (hash_cache != hash_direct)
+        {
+            st7789_interface_debug_print("st7789: %s glyph cache screen differs.\n", format_name[i]);
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: %s glyph cache screen is pixel identical.\n", format_name[i]);
+        
+        /* compressed picture */
+        if (a_st7789_emulator_test_compressed(format[i]) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* jpeg picture */
+        if (a_st7789_emulator_test_jpeg(format[i]) != 0)
+        {
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* register shadow test */
+    if (a_st7789_emulator_test_shadow() != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* console test */
+    if (a_st7789_emulator_test_console() != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* init script test */
+    if (a_st7789_emulator_test_script() != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* software reset test */
+    if (a_st7789_emulator_test_reset() != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* non-blocking boot test */
+    if (a_st7789_emulator_test_boot() != 0)
+    {
+        (void)st7789_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* dump the last screen */
+    if (write != NULL)
+    {
+        if (st7789_emulator_dump_ppm(write) != 0)
+        {
+            st7789_interface_debug_print("st7789: dump ppm failed.\n");
+            (void)st7789_deinit(&gs_handle);
+            
+            return 1;
+        }
+        st7789_interface_debug_print("st7789: dump ppm.\n");
+    }
+    
+    /* finish emulator test */
+    (void)st7789_deinit(&gs_handle);
+    st7789_interface_debug_print("st7789: finish emulator test.\n");
+    
+    return 0;
+}